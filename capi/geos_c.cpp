@@ -17,7 +17,7 @@
  ***********************************************************************/
 
 #include <geos/geom/prep/PreparedGeometryFactory.h> 
-#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/PackedSTRtree.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKTWriter.h>
@@ -35,7 +35,7 @@
 #define GEOSGeometry geos::geom::Geometry
 #define GEOSPreparedGeometry geos::geom::prep::PreparedGeometry
 #define GEOSCoordSequence geos::geom::CoordinateSequence
-#define GEOSSTRtree geos::index::strtree::STRtree
+#define GEOSSTRtree geos::index::strtree::PackedSTRtree
 #define GEOSWKTReader_t geos::io::WKTReader
 #define GEOSWKTWriter_t geos::io::WKTWriter
 #define GEOSWKBReader_t geos::io::WKBReader
@@ -72,7 +72,7 @@ using geos::io::WKBReader;
 using geos::io::WKBWriter;
 using geos::io::CLocalizer;
 
-using geos::index::strtree::STRtree;
+using geos::index::strtree::PackedSTRtree;
 
 using geos::operation::overlay::OverlayOp;
 using geos::operation::overlay::overlayOp;
@@ -255,6 +255,12 @@ GEOSDistance(const Geometry *g1, const Geometry *g2, double *dist)
     return GEOSDistance_r( handle, g1, g2, dist );
 }
 
+char
+GEOSDistanceWithin(const Geometry *g1, const Geometry *g2, double dist)
+{
+    return GEOSDistanceWithin_r( handle, g1, g2, dist );
+}
+
 int
 GEOSHausdorffDistance(const Geometry *g1, const Geometry *g2, double *dist)
 {
@@ -371,6 +377,13 @@ GEOSIntersection(const Geometry *g1, const Geometry *g2)
     return GEOSIntersection_r( handle, g1, g2 );
 }
 
+Geometry *
+GEOSClipByRect(const Geometry *g, double xmin, double ymin,
+               double xmax, double ymax)
+{
+    return GEOSClipByRect_r( handle, g, xmin, ymin, xmax, ymax );
+}
+
 Geometry *
 GEOSBuffer(const Geometry *g1, double width, int quadrantsegments)
 {
@@ -437,6 +450,18 @@ GEOSUnaryUnion(const Geometry *g1)
     return GEOSUnaryUnion_r( handle, g1);
 }
 
+Geometry *
+GEOSUnaryUnionParallel(const Geometry *g1, unsigned int numThreads)
+{
+    return GEOSUnaryUnionParallel_r( handle, g1, numThreads );
+}
+
+Geometry *
+GEOSCoverageUnion(const Geometry *g, int validate)
+{
+    return GEOSCoverageUnion_r( handle, g, validate );
+}
+
 Geometry *
 GEOSUnionCascaded(const Geometry *g1)
 {
@@ -1059,14 +1084,55 @@ GEOSPreparedWithin(const geos::geom::prep::PreparedGeometry *pg1, const Geometry
     return GEOSPreparedWithin_r( handle, pg1, g2 );
 }
 
-STRtree *
+int
+GEOSPreparedContainsXY_array(const geos::geom::prep::PreparedGeometry *pg1,
+                             const double *x, const double *y, size_t n,
+                             char *result, unsigned int numThreads)
+{
+    return GEOSPreparedContainsXY_array_r( handle, pg1, x, y, n, result,
+                                           numThreads );
+}
+
+int
+GEOSPreparedDistance(const geos::geom::prep::PreparedGeometry *pg1,
+                     const Geometry *g2, double *dist)
+{
+    return GEOSPreparedDistance_r( handle, pg1, g2, dist );
+}
+
+char
+GEOSPreparedDistanceWithin(const geos::geom::prep::PreparedGeometry *pg1,
+                           const Geometry *g2, double dist)
+{
+    return GEOSPreparedDistanceWithin_r( handle, pg1, g2, dist );
+}
+
+int
+GEOSPreparedCache_setLimits(unsigned int maxEntries, unsigned int maxPoints)
+{
+    return GEOSPreparedCache_setLimits_r( handle, maxEntries, maxPoints );
+}
+
+int
+GEOSPreparedCache_getStats(size_t* hits, size_t* misses, size_t* entries)
+{
+    return GEOSPreparedCache_getStats_r( handle, hits, misses, entries );
+}
+
+void
+GEOSPreparedCache_invalidate(const Geometry *g)
+{
+    GEOSPreparedCache_invalidate_r( handle, g );
+}
+
+PackedSTRtree *
 GEOSSTRtree_create (size_t nodeCapacity)
 {
     return GEOSSTRtree_create_r( handle, nodeCapacity );
 }
 
 void
-GEOSSTRtree_insert (geos::index::strtree::STRtree *tree,
+GEOSSTRtree_insert (geos::index::strtree::PackedSTRtree *tree,
                     const geos::geom::Geometry *g,
                     void *item)
 {
@@ -1074,7 +1140,7 @@ GEOSSTRtree_insert (geos::index::strtree::STRtree *tree,
 }
 
 void
-GEOSSTRtree_query (geos::index::strtree::STRtree *tree,
+GEOSSTRtree_query (geos::index::strtree::PackedSTRtree *tree,
                    const geos::geom::Geometry *g, 
                    GEOSQueryCallback cb,
                    void *userdata)
@@ -1082,8 +1148,20 @@ GEOSSTRtree_query (geos::index::strtree::STRtree *tree,
     GEOSSTRtree_query_r( handle, tree, g, cb, userdata );
 }
 
+int
+GEOSSTRtree_queryBatch (geos::index::strtree::PackedSTRtree *tree,
+                        const geos::geom::Geometry *const *geoms,
+                        unsigned int ngeoms,
+                        unsigned int numThreads,
+                        size_t **offsets,
+                        void ***items)
+{
+    return GEOSSTRtree_queryBatch_r( handle, tree, geoms, ngeoms,
+                                     numThreads, offsets, items );
+}
+
 void 
-GEOSSTRtree_iterate(geos::index::strtree::STRtree *tree,
+GEOSSTRtree_iterate(geos::index::strtree::PackedSTRtree *tree,
                     GEOSQueryCallback callback,
                     void *userdata)
 {
@@ -1091,15 +1169,41 @@ GEOSSTRtree_iterate(geos::index::strtree::STRtree *tree,
 }
 
 char
-GEOSSTRtree_remove (geos::index::strtree::STRtree *tree,
+GEOSSTRtree_remove (geos::index::strtree::PackedSTRtree *tree,
                     const geos::geom::Geometry *g,
                     void *item)
 {
     return GEOSSTRtree_remove_r( handle, tree, g, item );
 }
 
+const void *
+GEOSSTRtree_nearest (geos::index::strtree::PackedSTRtree *tree,
+                     const void *item,
+                     const geos::geom::Geometry *itemEnvelope,
+                     GEOSDistanceCallback distancefn,
+                     void *userdata)
+{
+    return GEOSSTRtree_nearest_r( handle, tree, item, itemEnvelope,
+                                  distancefn, userdata );
+}
+
+int
+GEOSSTRtree_nearestK (geos::index::strtree::PackedSTRtree *tree,
+                      const void *item,
+                      const geos::geom::Geometry *itemEnvelope,
+                      GEOSDistanceCallback distancefn,
+                      void *userdata,
+                      unsigned int k,
+                      double maxDistance,
+                      const void **results)
+{
+    return GEOSSTRtree_nearestK_r( handle, tree, item, itemEnvelope,
+                                   distancefn, userdata, k, maxDistance,
+                                   results );
+}
+
 void
-GEOSSTRtree_destroy (geos::index::strtree::STRtree *tree)
+GEOSSTRtree_destroy (geos::index::strtree::PackedSTRtree *tree)
 {
     GEOSSTRtree_destroy_r( handle, tree );
 }
@@ -1223,6 +1327,12 @@ GEOSBufferParams_setSingleSided(GEOSBufferParams* p, int singleSided)
   return GEOSBufferParams_setSingleSided_r(handle, p, singleSided);
 }
 
+int
+GEOSBufferParams_setNumThreads(GEOSBufferParams* p, unsigned int numThreads)
+{
+  return GEOSBufferParams_setNumThreads_r(handle, p, numThreads);
+}
+
 Geometry*
 GEOSBufferWithParams(const Geometry* g, const GEOSBufferParams* p, double w)
 {
@@ -21,6 +21,8 @@
 #include <geos/geom/Geometry.h> 
 #include <geos/geom/prep/PreparedGeometry.h> 
 #include <geos/geom/prep/PreparedGeometryFactory.h> 
+#include <geos/geom/prep/PreparedGeometryCache.h> 
+#include <geos/geom/prep/PreparedPolygon.h> 
 #include <geos/geom/GeometryCollection.h> 
 #include <geos/geom/Polygon.h> 
 #include <geos/geom/Point.h> 
@@ -34,8 +36,11 @@
 #include <geos/geom/CoordinateSequenceFactory.h> 
 #include <geos/geom/Coordinate.h> 
 #include <geos/geom/IntersectionMatrix.h> 
+#include <geos/geom/Location.h> 
 #include <geos/geom/Envelope.h> 
-#include <geos/index/strtree/STRtree.h> 
+#include <geos/index/strtree/PackedSTRtree.h> 
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/index/strtree/GeometryItemDistance.h>
 #include <geos/index/ItemVisitor.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKBReader.h>
@@ -51,10 +56,14 @@
 #include <geos/operation/linemerge/LineMerger.h>
 #include <geos/operation/overlay/OverlayOp.h>
 #include <geos/operation/union/CascadedPolygonUnion.h>
+#include <geos/operation/union/CoverageUnion.h>
+#include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/operation/buffer/BufferOp.h>
 #include <geos/operation/buffer/BufferParameters.h>
 #include <geos/operation/buffer/BufferBuilder.h>
 #include <geos/operation/relate/RelateOp.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
 #include <geos/operation/sharedpaths/SharedPathsOp.h>
 #include <geos/linearref/LengthIndexedLine.h>
 #include <geos/geom/BinaryOp.h>
@@ -74,6 +83,9 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <new> // for bad_alloc
+#include <vector>
+#include <algorithm>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4099)
@@ -85,7 +97,7 @@
 #define GEOSPreparedGeometry geos::geom::prep::PreparedGeometry
 #define GEOSCoordSequence geos::geom::CoordinateSequence
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
-#define GEOSSTRtree geos::index::strtree::STRtree
+#define GEOSSTRtree geos::index::strtree::PackedSTRtree
 #define GEOSWKTReader_t geos::io::WKTReader
 #define GEOSWKTWriter_t geos::io::WKTWriter
 #define GEOSWKBReader_t geos::io::WKBReader
@@ -123,6 +135,7 @@ using geos::operation::overlay::overlayOp;
 using geos::operation::geounion::CascadedPolygonUnion;
 using geos::operation::buffer::BufferParameters;
 using geos::operation::buffer::BufferBuilder;
+using geos::operation::distance::DistanceOp;
 using geos::util::IllegalArgumentException;
 using geos::algorithm::distance::DiscreteHausdorffDistance;
 
@@ -136,6 +149,7 @@ typedef struct GEOSContextHandleInternal
     int WKBOutputDims;
     int WKBByteOrder;
     int initialized;
+    geos::geom::prep::PreparedGeometryCache *preparedCache;
 } GEOSContextHandleInternal_t;
 
 // CAPI_ItemVisitor is used internally by the CAPI STRtree
@@ -150,6 +164,25 @@ class CAPI_ItemVisitor : public geos::index::ItemVisitor {
     void visitItem (void *item) { callback(item, userdata); };
 };
 
+// CAPI_ItemDistance adapts a GEOSDistanceCallback for the
+// STRtree nearest neighbour search.
+class CAPI_ItemDistance : public geos::index::strtree::ItemDistance {
+    GEOSDistanceCallback distancefn;
+    void *userdata;
+  public:
+    CAPI_ItemDistance (GEOSDistanceCallback fn, void *ud)
+        : ItemDistance(), distancefn(fn), userdata(ud) {};
+    double distance (const void *item1, const void *item2)
+    {
+        double d;
+        if ( ! distancefn(item1, item2, &d, userdata) )
+        {
+            throw std::runtime_error("Failed to compute distance.");
+        }
+        return d;
+    };
+};
+
 
 //## PROTOTYPES #############################################
 
@@ -183,6 +216,15 @@ char* gstrdup(std::string const& str)
     return gstrdup_s(str.c_str(), str.size());
 }
 
+// The prepared form of g from the context cache, if enabled and
+// worth it, NULL otherwise
+const geos::geom::prep::PreparedGeometry*
+cachedPrepared(GEOSContextHandleInternal_t *handle, const Geometry *g)
+{
+    if ( 0 == handle->preparedCache ) return 0;
+    return handle->preparedCache->get(*g);
+}
+
 } // namespace anonymous
 
 extern "C" {
@@ -202,6 +244,7 @@ initGEOS_r(GEOSMessageHandler nf, GEOSMessageHandler ef)
         handle->geomFactory = GeometryFactory::getDefaultInstance();
         handle->WKBOutputDims = 2;
         handle->WKBByteOrder = getMachineByteOrder();
+        handle->preparedCache = 0;
         handle->initialized = 1;
     }
 
@@ -245,6 +288,13 @@ GEOSContext_setErrorHandler_r(GEOSContextHandle_t extHandle, GEOSMessageHandler
 void
 finishGEOS_r(GEOSContextHandle_t extHandle)
 {
+    if ( 0 != extHandle )
+    {
+        GEOSContextHandleInternal_t *handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        delete handle->preparedCache;
+    }
+
     // Fix up freeing handle w.r.t. malloc above
     std::free(extHandle);
     extHandle = NULL;
@@ -280,7 +330,8 @@ GEOSDisjoint_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry
 
     try
     {
-        bool result = g1->disjoint(g2);
+        const geos::geom::prep::PreparedGeometry *prep = cachedPrepared(handle, g1);
+        bool result = prep ? prep->disjoint(g2) : g1->disjoint(g2);
         return result;
     }
 
@@ -348,7 +399,8 @@ GEOSIntersects_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geomet
 
     try
     {
-        bool result = g1->intersects(g2);
+        const geos::geom::prep::PreparedGeometry *prep = cachedPrepared(handle, g1);
+        bool result = prep ? prep->intersects(g2) : g1->intersects(g2);
         return result;
     }
     catch (const std::exception &e)
@@ -448,7 +500,8 @@ GEOSContains_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry
 
     try
     {
-        bool result = g1->contains(g2);
+        const geos::geom::prep::PreparedGeometry *prep = cachedPrepared(handle, g1);
+        bool result = prep ? prep->contains(g2) : g1->contains(g2);
         return result;
     }
     catch (const std::exception &e)
@@ -512,7 +565,8 @@ GEOSCovers_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry *
 
     try
     {
-        bool result = g1->covers(g2);
+        const geos::geom::prep::PreparedGeometry *prep = cachedPrepared(handle, g1);
+        bool result = prep ? prep->covers(g2) : g1->covers(g2);
         return result;
     }
     catch (const std::exception &e)
@@ -1008,6 +1062,38 @@ GEOSDistance_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry
     return 0;
 }
 
+char
+GEOSDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry *g2, double dist)
+{
+    if ( 0 == extHandle )
+    {
+        return 2;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 2;
+    }
+
+    try
+    {
+        bool result = DistanceOp::isWithinDistance(*g1, *g2, dist);
+        return result;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+    
+    return 2;
+}
+
 int
 GEOSHausdorffDistance_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geometry *g2, double *dist)
 {
@@ -1278,12 +1364,8 @@ GEOSGeomFromWKB_buf_r(GEOSContextHandle_t extHandle, const unsigned char *wkb, s
     using geos::io::WKBReader;
     try
     {
-        std::string wkbstring(reinterpret_cast<const char*>(wkb), size); // make it binary !
         WKBReader r(*(static_cast<GeometryFactory const*>(handle->geomFactory)));
-        std::istringstream is(std::ios_base::binary);
-        is.str(wkbstring);
-        is.seekg(0, std::ios::beg); // rewind reader pointer
-        Geometry *g = r.read(is);
+        Geometry *g = r.read(wkb, size);
         return g;
     }
     catch (const std::exception &e)
@@ -1624,6 +1706,41 @@ GEOSIntersection_r(GEOSContextHandle_t extHandle, const Geometry *g1, const Geom
     return NULL;
 }
 
+Geometry *
+GEOSClipByRect_r(GEOSContextHandle_t extHandle, const Geometry *g,
+                 double xmin, double ymin, double xmax, double ymax)
+{
+    if ( 0 == extHandle )
+    {
+        return NULL;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return NULL;
+    }
+
+    try
+    {
+        using geos::operation::intersection::RectangleIntersection;
+        geos::geom::Envelope rect(xmin, xmax, ymin, ymax);
+        GeomAutoPtr g3 = RectangleIntersection::clip(*g, rect);
+        return g3.release();
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+    
+    return NULL;
+}
+
 Geometry *
 GEOSBuffer_r(GEOSContextHandle_t extHandle, const Geometry *g1, double width, int quadrantsegments)
 {
@@ -2018,6 +2135,74 @@ GEOSUnaryUnion_r(GEOSContextHandle_t extHandle, const Geometry *g)
     return NULL;
 }
 
+Geometry *
+GEOSUnaryUnionParallel_r(GEOSContextHandle_t extHandle, const Geometry *g,
+                         unsigned int numThreads)
+{
+    if ( 0 == extHandle )
+    {
+        return NULL;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return NULL;
+    }
+
+    try
+    {
+        using geos::operation::geounion::UnaryUnionOp;
+        GeomAutoPtr g3 ( UnaryUnionOp::Union(*g, numThreads) );
+        return g3.release();
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+    
+    return NULL;
+}
+
+Geometry *
+GEOSCoverageUnion_r(GEOSContextHandle_t extHandle, const Geometry *g,
+                    int validate)
+{
+    if ( 0 == extHandle )
+    {
+        return NULL;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return NULL;
+    }
+
+    try
+    {
+        using geos::operation::geounion::CoverageUnion;
+        GeomAutoPtr g3 ( CoverageUnion::Union(*g, validate != 0) );
+        return g3.release();
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return NULL;
+}
+
 Geometry *
 GEOSUnionCascaded_r(GEOSContextHandle_t extHandle, const Geometry *g1)
 {
@@ -2110,6 +2295,14 @@ GEOSGeom_destroy_r(GEOSContextHandle_t extHandle, Geometry *a)
 
     try
     {
+        if ( 0 != extHandle )
+        {
+            handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if ( 0 != handle->initialized && 0 != handle->preparedCache )
+            {
+                handle->preparedCache->invalidate(a);
+            }
+        }
         delete a;
     }
     catch (const std::exception &e)
@@ -2221,6 +2414,10 @@ GEOSNormalize_r(GEOSContextHandle_t extHandle, Geometry *g)
 
     try
     {
+        if ( 0 != handle->preparedCache )
+        {
+            handle->preparedCache->invalidate(g);
+        }
         g->normalize();
         return 0; // SUCCESS
     }
@@ -3279,7 +3476,7 @@ GEOSHasZ_r(GEOSContextHandle_t extHandle, const Geometry *g)
     }
     assert(0 != g->getCoordinate());
 
-    double az = g->getCoordinate()->z;
+    double az = g->getCoordinate()->getZ();
     //handle->ERROR_MESSAGE("ZCoord: %g", az);
 
     return static_cast<char>(FINITE(az));
@@ -5383,11 +5580,243 @@ GEOSPreparedWithin_r(GEOSContextHandle_t extHandle,
     return 2;
 }
 
+int
+GEOSPreparedContainsXY_array_r(GEOSContextHandle_t extHandle,
+        const geos::geom::prep::PreparedGeometry *pg,
+        const double *x, const double *y, size_t n, char *result,
+        unsigned int numThreads)
+{
+    assert(0 != pg);
+
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    try
+    {
+        using geos::geom::prep::PreparedPolygon;
+        const PreparedPolygon *ppoly = dynamic_cast<const PreparedPolygon*>(pg);
+        if ( ppoly )
+        {
+            std::vector<int> locations(n);
+            if ( n ) ppoly->locate(x, y, n, &locations[0], numThreads);
+            for (size_t i = 0; i < n; ++i)
+            {
+                result[i] = locations[i] == geos::geom::Location::INTERIOR;
+            }
+        }
+        else
+        {
+            const GeometryFactory *gf = handle->geomFactory;
+            for (size_t i = 0; i < n; ++i)
+            {
+                GeomAutoPtr pt(gf->createPoint(
+                    geos::geom::Coordinate(x[i], y[i])));
+                result[i] = pg->contains(pt.get());
+            }
+        }
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
+int
+GEOSPreparedDistance_r(GEOSContextHandle_t extHandle,
+        const geos::geom::prep::PreparedGeometry *pg,
+        const Geometry *g, double *dist)
+{
+    assert(0 != pg);
+    assert(0 != g);
+    assert(0 != dist);
+
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    try
+    {
+        *dist = pg->distance(g);
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
+char
+GEOSPreparedDistanceWithin_r(GEOSContextHandle_t extHandle,
+        const geos::geom::prep::PreparedGeometry *pg,
+        const Geometry *g, double dist)
+{
+    assert(0 != pg);
+    assert(0 != g);
+
+    if ( 0 == extHandle )
+    {
+        return 2;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 2;
+    }
+
+    try 
+    {
+        bool result = pg->isWithinDistance(g, dist);
+        return result;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+    
+    return 2;
+}
+
+//-----------------------------------------------------------------
+// Prepared Geometry cache
+//-----------------------------------------------------------------
+
+int
+GEOSPreparedCache_setLimits_r(GEOSContextHandle_t extHandle,
+                              unsigned int maxEntries, unsigned int maxPoints)
+{
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    try
+    {
+        if ( 0 == maxEntries )
+        {
+            delete handle->preparedCache;
+            handle->preparedCache = 0;
+        }
+        else if ( 0 == handle->preparedCache )
+        {
+            handle->preparedCache = new geos::geom::prep::PreparedGeometryCache(
+                maxEntries, maxPoints);
+        }
+        else
+        {
+            handle->preparedCache->setLimits(maxEntries, maxPoints);
+        }
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
+int
+GEOSPreparedCache_getStats_r(GEOSContextHandle_t extHandle,
+                             size_t *hits, size_t *misses, size_t *entries)
+{
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    const geos::geom::prep::PreparedGeometryCache *cache =
+        handle->preparedCache;
+    if ( hits ) *hits = cache ? cache->getHits() : 0;
+    if ( misses ) *misses = cache ? cache->getMisses() : 0;
+    if ( entries ) *entries = cache ? cache->size() : 0;
+    return 1;
+}
+
+void
+GEOSPreparedCache_invalidate_r(GEOSContextHandle_t extHandle,
+                               const Geometry *g)
+{
+    if ( 0 == extHandle )
+    {
+        return;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized || 0 == handle->preparedCache )
+    {
+        return;
+    }
+
+    if ( g )
+    {
+        handle->preparedCache->invalidate(g);
+    }
+    else
+    {
+        handle->preparedCache->clear();
+    }
+}
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
 
-geos::index::strtree::STRtree *
+geos::index::strtree::PackedSTRtree *
 GEOSSTRtree_create_r(GEOSContextHandle_t extHandle,
                                   size_t nodeCapacity)
 {
@@ -5403,11 +5832,11 @@ GEOSSTRtree_create_r(GEOSContextHandle_t extHandle,
         return 0;
     }
 
-    geos::index::strtree::STRtree *tree = 0;
+    geos::index::strtree::PackedSTRtree *tree = 0;
 
     try
     {
-        tree = new geos::index::strtree::STRtree(nodeCapacity);
+        tree = new geos::index::strtree::PackedSTRtree(nodeCapacity);
     }
     catch (const std::exception &e)
     {
@@ -5423,7 +5852,7 @@ GEOSSTRtree_create_r(GEOSContextHandle_t extHandle,
 
 void
 GEOSSTRtree_insert_r(GEOSContextHandle_t extHandle,
-                     geos::index::strtree::STRtree *tree,
+                     geos::index::strtree::PackedSTRtree *tree,
                      const geos::geom::Geometry *g,
                      void *item)
 {
@@ -5469,7 +5898,7 @@ GEOSSTRtree_insert_r(GEOSContextHandle_t extHandle,
 
 void 
 GEOSSTRtree_query_r(GEOSContextHandle_t extHandle,
-                    geos::index::strtree::STRtree *tree,
+                    geos::index::strtree::PackedSTRtree *tree,
                     const geos::geom::Geometry *g,
                     GEOSQueryCallback callback,
                     void *userdata)
@@ -5516,9 +5945,78 @@ GEOSSTRtree_query_r(GEOSContextHandle_t extHandle,
     }
 }
 
+int
+GEOSSTRtree_queryBatch_r(GEOSContextHandle_t extHandle,
+                         geos::index::strtree::PackedSTRtree *tree,
+                         const geos::geom::Geometry *const *geoms,
+                         unsigned int ngeoms,
+                         unsigned int numThreads,
+                         size_t **offsets,
+                         void ***items)
+{
+    assert(0 != tree);
+    assert(0 != geoms || 0 == ngeoms);
+    assert(0 != offsets);
+    assert(0 != items);
+
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    try
+    {
+        std::vector<geos::geom::Envelope> envs;
+        envs.reserve(ngeoms);
+        for (unsigned int i=0; i<ngeoms; ++i)
+        {
+            envs.push_back(*geoms[i]->getEnvelopeInternal());
+        }
+
+        std::vector<std::size_t> off;
+        std::vector<void*> found;
+        tree->queryBatch(envs, off, found, numThreads);
+
+        size_t *offArray = static_cast<size_t*>(
+                std::malloc(off.size() * sizeof(size_t)));
+        // malloc(0) may legitimately return NULL
+        void **itemArray = static_cast<void**>(
+                std::malloc((found.size() ? found.size() : 1) * sizeof(void*)));
+        if ( 0 == offArray || 0 == itemArray )
+        {
+            std::free(offArray);
+            std::free(itemArray);
+            throw std::bad_alloc();
+        }
+        std::copy(off.begin(), off.end(), offArray);
+        std::copy(found.begin(), found.end(), itemArray);
+
+        *offsets = offArray;
+        *items = itemArray;
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
 void 
 GEOSSTRtree_iterate_r(GEOSContextHandle_t extHandle,
-                    geos::index::strtree::STRtree *tree,
+                    geos::index::strtree::PackedSTRtree *tree,
                     GEOSQueryCallback callback,
                     void *userdata)
 {
@@ -5565,7 +6063,7 @@ GEOSSTRtree_iterate_r(GEOSContextHandle_t extHandle,
 
 char
 GEOSSTRtree_remove_r(GEOSContextHandle_t extHandle,
-                     geos::index::strtree::STRtree *tree,
+                     geos::index::strtree::PackedSTRtree *tree,
                      const geos::geom::Geometry *g,
                      void *item)
 {
@@ -5601,9 +6099,96 @@ GEOSSTRtree_remove_r(GEOSContextHandle_t extHandle,
     return 2;
 }
 
+const void *
+GEOSSTRtree_nearest_r(GEOSContextHandle_t extHandle,
+                      geos::index::strtree::PackedSTRtree *tree,
+                      const void *item,
+                      const geos::geom::Geometry *itemEnvelope,
+                      GEOSDistanceCallback distancefn,
+                      void *userdata)
+{
+    const void *results[1];
+    int found = GEOSSTRtree_nearestK_r(extHandle, tree, item, itemEnvelope,
+                                       distancefn, userdata, 1, -1.0,
+                                       results);
+    if ( found < 1 )
+    {
+        return NULL;
+    }
+    return results[0];
+}
+
+int
+GEOSSTRtree_nearestK_r(GEOSContextHandle_t extHandle,
+                       geos::index::strtree::PackedSTRtree *tree,
+                       const void *item,
+                       const geos::geom::Geometry *itemEnvelope,
+                       GEOSDistanceCallback distancefn,
+                       void *userdata,
+                       unsigned int k,
+                       double maxDistance,
+                       const void **results)
+{
+    assert(0 != tree);
+    assert(0 != itemEnvelope);
+    assert(0 != results || 0 == k);
+
+    if ( 0 == extHandle )
+    {
+        return -1;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return -1;
+    }
+
+    try
+    {
+        if ( maxDistance < 0 )
+        {
+            maxDistance = DoubleInfinity;
+        }
+
+        std::vector<void*> nearest;
+        if ( distancefn )
+        {
+            CAPI_ItemDistance itemDist(distancefn, userdata);
+            tree->nearestNeighbours(itemEnvelope->getEnvelopeInternal(),
+                                    item, itemDist, k, nearest,
+                                    maxDistance);
+        }
+        else
+        {
+            geos::index::strtree::GeometryItemDistance itemDist;
+            tree->nearestNeighbours(itemEnvelope->getEnvelopeInternal(),
+                                    item, itemDist, k, nearest,
+                                    maxDistance);
+        }
+
+        for (std::size_t i=0, n=nearest.size(); i<n; ++i)
+        {
+            results[i] = nearest[i];
+        }
+        return static_cast<int>(nearest.size());
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return -1;
+}
+
 void
 GEOSSTRtree_destroy_r(GEOSContextHandle_t extHandle,
-                      geos::index::strtree::STRtree *tree)
+                      geos::index::strtree::PackedSTRtree *tree)
 {
     GEOSContextHandleInternal_t *handle = 0;
 
@@ -6079,6 +6664,33 @@ GEOSBufferParams_setSingleSided_r(GEOSContextHandle_t extHandle,
     return 0;
 }
 
+int
+GEOSBufferParams_setNumThreads_r(GEOSContextHandle_t extHandle,
+  GEOSBufferParams* p, unsigned int numThreads)
+{
+    if ( 0 == extHandle ) return 0;
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized ) return 0;
+
+    try
+    {
+        p->setNumThreads(numThreads);
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
 Geometry *
 GEOSBufferWithParams_r(GEOSContextHandle_t extHandle, const Geometry *g1, const BufferParameters* bp, double width)
 {
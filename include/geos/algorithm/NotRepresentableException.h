@@ -38,6 +38,11 @@ public:
 	NotRepresentableException();
 	NotRepresentableException(std::string msg);
 	~NotRepresentableException() throw() {}
+
+	// See GEOSException
+	NotRepresentableException* clone() const { return new NotRepresentableException(*this); }
+
+	void raise() const { throw *this; }
 };
 
 } // namespace geos::algorithm
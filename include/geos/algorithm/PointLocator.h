@@ -31,6 +31,7 @@ namespace geos {
 		class Geometry;
 		class LinearRing;
 		class LineString;
+		class Point;
 		class Polygon;
 	}
 }
@@ -94,6 +95,8 @@ private:
 
 	void updateLocationInfo(int loc);
 
+	int locate(const geom::Coordinate& p, const geom::Point *pt);
+
 	int locate(const geom::Coordinate& p, const geom::LineString *l);
 
 	int locateInPolygonRing(const geom::Coordinate& p, const geom::LinearRing *ring);
@@ -24,6 +24,7 @@
 #include <geos/export.h>
 
 #include <vector>
+#include <cstddef> // for size_t
 
 // forward declarations
 namespace geos {
@@ -94,6 +95,24 @@ public:
 	static int locatePointInRing(const geom::Coordinate& p,
 	         const std::vector<const geom::Coordinate*>& ring);
 
+	/**
+	 * Determines the {@link Location} of a point from segments given
+	 * as ordinate arrays (segment i goes from x0[i],y0[i] to x1[i],y1[i]).
+	 *
+	 * As for countSegment, all the segments which may cross the ray
+	 * must be given, in any order.
+	 *
+	 * The segments are evaluated in a branch-free loop using a
+	 * floating-point filter for the orientation test, which compilers
+	 * can vectorize. Points found on (or too close to) a segment are
+	 * evaluated again with countSegment, so results are the same.
+	 *
+	 * @return the location of p with respect to the segments
+	 */
+	static int locatePointInSegments(const geom::Coordinate& p,
+	         const double* x0, const double* y0,
+	         const double* x1, const double* y1, std::size_t n);
+
 	RayCrossingCounter(const geom::Coordinate& point)
 	:	point( point),
 		crossingCount( 0),
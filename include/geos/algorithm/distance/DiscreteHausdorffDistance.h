@@ -40,6 +40,9 @@
 namespace geos {
 	namespace algorithm {
 		//class RayCrossingCounter;
+		namespace distance {
+			class IndexedDistanceToPoint;
+		}
 	}
 	namespace geom {
 		class Geometry;
@@ -97,6 +100,12 @@ namespace distance { // geos::algorithm::distance
  *   DHD(A, B) = 22.360679774997898
  *   HD(A, B) ~= 47.8
  * </pre>
+ *
+ * The distance from each sample point to the other geometry is found
+ * through an index of its facets (see IndexedDistanceToPoint), and
+ * only computed exactly for the points which may be further than
+ * the maximum found so far. The sample points may be evaluated by
+ * several threads, see setNumThreads.
  */
 class GEOS_DLL DiscreteHausdorffDistance
 {
@@ -108,13 +117,26 @@ public:
 	static double distance(const geom::Geometry& g0,
 	                       const geom::Geometry& g1, double densifyFrac);
 
+	/**
+	 * Tests whether the discrete Hausdorff distance of two geometries
+	 * is no more than maxDistance, see the isWithinDistance member.
+	 */
+	static bool isWithinDistance(const geom::Geometry& g0,
+	                             const geom::Geometry& g1,
+	                             double maxDistance);
+
+	static bool isWithinDistance(const geom::Geometry& g0,
+	                             const geom::Geometry& g1,
+	                             double maxDistance, double densifyFrac);
+
 	DiscreteHausdorffDistance(const geom::Geometry& g0,
 	                          const geom::Geometry& g1)
 		:
 		g0(g0),
 		g1(g1),
 		ptDist(),
-		densifyFrac(0.0)
+		densifyFrac(0.0),
+		numThreads(1)
 	{}
 
 	/**
@@ -136,6 +158,32 @@ public:
 		densifyFrac = dFrac;
 	}
 
+	/**
+	 * Sets the number of threads computing the distances of the
+	 * sample points, including the calling one.
+	 * The default is 1, 0 means one per available processor.
+	 * The result does not depend on the number of threads.
+	 *
+	 * @param n the number of threads
+	 */
+	void setNumThreads(unsigned int n)
+	{
+		numThreads = n;
+	}
+
+	/**
+	 * Tests whether the discrete Hausdorff distance is no more than
+	 * maxDistance.
+	 *
+	 * Only checks that every sample point has a point of the other
+	 * geometry within maxDistance, and stops at the first one which
+	 * does not: getCoordinates is not set.
+	 *
+	 * @param maxDistance the distance to test
+	 * @return true if distance() <= maxDistance
+	 */
+	bool isWithinDistance(double maxDistance);
+
 	double distance()
 	{
 		compute(g0, g1);
@@ -222,6 +270,8 @@ public:
 
 private:
 
+	class SampleTask;
+
 	void compute(const geom::Geometry& g0,
 	             const geom::Geometry& g1)
 	{
@@ -233,6 +283,18 @@ private:
 	                             const geom::Geometry& geom,
 	                             PointPairDistance& ptDist);
 
+	/**
+	 * Computes the oriented distance, unless a sample point of
+	 * discreteGeom is found further than maxDistance from geom.
+	 *
+	 * @return false if a sample point is further than maxDistance,
+	 *         ptDist is then left untouched
+	 */
+	bool computeOrientedDistance(const geom::Geometry& discreteGeom,
+	                             const geom::Geometry& geom,
+	                             PointPairDistance& ptDist,
+	                             double maxDistance);
+
 	const geom::Geometry& g0;
 
 	const geom::Geometry& g1;
@@ -242,6 +304,8 @@ private:
 	/// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+	unsigned int numThreads; // = 1;
+
     // Declare type as noncopyable
     DiscreteHausdorffDistance(const DiscreteHausdorffDistance& other);
     DiscreteHausdorffDistance& operator=(const DiscreteHausdorffDistance& rhs);
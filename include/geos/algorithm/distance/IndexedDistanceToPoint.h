@@ -0,0 +1,108 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_ALGORITHM_DISTANCE_INDEXEDDISTANCETOPOINT_H
+#define GEOS_ALGORITHM_DISTANCE_INDEXEDDISTANCETOPOINT_H
+
+#include <geos/export.h>
+#include <geos/geom/LineSegment.h> // for composition
+#include <geos/index/strtree/PackedSTRtree.h> // for composition
+
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+	namespace algorithm {
+		namespace distance {
+			class PointPairDistance;
+		}
+	}
+	namespace geom {
+		class Geometry;
+		class Coordinate; 
+	}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace distance { // geos::algorithm::distance
+
+/**
+ * Computes the Euclidean distance from many points to a Geometry,
+ * as DistanceToPoint does, using an index of its facets.
+ *
+ * The segments of the lines and polygon rings of the geometry, and
+ * its points, are kept in a PackedSTRtree: the nearest facet to a
+ * point is found by a best-first search, instead of comparing all of
+ * them.
+ *
+ * The facets are copied, and the index is built on construction and
+ * only read afterwards: an IndexedDistanceToPoint may be used by
+ * several threads at once.
+ */
+class GEOS_DLL IndexedDistanceToPoint
+{
+public:
+
+	IndexedDistanceToPoint(const geom::Geometry& geom);
+
+	~IndexedDistanceToPoint();
+
+	/**
+	 * Updates ptDist with the nearest point of the geometry to pt,
+	 * if nearer, as DistanceToPoint::computeDistance.
+	 */
+	void computeDistance(const geom::Coordinate& pt,
+	                     PointPairDistance& ptDist) const;
+
+	/**
+	 * Tests whether pt is within maxDistance of the geometry,
+	 * only searching the facets within that distance.
+	 *
+	 * @return false if the geometry is empty
+	 */
+	bool isWithinDistance(const geom::Coordinate& pt,
+	                      double maxDistance) const;
+
+	/// True if the geometry has no facets
+	bool isEmpty() const { return facets.empty(); }
+
+private:
+
+	/// Points are kept as zero-length segments
+	std::vector<geom::LineSegment> facets;
+
+	/// Built on construction, not modified afterwards
+	mutable index::strtree::PackedSTRtree tree;
+
+	const geom::LineSegment* nearestFacet(const geom::Coordinate& pt,
+	                                      double maxDistance) const;
+
+	// Declare type as noncopyable
+	IndexedDistanceToPoint(const IndexedDistanceToPoint& other);
+	IndexedDistanceToPoint& operator=(const IndexedDistanceToPoint& rhs);
+};
+
+} // geos::algorithm::distance
+} // geos::algorithm
+} // geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_ALGORITHM_DISTANCE_INDEXEDDISTANCETOPOINT_H
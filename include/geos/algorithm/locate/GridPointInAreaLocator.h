@@ -0,0 +1,150 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ *
+ **********************************************************************/
+
+#ifndef GEOS_ALGORITHM_LOCATE_GRIDPOINTINAREALOCATOR_H
+#define GEOS_ALGORITHM_LOCATE_GRIDPOINTINAREALOCATOR_H
+
+#include <geos/export.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h> // inherited
+#include <geos/geom/Coordinate.h> // for composition
+
+#include <vector> // composition
+#include <cstddef> // for size_t
+
+namespace geos {
+	namespace geom {
+		class Geometry;
+	}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace locate { // geos::algorithm::locate
+
+/** \brief
+ * Determines the location of {@link Coordinate}s relative to
+ * a {@link Polygon} or {@link MultiPolygon} geometry, using a
+ * uniform grid over its envelope.
+ *
+ * Each cell of the grid is classified once as lying fully in the
+ * interior, fully in the exterior, or touching the boundary of the
+ * geometry. Points falling in an interior or exterior cell are
+ * located in constant time. Points in a boundary cell are located
+ * by counting the crossings of a ray with the segments listed in
+ * that cell and in the boundary cells following it on the same row,
+ * up to the first interior or exterior cell.
+ *
+ * This pays off for large polygons tested against very many points,
+ * most of them away from the boundary.
+ */
+class GEOS_DLL GridPointInAreaLocator : public PointOnGeometryLocator
+{
+public:
+	/**
+	 * Creates a new locator for a given {@link Geometry}
+	 *
+	 * @param g the Geometry to locate in
+	 * @param numCells about how many cells the grid should have,
+	 *        0 to choose from the number of segments of g
+	 */
+	GridPointInAreaLocator( const geom::Geometry & g,
+	                        std::size_t numCells = 0);
+
+	~GridPointInAreaLocator();
+
+	/**
+	 * Determines the {@link Location} of a point in an areal {@link Geometry}.
+	 *
+	 * @param p the point to test
+	 * @return the location of the point in the geometry
+	 */
+	int locate( const geom::Coordinate * /*const*/ p);
+
+	/**
+	 * Determines the {@link Location} of many points.
+	 *
+	 * @param x the X ordinates of the points
+	 * @param y the Y ordinates of the points
+	 * @param n the number of points
+	 * @param locations the n locations are written here
+	 * @param numThreads threads to use, 0 for one per processor
+	 */
+	void locate( const double * x, const double * y, std::size_t n,
+	             int * locations, unsigned int numThreads = 1);
+
+	/// Number of columns of the grid
+	std::size_t getNumColumns() const { return numCols; }
+
+	/// Number of rows of the grid
+	std::size_t getNumRows() const { return numRows; }
+
+	/// Number of cells touching the boundary of the geometry
+	std::size_t getNumBoundaryCells() const;
+
+private:
+	/// A segment listed in a cell
+	struct CellSegment {
+		/// index in vertices of the first segment vertex
+		std::size_t vertex;
+		/// leftmost column of the row listing the segment
+		std::size_t firstCol;
+	};
+
+	/// Locates blocks of points of a batch
+	class BatchTask;
+
+	/// Vertices of all the rings, one after the other
+	std::vector<geom::Coordinate> vertices;
+
+	/// Index in vertices of the first vertex of each segment
+	std::vector<std::size_t> segments;
+
+	double minX, minY, maxX, maxY;
+	double cellWidth, cellHeight;
+	std::size_t numCols, numRows;
+
+	/// Location of each cell, row after row: BOUNDARY for the
+	/// cells touched by a segment
+	std::vector<unsigned char> cells;
+
+	/// Offset in cellSegments of the segments of each cell, and
+	/// the size of cellSegments
+	std::vector<std::size_t> cellStart;
+
+	std::vector<CellSegment> cellSegments;
+
+	void init( const geom::Geometry & g);
+
+	void buildGrid( std::size_t numCells);
+
+	std::size_t column( double x, double tolerance) const;
+
+	std::size_t row( double y, double tolerance) const;
+
+	int locate( const geom::Coordinate & p) const;
+
+	// Declare type as noncopyable
+	GridPointInAreaLocator(const GridPointInAreaLocator& other);
+	GridPointInAreaLocator& operator=(const GridPointInAreaLocator& rhs);
+};
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
+
+#endif // GEOS_ALGORITHM_LOCATE_GRIDPOINTINAREALOCATOR_H
+/**********************************************************************
+ * $Log$
+ **********************************************************************/
+
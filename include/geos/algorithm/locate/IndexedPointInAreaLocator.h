@@ -18,24 +18,14 @@
 #define GEOS_ALGORITHM_LOCATE_INDEXEDPOINTINAREALOCATOR_H
 
 #include <geos/algorithm/locate/PointOnGeometryLocator.h> // inherited
-#include <geos/index/ItemVisitor.h> // inherited
 
 #include <vector> // composition
+#include <cstddef> // for size_t
 
 namespace geos {
-	namespace algorithm {
-		class RayCrossingCounter;
-	}
 	namespace geom {
 		class Geometry;
 		class Coordinate; 
-		class CoordinateSequence; 
-		class LineSegment;
-	}
-	namespace index {
-		namespace intervalrtree {
-			class SortedPackedIntervalRTree;
-		}
 	}
 }
 
@@ -56,42 +46,79 @@ namespace locate { // geos::algorithm::locate
 class IndexedPointInAreaLocator : public PointOnGeometryLocator 
 {
 private:
+	/**
+	 * Indexes the segments of the rings by their Y extent.
+	 *
+	 * Segments are kept in a single array, referencing the ring
+	 * vertices of the geometry by index, and sorted by the middle of
+	 * their Y extent. The nodes of the packed interval tree over them
+	 * are kept in a second array, level after level, each node
+	 * covering NODE_CAPACITY consecutive entries of the level below.
+	 */
 	class IntervalIndexedGeometry
 	{
+	public:
+		IntervalIndexedGeometry( const geom::Geometry & g);
+
+		/**
+		 * Calls visitor.visit(x0, y0, x1, y1) for each segment
+		 * whose Y extent intersects [min, max].
+		 */
+		template <class Visitor>
+		void query( double min, double max, Visitor & visitor) const;
+
 	private:
-		index::intervalrtree::SortedPackedIntervalRTree * index;
+		struct Interval {
+			double min;
+			double max;
+		};
 
-		void init( const geom::Geometry & g);
-		void addLine( geom::CoordinateSequence * pts);
+		struct Segment {
+			Interval y;
+			std::size_t ring;
+			/// index of the first vertex in the ring
+			std::size_t vertex;
+		};
 
-		// To keep track of allocated LineSegments
-		std::vector< geom::LineSegment* > allocatedSegments;
+		/// Ordinates of the vertices of a ring
+		struct Ring {
+			const double * x;
+			const double * y;
+			std::size_t stride;
+		};
 
-	public:
-		IntervalIndexedGeometry( const geom::Geometry & g);
-		~IntervalIndexedGeometry();
+		static const std::size_t NODE_CAPACITY = 8;
 
-		void query(double min, double max, index::ItemVisitor * visitor);
-	};
+		std::vector<Ring> rings;
 
+		std::vector<Segment> segments;
 
-	class SegmentVisitor : public index::ItemVisitor
-	{
-	private:
-		algorithm::RayCrossingCounter * counter;
+		std::vector<Interval> nodes;
 
-	public:
-		SegmentVisitor( algorithm::RayCrossingCounter * counter) 
-		:	counter( counter)
-		{ }
-		
-		~SegmentVisitor() 
-		{ }
-
-		void visitItem( void * item);
+		/// Offset in nodes of each level, leaf parents first, and
+		/// the size of nodes
+		std::vector<std::size_t> levels;
+
+		/// Vertices of the rings which can not be referenced in place
+		std::vector<double> ownedOrdinates;
+
+		void init( const geom::Geometry & g);
+
+		void buildTree();
+
+		template <class Visitor>
+		void queryNode( std::size_t level, std::size_t node,
+		                double min, double max, Visitor & visitor) const;
+
+		// Declare type as noncopyable
+		IntervalIndexedGeometry(const IntervalIndexedGeometry& other);
+		IntervalIndexedGeometry& operator=(const IntervalIndexedGeometry& rhs);
 	};
 
 
+	/// Locates blocks of points of a batch
+	class BatchTask;
+
 	const geom::Geometry & areaGeom;
 	IntervalIndexedGeometry * index;
 
@@ -118,6 +145,22 @@ public:
 	 */
 	int locate( const geom::Coordinate * /*const*/ p);
 
+	/**
+	 * Determines the {@link Location} of many points.
+	 *
+	 * Candidate segments are gathered in ordinate arrays and
+	 * evaluated with RayCrossingCounter::locatePointInSegments.
+	 * Points outside the envelope of the geometry are not looked up.
+	 *
+	 * @param x the X ordinates of the points
+	 * @param y the Y ordinates of the points
+	 * @param n the number of points
+	 * @param locations the n locations are written here
+	 * @param numThreads threads to use, 0 for one per processor
+	 */
+	void locate( const double * x, const double * y, std::size_t n,
+	             int * locations, unsigned int numThreads = 1);
+
 };
 
 } // geos::algorithm::locate
@@ -0,0 +1,97 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_ALGORITHM_LOCATE_INDEXEDPOINTONLINELOCATOR_H
+#define GEOS_ALGORITHM_LOCATE_INDEXEDPOINTONLINELOCATOR_H
+
+#include <geos/algorithm/locate/PointOnGeometryLocator.h> // inherited
+#include <geos/geom/Coordinate.h> // for composition
+#include <geos/geom/LineSegment.h> // for composition
+#include <geos/index/strtree/PackedSTRtree.h> // for composition
+
+#include <vector>
+
+namespace geos {
+	namespace geom {
+		class Geometry;
+	}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace locate { // geos::algorithm::locate
+
+/** \brief
+ * Determines the {@link Location} of {@link Coordinate}s relative to
+ * a lineal geometry, using indexing for efficiency.
+ *
+ * The segments of the lines are kept in a PackedSTRtree, so that only
+ * the segments whose envelope contains the point are tested.
+ * The boundary follows the Mod-2 rule used by relate: it is made of
+ * the endpoints of the non-closed lines which are shared by an odd
+ * number of them.
+ *
+ * Points, polygons and empty components of the geometry are ignored.
+ * The locator copies the segments, and is read-only once built: it
+ * may be used by several threads at once.
+ */
+class IndexedPointOnLineLocator : public PointOnGeometryLocator
+{
+public:
+	/**
+	 * Creates a new locator for a given lineal {@link Geometry}
+	 * @param g the Geometry to locate on
+	 */
+	IndexedPointOnLineLocator( const geom::Geometry & g);
+
+	~IndexedPointOnLineLocator();
+
+	/**
+	 * Determines the {@link Location} of a point on the lines.
+	 *
+	 * @param p the point to test
+	 * @return BOUNDARY at a boundary endpoint, INTERIOR elsewhere
+	 *         on the lines, EXTERIOR otherwise
+	 */
+	int locate( const geom::Coordinate * /*const*/ p);
+
+	/// Tests whether the point is in the boundary of the lines
+	bool isBoundary( const geom::Coordinate & p) const;
+
+	/**
+	 * Computes the Mod-2 boundary of the lines of a geometry.
+	 *
+	 * @param g the geometry
+	 * @param boundary set to the boundary points, sorted
+	 */
+	static void computeBoundary( const geom::Geometry & g,
+	                             std::vector<geom::Coordinate> & boundary);
+
+private:
+	std::vector<geom::LineSegment> segments;
+
+	/// Sorted
+	std::vector<geom::Coordinate> boundary;
+
+	index::strtree::PackedSTRtree index;
+
+    // Declare type as noncopyable
+    IndexedPointOnLineLocator(const IndexedPointOnLineLocator& other);
+    IndexedPointOnLineLocator& operator=(const IndexedPointOnLineLocator& rhs);
+};
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
+
+#endif // GEOS_ALGORITHM_LOCATE_INDEXEDPOINTONLINELOCATOR_H
@@ -119,6 +119,8 @@ namespace geom { // geos::geom
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateArraySequenceFactory.h>
+#include <geos/geom/OrdinateArraySequence.h>
+#include <geos/geom/OrdinateArraySequenceFactory.h>
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateSequenceFactory.h>
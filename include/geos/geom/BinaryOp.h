@@ -26,6 +26,10 @@
  * a TopologyException to signal it couldn't succeed due to robustness
  * issues.
  *
+ * Overlay intersections and differences are first restricted to the
+ * parts of the input which can affect the result (see
+ * OverlayClipper), skipping the edges far from the other input.
+ *
  * This function will catch TopologyExceptions and try again with
  * slightly modified versions of the input. The following heuristic
  * is used:
@@ -40,8 +44,8 @@
  *
  * Note that you can skip Grid snapping, Geometry snapping and Simplify policies
  * by a compile-time define when building geos.
- * See USE_TP_SIMPLIFY_POLICY, USE_PRECISION_REDUCTION_POLICY and
- * USE_SNAPPING_POLICY macros below.
+ * See USE_TP_SIMPLIFY_POLICY, USE_PRECISION_REDUCTION_POLICY,
+ * USE_SNAPPING_POLICY and USE_ENVELOPE_CLIP_POLICY macros below.
  *
  *
  **********************************************************************/
@@ -54,6 +58,7 @@
 #include <geos/precision/CommonBitsRemover.h>
 #include <geos/precision/SimpleGeometryPrecisionReducer.h>
 
+#include <geos/operation/overlay/OverlayClipper.h>
 #include <geos/operation/overlay/snap/GeometrySnapper.h>
 
 #include <geos/simplify/TopologyPreservingSimplifier.h>
@@ -126,9 +131,38 @@
 # define USE_SNAPPING_POLICY 1
 #endif
 
+/*
+ * Clip the inputs of overlay intersections and differences
+ * to the envelope of the other input before trying any
+ * of the policies above.
+ */
+#ifndef USE_ENVELOPE_CLIP_POLICY
+# define USE_ENVELOPE_CLIP_POLICY 1
+#endif
+
 namespace geos {
 namespace geom { // geos::geom
 
+/// \brief
+/// Restrict the inputs of a binary operation to the parts which can
+/// affect its result. Binary operations are not restricted by default.
+///
+template <class BinOp>
+inline void
+ClipOperands(const Geometry*, const Geometry*, const BinOp&,
+		operation::overlay::OverlayClipper::GeomPtrPair&)
+{
+}
+
+/// Restrict the inputs of an overlay, see OverlayClipper
+inline void
+ClipOperands(const Geometry* g0, const Geometry* g1,
+		const operation::overlay::overlayOp& op,
+		operation::overlay::OverlayClipper::GeomPtrPair& ret)
+{
+	operation::overlay::OverlayClipper::clip(op.opCode, *g0, *g1, ret);
+}
+
 inline bool
 check_valid(const Geometry& g, const std::string& label)
 {
@@ -240,6 +274,19 @@ BinaryOp(const Geometry* g0, const Geometry *g1, BinOp _Op)
 	GeomPtr ret;
 	geos::util::TopologyException origException;
 
+#if USE_ENVELOPE_CLIP_POLICY
+	// Restrict the input, the policies below then work on the
+	// clipped geometries
+	operation::overlay::OverlayClipper::GeomPtrPair clipped;
+	ClipOperands(g0, g1, _Op, clipped);
+	if ( clipped.first.get() ) g0 = clipped.first.get();
+	if ( clipped.second.get() ) g1 = clipped.second.get();
+#if GEOS_DEBUG_BINARYOP
+	if ( clipped.first.get() || clipped.second.get() )
+		std::cerr << "Clipped input to the envelope of the other" << std::endl;
+#endif
+#endif // USE_ENVELOPE_CLIP_POLICY
+
 #ifdef USE_ORIGINAL_INPUT
 	// Try with original input
 	try
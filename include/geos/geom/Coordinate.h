@@ -54,6 +54,11 @@ struct CoordinateLessThen;
  * Constructed coordinates will have a z-ordinate of DoubleNotANumber.
  * The standard comparison functions will ignore the z-ordinate.
  *
+ * When GEOS is built with GEOS_COORDINATE_2D defined (see platform.h)
+ * the z member does not exist: getZ() always returns DoubleNotANumber
+ * and setZ() does nothing. Code meant to build in both modes should
+ * use those accessors rather than the z member.
+ *
  */
 // Define the following to make assignments and copy constructions 
 // NON-inline (will let profilers report usages)
@@ -83,8 +88,28 @@ public:
 	/// y-coordinate
 	double y;
 
+#ifndef GEOS_COORDINATE_2D
 	/// z-coordinate
 	double z;
+#endif
+
+	/// The z-ordinate, DoubleNotANumber if there is none
+	double getZ() const {
+#ifdef GEOS_COORDINATE_2D
+		return DoubleNotANumber;
+#else
+		return z;
+#endif
+	}
+
+	/// Sets the z-ordinate, ignored in 2D-only builds
+	void setZ(double zNew) {
+#ifdef GEOS_COORDINATE_2D
+		(void)zNew;
+#else
+		z = zNew;
+#endif
+	}
 
 	void setNull();
 
@@ -104,7 +129,7 @@ public:
 	/// TODO: deprecate this, move logic to CoordinateLessThen instead
 	int compareTo(const Coordinate& other) const;
 
-	/// 3D comparison 
+	/// 3D comparison, same as equals2D in 2D-only builds
 	bool equals3D(const Coordinate& other) const;
 
 	///  Returns a string of the form <I>(x,y,z)</I> .
@@ -30,13 +30,13 @@ Coordinate::setNull()
 {
 	x=DoubleNotANumber;
 	y=DoubleNotANumber;
-	z=DoubleNotANumber;
+	setZ(DoubleNotANumber);
 }
 
 INLINE bool
 Coordinate::isNull() const
 {
-	return (ISNAN(x) && ISNAN(y) && ISNAN(z));
+	return (ISNAN(x) && ISNAN(y) && ISNAN(getZ()));
 }
 
 INLINE
@@ -48,9 +48,15 @@ INLINE
 Coordinate::Coordinate(double xNew, double yNew, double zNew)
 	:
 	x(xNew),
-	y(yNew),
-	z(zNew)
-{}
+	y(yNew)
+#ifndef GEOS_COORDINATE_2D
+	, z(zNew)
+#endif
+{
+#ifdef GEOS_COORDINATE_2D
+	(void)zNew;
+#endif
+}
 
 INLINE bool
 Coordinate::equals2D(const Coordinate& other) const
@@ -79,8 +85,12 @@ Coordinate::compareTo(const Coordinate& other) const
 INLINE bool
 Coordinate::equals3D(const Coordinate& other) const
 {
+#ifdef GEOS_COORDINATE_2D
+	return equals2D(other);
+#else
 	return (x == other.x) && ( y == other.y) && 
 		((z == other.z)||(ISNAN(z) && ISNAN(other.z)));
+#endif
 }
 
 INLINE double
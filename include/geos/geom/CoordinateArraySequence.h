@@ -109,6 +109,9 @@ public:
 
 	void expandEnvelope(Envelope &env) const;
 
+	/// Coordinates are interleaved, so the stride is that of Coordinate
+	bool getOrdinateSpan(OrdinateSpan& span) const;
+
     std::size_t getDimension() const;
 
 	void apply_rw(const CoordinateFilter *filter); 
@@ -0,0 +1,194 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_COORDINATEHASHMAP_H
+#define GEOS_GEOM_COORDINATEHASHMAP_H
+
+#include <geos/geom/Coordinate.h> // for inlines
+
+#include <vector>
+#include <cstddef> // for size_t
+#include <cstring> // for memcpy, memcmp
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \class CoordinateHashMap
+ *
+ * \brief
+ * Maps 2D locations to pointers, using open addressing with
+ * linear probing.
+ *
+ * Keys are the exact bit patterns of the X and Y ordinates
+ * (Z is ignored, as in CoordinateLessThen), with negative zero
+ * taken as zero. Lookups cost a hash and, usually, a single probe,
+ * and do not allocate.
+ *
+ * There is no ordering: containers needing a deterministic
+ * iteration order keep an ordered view next to this index.
+ *
+ * @tparam T a pointer type, the null pointer marking empty slots
+ */
+template <class T>
+class CoordinateHashMap {
+
+public:
+
+	CoordinateHashMap()
+		:
+		count(0)
+	{}
+
+	/// Number of mapped locations
+	std::size_t size() const { return count; }
+
+	bool empty() const { return count == 0; }
+
+	/// Returns the value mapped at c, or NULL
+	T find(const Coordinate& c) const
+	{
+		if ( table.empty() ) return 0;
+		return table[slot(key(c.x), key(c.y))].value;
+	}
+
+	/**
+	 * Maps v at c, unless a value is already mapped there.
+	 *
+	 * @param c the location
+	 * @param v the value, not NULL
+	 * @return the value mapped at c after the call
+	 */
+	T insert(const Coordinate& c, T v)
+	{
+		if ( 2 * (count + 1) > table.size() ) grow();
+
+		const double x = key(c.x), y = key(c.y);
+		Entry& e = table[slot(x, y)];
+		if ( e.value ) return e.value;
+		e.x = x;
+		e.y = y;
+		e.value = v;
+		++count;
+		return v;
+	}
+
+	/// Unmaps c, returning the value which was mapped there, or NULL
+	T remove(const Coordinate& c)
+	{
+		if ( table.empty() ) return 0;
+
+		std::size_t i = slot(key(c.x), key(c.y));
+		T removed = table[i].value;
+		if ( ! removed ) return 0;
+
+		// shift back the following entries of the cluster
+		// which would not be found past the hole otherwise
+		const std::size_t mask = table.size() - 1;
+		std::size_t j = i;
+		for (;;)
+		{
+			j = (j + 1) & mask;
+			if ( ! table[j].value ) break;
+			std::size_t home = hash(table[j].x, table[j].y) & mask;
+			if ( ((j - home) & mask) >= ((j - i) & mask) )
+			{
+				table[i] = table[j];
+				i = j;
+			}
+		}
+		table[i].value = 0;
+		--count;
+		return removed;
+	}
+
+	void clear()
+	{
+		table.clear();
+		count = 0;
+	}
+
+private:
+
+	struct Entry {
+		double x;
+		double y;
+		T value;
+	};
+
+	/// Size is zero or a power of two, at most half full
+	std::vector<Entry> table;
+
+	std::size_t count;
+
+	/// Maps -0.0 to 0.0, so that equal ordinates have equal bits
+	static double key(double d) { return d + 0.0; }
+
+	static bool sameBits(double a, double b)
+	{
+		return std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	static std::size_t hash(double x, double y)
+	{
+		unsigned int w[2 * sizeof(double) / sizeof(unsigned int)];
+		std::memcpy(w, &x, sizeof(double));
+		std::memcpy(w + sizeof(double) / sizeof(unsigned int), &y,
+		            sizeof(double));
+
+		unsigned int h = 0x9E3779B9u;
+		for (std::size_t i = 0; i < sizeof(w) / sizeof(w[0]); ++i)
+		{
+			h ^= w[i];
+			h *= 0x85EBCA6Bu;
+			h ^= h >> 15;
+		}
+		h ^= h >> 16;
+		h *= 0xC2B2AE35u;
+		h ^= h >> 13;
+		return h;
+	}
+
+	/// Index of the entry keyed x,y, or of the empty slot ending its probe
+	std::size_t slot(double x, double y) const
+	{
+		const std::size_t mask = table.size() - 1;
+		std::size_t i = hash(x, y) & mask;
+		while ( table[i].value &&
+		        ! ( sameBits(table[i].x, x) && sameBits(table[i].y, y) ) )
+		{
+			i = (i + 1) & mask;
+		}
+		return i;
+	}
+
+	void grow()
+	{
+		Entry empty;
+		empty.x = empty.y = 0.0;
+		empty.value = 0;
+
+		std::vector<Entry> old(table.empty() ? 16 : table.size() * 2, empty);
+		old.swap(table);
+		for (std::size_t i = 0; i < old.size(); ++i)
+		{
+			if ( old[i].value )
+				table[slot(old[i].x, old[i].y)] = old[i];
+		}
+	}
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_COORDINATEHASHMAP_H
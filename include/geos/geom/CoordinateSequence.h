@@ -358,6 +358,88 @@ public:
 	 */
 	virtual void expandEnvelope(Envelope &env) const;
 
+	/** \brief
+	 * Read-only view of the X and Y ordinates of a sequence kept
+	 * in memory at a fixed stride.
+	 *
+	 * The X and Y of coordinate i are x[i*stride] and y[i*stride].
+	 * The view is invalidated by any change to the sequence.
+	 */
+	struct OrdinateSpan {
+		const double* x;
+		const double* y;
+		std::size_t stride;
+		std::size_t size;
+
+		double getX(std::size_t i) const { return x[i*stride]; }
+		double getY(std::size_t i) const { return y[i*stride]; }
+	};
+
+	/// Ordinate accessor for contiguous X and Y arrays
+	struct ContiguousOrdinates {
+		const double* x;
+		const double* y;
+
+		ContiguousOrdinates(const double* xs, const double* ys)
+			: x(xs), y(ys) {}
+
+		double getX(std::size_t i) const { return x[i]; }
+		double getY(std::size_t i) const { return y[i]; }
+	};
+
+	/// Ordinate accessor going through getAt, for any sequence
+	struct SequenceOrdinates {
+		const CoordinateSequence& seq;
+
+		SequenceOrdinates(const CoordinateSequence& s) : seq(s) {}
+
+		double getX(std::size_t i) const { return seq.getAt(i).x; }
+		double getY(std::size_t i) const { return seq.getAt(i).y; }
+	};
+
+	/**
+	 * Gives direct access to the X and Y ordinates, if this
+	 * sequence stores them at a fixed stride.
+	 *
+	 * @param span set to the ordinates location on success
+	 * @return false if the ordinates are not available this way
+	 *         (the default)
+	 */
+	virtual bool getOrdinateSpan(OrdinateSpan& span) const;
+
+	/** \brief
+	 * Apply a filter reading the X and Y ordinates of this sequence
+	 * through the cheapest accessor available.
+	 *
+	 * The filter is expected to provide a
+	 * <code>template <class Ordinates>
+	 * filter(const Ordinates& ords, std::size_t size)</code> method,
+	 * reading ordinates with <code>ords.getX(i)</code> and
+	 * <code>ords.getY(i)</code>. The Ordinates type is one of
+	 * ContiguousOrdinates, OrdinateSpan or SequenceOrdinates, all of
+	 * which are non-virtual, so that loops over contiguous arrays
+	 * can be vectorized by the compiler.
+	 */
+	template <class T>
+	void applyOrdinateFilter(T& f) const
+	{
+		OrdinateSpan span;
+		if ( ! getOrdinateSpan(span) )
+		{
+			SequenceOrdinates ords(*this);
+			f.filter(ords, size());
+		}
+		else if ( span.stride == 1 )
+		{
+			ContiguousOrdinates ords(span.x, span.y);
+			f.filter(ords, span.size);
+		}
+		else
+		{
+			f.filter(span, span.size);
+		}
+	}
+
 	virtual void apply_rw(const CoordinateFilter *filter)=0; //Abstract
 	virtual void apply_ro(CoordinateFilter *filter) const=0; //Abstract
 
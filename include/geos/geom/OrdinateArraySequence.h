@@ -0,0 +1,172 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_ORDINATEARRAYSEQUENCE_H
+#define GEOS_GEOM_ORDINATEARRAYSEQUENCE_H
+
+#include <geos/export.h>
+#include <vector>
+
+#include <geos/geom/CoordinateSequence.h> // for inheritance
+#include <geos/geom/Coordinate.h> // for vector<Coordinate>
+#include <geos/util/AtomicPointer.h> // for composition
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace geom { // geos.geom
+
+/**
+ * \brief
+ * A CoordinateSequence storing X, Y and Z ordinates in separate
+ * contiguous arrays (structure of arrays).
+ *
+ * The Z array is only allocated once a coordinate with a Z value is
+ * stored, so purely 2D data takes two doubles per coordinate instead
+ * of the three of CoordinateArraySequence.
+ *
+ * X and Y are exposed with unit stride through getOrdinateSpan, so
+ * that algorithms using CoordinateSequence::applyOrdinateFilter run
+ * tight loops over plain arrays.
+ *
+ * Coordinates are read by value with getAt(size_t, Coordinate&),
+ * getX, getY, getOrdinate or toVector(std::vector<Coordinate>&), which
+ * allocate nothing. The CoordinateSequence methods returning references
+ * or pointers to Coordinate objects (getAt(size_t), toVector(),
+ * apply_ro, whose filters may keep the pointers) need Coordinate objects
+ * to point to: they are served from an interleaved view, built once on
+ * first use and published to concurrent readers under a lock, and
+ * dropped when the size of the sequence changes.
+ */
+class GEOS_DLL OrdinateArraySequence : public CoordinateSequence {
+public:
+
+	/// Construct an empty sequence
+	OrdinateArraySequence();
+
+	/// Construct sequence with n coordinates, all set to (0,0,NaN)
+	OrdinateArraySequence(std::size_t n, std::size_t dimension = 0);
+
+	/// Construct sequence copying the given Coordinates
+	OrdinateArraySequence(const std::vector<Coordinate>& coords,
+	                      std::size_t dimension = 0);
+
+	OrdinateArraySequence(const OrdinateArraySequence &cl);
+
+	~OrdinateArraySequence();
+
+	CoordinateSequence *clone() const;
+
+	const Coordinate& getAt(std::size_t pos) const;
+
+	void getAt(std::size_t i, Coordinate& c) const;
+
+	std::size_t getSize() const { return xs.size(); }
+
+	// @deprecated
+	const std::vector<Coordinate>* toVector() const;
+
+	// See dox in CoordinateSequence.h
+	void toVector(std::vector<Coordinate>&) const;
+
+	bool isEmpty() const { return xs.empty(); }
+
+	void add(const Coordinate& c);
+
+	void add(const Coordinate& c, bool allowRepeated);
+
+	void add(std::size_t i, const Coordinate& coord, bool allowRepeated);
+
+	void setAt(const Coordinate& c, std::size_t pos);
+
+	void deleteAt(std::size_t pos);
+
+	std::string toString() const;
+
+	void setPoints(const std::vector<Coordinate> &v);
+
+	/// 3 if any coordinate has a Z value (or 3 was requested), 2 otherwise
+	std::size_t getDimension() const;
+
+	double getOrdinate(std::size_t index, std::size_t ordinateIndex) const;
+
+	double getX(std::size_t index) const { return xs[index]; }
+
+	double getY(std::size_t index) const { return ys[index]; }
+
+	void setOrdinate(std::size_t index, std::size_t ordinateIndex,
+			double value);
+
+	/// X and Y are contiguous, the stride is 1
+	bool getOrdinateSpan(OrdinateSpan& span) const;
+
+	void apply_rw(const CoordinateFilter *filter);
+
+	void apply_ro(CoordinateFilter *filter) const;
+
+	CoordinateSequence& removeRepeatedPoints();
+
+	/// The X ordinates, getSize() of them
+	const double* getXArray() const { return xs.empty() ? 0 : &xs[0]; }
+
+	/// The Y ordinates, getSize() of them
+	const double* getYArray() const { return ys.empty() ? 0 : &ys[0]; }
+
+	/// The Z ordinates, NULL if no coordinate has a Z value
+	const double* getZArray() const { return zs.empty() ? 0 : &zs[0]; }
+
+private:
+
+	std::vector<double> xs;
+
+	std::vector<double> ys;
+
+	/// Empty until a Z value is stored, then parallel to xs
+	std::vector<double> zs;
+
+	/// Dimension requested at construction, 0 if unspecified
+	std::size_t dimension;
+
+	/// Interleaved view for the reference-returning interface, NULL
+	/// until used
+	mutable util::AtomicPointer<const std::vector<Coordinate> > coordView;
+
+	/// Allocates the Z array, filled with NaN
+	void allocateZ();
+
+	void setZ(std::size_t pos, double z);
+
+	/// Builds coordView if needed
+	const std::vector<Coordinate>& coordinates() const;
+
+	/// Called by operations changing the number of coordinates
+	void dropView();
+
+	/// Called by operations changing the coordinate at pos
+	void updateView(std::size_t pos);
+
+	// Declare type as non-assignable
+	OrdinateArraySequence& operator=(const OrdinateArraySequence& rhs);
+};
+
+} // namespace geos.geom
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // ndef GEOS_GEOM_ORDINATEARRAYSEQUENCE_H
@@ -0,0 +1,66 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_ORDINATEARRAYSEQUENCEFACTORY_H
+#define GEOS_GEOM_ORDINATEARRAYSEQUENCEFACTORY_H
+
+#include <geos/export.h>
+#include <vector>
+
+#include <geos/geom/CoordinateSequenceFactory.h> // for inheritance
+
+// Forward declarations
+namespace geos {
+	namespace geom { 
+		class Coordinate;
+	}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \class OrdinateArraySequenceFactory
+ *
+ * \brief
+ * Creates CoordinateSequences internally represented as separate
+ * arrays of X, Y and Z ordinates (see OrdinateArraySequence).
+ *
+ * Pass it to a GeometryFactory to have every geometry created by
+ * that factory use the structure of arrays layout.
+ */
+class GEOS_DLL OrdinateArraySequenceFactory: public CoordinateSequenceFactory {
+
+public:
+
+	/** \brief
+	 * Returns an OrdinateArraySequence with the coordinates of the
+	 * given vector, which is deleted (callers give up ownership).
+	 */
+	CoordinateSequence *create(std::vector<Coordinate> *coords) const;
+
+	CoordinateSequence *create(std::vector<Coordinate> *coords, std::size_t dims) const;
+
+	/** @see CoordinateSequenceFactory::create(std::size_t, int) */
+	CoordinateSequence *create(std::size_t size, std::size_t dimension=0) const;
+
+	/** \brief
+	 * Returns the singleton instance of OrdinateArraySequenceFactory
+	 */
+	static const CoordinateSequenceFactory *instance();
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // ndef GEOS_GEOM_ORDINATEARRAYSEQUENCEFACTORY_H
@@ -26,6 +26,8 @@
 //#include <geos/geom/util/ComponentCoordinateExtracter.h> 
 #include <geos/geom/Coordinate.h> 
 //#include <geos/geom/Location.h>
+#include <geos/util/AtomicPointer.h> 
+#include <geos/util/Mutex.h> 
 
 #include <vector>
 #include <string>
@@ -35,6 +37,11 @@ namespace geos {
 		class Geometry;
 		class Coordinate;
 	}
+	namespace operation {
+		namespace distance {
+			class IndexedFacetDistance;
+		}
+	}
 }
 
 
@@ -62,8 +69,19 @@ class BasicPreparedGeometry: public PreparedGeometry
 private:
 	const geom::Geometry * baseGeom;
 	Coordinate::ConstVect representativePts;
+	mutable geos::util::AtomicPointer<operation::distance::IndexedFacetDistance> facetDistance;
+
+	/**
+	 * Tests whether a component of either geometry lies in the
+	 * area of the other, in which case their distance is 0 even
+	 * if their facets are apart.
+	 */
+	bool isAnyComponentInArea(const geom::Geometry * g) const;
 
 protected:
+	/// Taken while the lazily built structures are built
+	mutable geos::util::Mutex buildMutex;
+
 	/**
 	 * Sets the original {@link Geometry} which will be prepared.
 	 */
@@ -88,6 +106,24 @@ protected:
 	 */
 	bool envelopeCovers(const geom::Geometry* g) const;
 
+	/**
+	 * Gets the index of the facets of this geometry,
+	 * building it on first use.
+	 */
+	const operation::distance::IndexedFacetDistance * getFacetDistance() const;
+
+	/**
+	 * Tests whether any component of the test geometry lies in the
+	 * interior or boundary of this geometry's area.
+	 * Always false if this geometry has no area.
+	 *
+	 * The default implementation uses a PointLocator,
+	 * subclasses may use their indexes.
+	 *
+	 * @param testGeom the test geometry
+	 */
+	virtual bool isAnyTestComponentInTarget(const geom::Geometry * testGeom) const;
+
 public:
 	BasicPreparedGeometry( const Geometry * geom);
 
@@ -98,6 +134,9 @@ public:
 		return *baseGeom;
 	}
 
+	/// Builds the facet index
+	void prepareAll() const;
+
 	/**
 	 * Gets the list of representative points for this geometry.
 	 * One vertex is included for every component of the geometry
@@ -172,6 +211,18 @@ public:
 	 */
 	bool within(const geom::Geometry * g) const;
 
+	/**
+	 * Standard implementation for all geometries, using the
+	 * facet index.
+	 */
+	double distance(const geom::Geometry * g) const;
+
+	/**
+	 * Standard implementation for all geometries, using the
+	 * facet index.
+	 */
+	bool isWithinDistance(const geom::Geometry * g, double dist) const;
+
 	std::string toString();
 
 };
@@ -50,6 +50,10 @@ namespace prep { // geos::geom::prep
  * See the implementing classes for documentation about which methods and situations
  * they optimize.
  * 
+ * A prepared geometry can be shared by several threads, as long as
+ * neither it nor its base geometry are modified meanwhile. The
+ * structures built on first use are built once, under a lock.
+ * 
  */
 class GEOS_DLL PreparedGeometry {
 public:
@@ -62,6 +66,16 @@ public:
 	 */
 	virtual const geom::Geometry & getGeometry() const =0;
 
+	/**
+	 * Builds now the indexes and locators which would otherwise be
+	 * built by the first predicate needing them.
+	 *
+	 * Calling this before handing the prepared geometry to several
+	 * threads keeps them from waiting on each other for the build.
+	 * Does nothing by default.
+	 */
+	virtual void prepareAll() const {}
+
 	/**
 	 * Tests whether the base {@link Geometry} contains a given geometry.
 	 * 
@@ -192,6 +206,40 @@ public:
 	 * @see Geometry#within(Geometry)
 	 */
 	virtual bool within(const geom::Geometry *geom) const =0;
+
+	/**
+	 * Computes the minimum distance between the base {@link Geometry}
+	 * and a given geometry.
+	 *
+	 * The default implementation delegates to Geometry::distance.
+	 * BasicPreparedGeometry indexes the facets (segments and vertices)
+	 * of the base geometry on first use, so that only the facets near
+	 * the given geometry are compared.
+	 *
+	 * @param geom the Geometry to compute the distance to
+	 * @return the distance, 0 if either geometry is empty
+	 *
+	 * @see Geometry#distance(Geometry)
+	 */
+	virtual double distance(const geom::Geometry *geom) const;
+
+	/**
+	 * Tests whether the base {@link Geometry} is within a given
+	 * distance of a given geometry.
+	 *
+	 * The default implementation delegates to
+	 * Geometry::isWithinDistance. BasicPreparedGeometry stops at the
+	 * first pair of facets found within the distance, rather than
+	 * computing the minimum distance.
+	 *
+	 * @param geom the Geometry to test
+	 * @param dist the distance to test against
+	 * @return true if the geometries are no farther than dist apart
+	 *
+	 * @see Geometry#isWithinDistance(Geometry, double)
+	 */
+	virtual bool isWithinDistance(const geom::Geometry *geom,
+	                              double dist) const;
 };
 
 
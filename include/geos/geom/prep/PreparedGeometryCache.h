@@ -0,0 +1,157 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
+#define GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
+
+#include <geos/export.h>
+
+#include <list>
+#include <map>
+#include <cstddef> // for size_t
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geom {
+		class Geometry;
+		namespace prep {
+			class PreparedGeometry;
+		}
+	}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \class PreparedGeometryCache
+ *
+ * \brief
+ * A least recently used cache of PreparedGeometry objects, for
+ * callers evaluating predicates of the same geometry against many
+ * others without preparing it themselves.
+ *
+ * Geometries are keyed by address, plus a hash of their structure
+ * and coordinates, so that a geometry modified in place or a different
+ * geometry later allocated at the same address is not mistaken for the
+ * cached one. A geometry is prepared the second time it is seen, so that
+ * geometries used in a single predicate do not pay for a preparation.
+ *
+ * The geometries are prepared from a copy owned by the cache: cached
+ * geometries can be destroyed or modified at any time, invalidating
+ * them only releases the memory early.
+ */
+class GEOS_DLL PreparedGeometryCache {
+
+public:
+
+	/**
+	 * @param maxEntries number of geometries remembered
+	 * @param maxPoints total number of points of the prepared
+	 *        geometries kept, 0 for no limit
+	 */
+	PreparedGeometryCache(std::size_t maxEntries,
+	                      std::size_t maxPoints = 0);
+
+	~PreparedGeometryCache();
+
+	/**
+	 * Returns the prepared form of g, preparing it if it was
+	 * seen before.
+	 *
+	 * @return the prepared geometry, owned by the cache and valid
+	 *         until the next call to a non-const method, or NULL
+	 *         when g is not worth preparing (yet)
+	 */
+	const PreparedGeometry* get(const Geometry& g);
+
+	/// Drops the entries for g and its components (sub-geometries
+	/// and rings), if any
+	void invalidate(const Geometry* g);
+
+	/// Drops all the entries
+	void clear();
+
+	/// Changes the limits, evicting entries as needed
+	void setLimits(std::size_t maxEntries, std::size_t maxPoints = 0);
+
+	/// Number of calls to get() finding g already prepared
+	std::size_t getHits() const { return hits; }
+
+	/// Number of calls to get() not finding g prepared
+	std::size_t getMisses() const { return misses; }
+
+	/// Number of geometries remembered, prepared or not
+	std::size_t size() const { return index.size(); }
+
+	/// Total number of points of the prepared geometries
+	std::size_t getNumPoints() const { return numPoints; }
+
+private:
+
+	struct Entry {
+		const Geometry* geom;
+		std::size_t fingerprint;
+		const PreparedGeometry* prepared;
+		/// The copy of geom prepared, owned
+		const Geometry* copy;
+		std::size_t numPoints;
+	};
+
+	typedef std::list<Entry> EntryList;
+
+	typedef std::map<const Geometry*, EntryList::iterator> EntryIndex;
+
+	/// Most recently used first
+	EntryList entries;
+
+	EntryIndex index;
+
+	std::size_t maxEntries;
+
+	std::size_t maxPoints;
+
+	std::size_t numPoints;
+
+	std::size_t hits;
+
+	std::size_t misses;
+
+	static std::size_t fingerprint(const Geometry& g);
+
+	void erase(EntryIndex::iterator it);
+
+	/// Evicts entries, least recently used first, until there is
+	/// room for the given number of points
+	void makeRoom(std::size_t points);
+
+	// Declare type as noncopyable
+	PreparedGeometryCache(const PreparedGeometryCache& other);
+	PreparedGeometryCache& operator=(const PreparedGeometryCache& rhs);
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_GEOM_PREP_PREPAREDGEOMETRYCACHE_H
@@ -24,6 +24,8 @@
 #include <geos/export.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 
+#include <cstddef> // for size_t
+
 namespace geos {
 	namespace geom {
         namespace prep {
@@ -44,8 +46,8 @@ namespace prep { // geos::geom::prep
  * 
  * It chooses an appropriate implementation of PreparedGeometry
  * based on the geoemtric type of the input geometry.
- * In the future, the factory may accept hints that indicate
- * special optimizations which can be performed.
+ * Hints set on the factory select special optimizations
+ * for the geometries it prepares.
  * 
  * @author Martin Davis
  *
@@ -54,6 +56,10 @@ class GEOS_DLL PreparedGeometryFactory
 {
 public:
 
+	PreparedGeometryFactory()
+	:	gridPointLocator(false), gridCells(0)
+	{}
+
 	/**
 	* Creates a new {@link PreparedGeometry} appropriate for the argument {@link Geometry}.
 	* 
@@ -84,6 +90,29 @@ public:
 	*/
 	const PreparedGeometry* create(const geom::Geometry* geom) const;
 
+	/**
+	 * Selects the point locator of the prepared polygons.
+	 *
+	 * By default an IndexedPointInAreaLocator is used. A
+	 * GridPointInAreaLocator takes more memory, but locates
+	 * most points of large polygons in constant time.
+	 *
+	 * @param enable true to use a GridPointInAreaLocator
+	 * @param numCells about how many grid cells to use,
+	 *        0 to choose from the number of segments
+	 */
+	void setGridPointLocator(bool enable, std::size_t numCells = 0)
+	{
+		gridPointLocator = enable;
+		gridCells = numCells;
+	}
+
+private:
+
+	bool gridPointLocator;
+
+	std::size_t gridCells;
+
 };
 
 } // namespace geos::geom::prep
@@ -23,11 +23,17 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
 #include <geos/noding/SegmentString.h> 
+#include <geos/util/AtomicPointer.h> 
 
 namespace geos {
 	namespace noding {
 		class FastSegmentSetIntersectionFinder;
 	}
+	namespace algorithm {
+		namespace locate {
+			class IndexedPointOnLineLocator;
+		}
+	}
 }
 
 namespace geos {
@@ -44,7 +50,8 @@ namespace prep { // geos::geom::prep
 class PreparedLineString : public BasicPreparedGeometry 
 {
 private:
-	noding::FastSegmentSetIntersectionFinder * segIntFinder;
+	mutable geos::util::AtomicPointer<noding::FastSegmentSetIntersectionFinder> segIntFinder;
+	mutable geos::util::AtomicPointer<algorithm::locate::IndexedPointOnLineLocator> ptOnGeomLoc;
 	mutable noding::SegmentString::ConstVect segStrings;
 
 protected:
@@ -52,14 +59,22 @@ public:
 	PreparedLineString(const Geometry * geom) 
 		: 
 		BasicPreparedGeometry( geom),
-		segIntFinder( NULL)
+		segIntFinder( NULL),
+		ptOnGeomLoc( NULL)
 	{ }
 
 	~PreparedLineString();
 
-	noding::FastSegmentSetIntersectionFinder * getIntersectionFinder();
+	noding::FastSegmentSetIntersectionFinder * getIntersectionFinder() const;
+	algorithm::locate::IndexedPointOnLineLocator * getPointLocator() const;
+
+	/// Builds the intersection finder and the point locator
+	void prepareAll() const;
 
+	bool covers(const geom::Geometry * g) const;
+	bool crosses(const geom::Geometry * g) const;
 	bool intersects(const geom::Geometry * g) const;
+	bool touches(const geom::Geometry * g) const;
 
 };
 
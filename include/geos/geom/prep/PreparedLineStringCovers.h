@@ -0,0 +1,68 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDLINESTRINGCOVERS_H
+#define GEOS_GEOM_PREP_PREPAREDLINESTRINGCOVERS_H
+
+#include <geos/geom/prep/PreparedLineStringPredicate.h> // for inheritance
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * Computes the <tt>covers</tt> spatial relationship predicate
+ * for a {@link PreparedLineString} relative to puntal and lineal
+ * geometries.
+ *
+ * Points are covered if the point locator finds them on the target.
+ * Each segment of a lineal test geometry must be covered by the
+ * target segments overlapping it collinearly, which are found with
+ * the cached segment index of the target.
+ */
+class PreparedLineStringCovers : public PreparedLineStringPredicate
+{
+public:
+	/**
+	 * Computes the covers predicate between a {@link PreparedLineString}
+	 * and a {@link Geometry}.
+	 *
+	 * @param prep the prepared linestring
+	 * @param geom a non-empty puntal or lineal test geometry
+	 * @return true if the linestring covers the geometry
+	 */
+	static bool covers( const PreparedLineString * const prep, const geom::Geometry * geom)
+	{
+		PreparedLineStringCovers op( prep);
+		return op.covers( geom);
+	}
+
+	PreparedLineStringCovers( const PreparedLineString * const prep)
+		: PreparedLineStringPredicate( prep)
+	{ }
+
+	/**
+	 * Tests whether the target covers a given geometry.
+	 *
+	 * @param geom the test geometry
+	 * @return true if the test geometry is covered
+	 */
+	bool covers( const geom::Geometry * geom) const;
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_PREP_PREPAREDLINESTRINGCOVERS_H
@@ -0,0 +1,68 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDLINESTRINGCROSSES_H
+#define GEOS_GEOM_PREP_PREPAREDLINESTRINGCROSSES_H
+
+#include <geos/geom/prep/PreparedLineStringPredicate.h> // for inheritance
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * Computes the <tt>crosses</tt> spatial relationship predicate
+ * for a {@link PreparedLineString} relative to puntal and lineal
+ * geometries.
+ *
+ * Against points, the target crosses if some test points are in its
+ * interior and others outside of it. Two lines cross if their
+ * interiors intersect at points only, which is found by classifying
+ * the segment intersections reported by the cached segment index.
+ */
+class PreparedLineStringCrosses : public PreparedLineStringPredicate
+{
+public:
+	/**
+	 * Computes the crosses predicate between a {@link PreparedLineString}
+	 * and a {@link Geometry}.
+	 *
+	 * @param prep the prepared linestring
+	 * @param geom a non-empty puntal or lineal test geometry
+	 * @return true if the linestring crosses the geometry
+	 */
+	static bool crosses( const PreparedLineString * const prep, const geom::Geometry * geom)
+	{
+		PreparedLineStringCrosses op( prep);
+		return op.crosses( geom);
+	}
+
+	PreparedLineStringCrosses( const PreparedLineString * const prep)
+		: PreparedLineStringPredicate( prep)
+	{ }
+
+	/**
+	 * Tests whether the target crosses a given geometry.
+	 *
+	 * @param geom the test geometry
+	 * @return true if the target crosses the test geometry
+	 */
+	bool crosses( const geom::Geometry * geom) const;
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_PREP_PREPAREDLINESTRINGCROSSES_H
@@ -0,0 +1,103 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDLINESTRINGPREDICATE_H
+#define GEOS_GEOM_PREP_PREPAREDLINESTRINGPREDICATE_H
+
+namespace geos {
+	namespace geom { 
+		class Geometry;
+		namespace prep { 
+			class PreparedLineString;
+		}
+	}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * A base class for predicate operations on {@link PreparedLineString}s
+ * and puntal or lineal test geometries.
+ *
+ * Points are located with the indexed point locator of the target,
+ * lines are intersected with the target by its cached
+ * FastSegmentSetIntersectionFinder. The Mod-2 boundary rule is used
+ * for both geometries, as in relate.
+ */
+class PreparedLineStringPredicate
+{
+protected:
+	const PreparedLineString * const prepLine;
+
+	/// Locations of the points of a test geometry on the target
+	struct PointLocations {
+		bool anyInterior;
+		bool anyBoundary;
+		bool anyExterior;
+	};
+
+	/// Intersections of the lines of a test geometry with the target
+	struct LineIntersections {
+		/// The lines intersect
+		bool intersects;
+		/// The interiors intersect at a point
+		bool interiorsIntersect;
+		/// The lines overlap along a segment, so that their
+		/// interiors intersect in dimension 1
+		bool interiorsOverlap;
+	};
+
+	/**
+	 * Locates the points of a puntal test geometry on the target.
+	 */
+	PointLocations locateTestPoints( const geom::Geometry * testGeom) const;
+
+	/**
+	 * Finds how the lines of a lineal test geometry intersect the
+	 * target, stopping once the interiors are found to overlap or,
+	 * if stopAtInteriorIntersection is true, to intersect.
+	 */
+	LineIntersections findLineIntersections( const geom::Geometry * testGeom,
+	                                         bool stopAtInteriorIntersection) const;
+
+public:
+	/**
+	 * Creates an instance of this operation.
+	 *
+	 * @param prepLine the PreparedLineString to evaluate
+	 */
+	PreparedLineStringPredicate( const PreparedLineString * const prepLine)
+		: prepLine( prepLine)
+	{ }
+
+	virtual ~PreparedLineStringPredicate()
+	{ }
+
+	/**
+	 * Tests whether the test geometry is handled by the predicates:
+	 * non-empty and either puntal or lineal.
+	 */
+	static bool isSupportedTestGeometry( const geom::Geometry * testGeom);
+
+	/// Tests whether the geometry is a Point or MultiPoint
+	static bool isPuntal( const geom::Geometry * testGeom);
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_PREP_PREPAREDLINESTRINGPREDICATE_H
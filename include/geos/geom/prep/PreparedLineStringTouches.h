@@ -0,0 +1,69 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDLINESTRINGTOUCHES_H
+#define GEOS_GEOM_PREP_PREPAREDLINESTRINGTOUCHES_H
+
+#include <geos/geom/prep/PreparedLineStringPredicate.h> // for inheritance
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * Computes the <tt>touches</tt> spatial relationship predicate
+ * for a {@link PreparedLineString} relative to puntal and lineal
+ * geometries.
+ *
+ * The geometries touch if they intersect, but not in their interiors:
+ * test points must be on the boundary of the target or outside of it,
+ * test lines may only meet the target at the boundary of either.
+ * Segment intersections are found with the cached segment index,
+ * and the search stops at the first interior intersection.
+ */
+class PreparedLineStringTouches : public PreparedLineStringPredicate
+{
+public:
+	/**
+	 * Computes the touches predicate between a {@link PreparedLineString}
+	 * and a {@link Geometry}.
+	 *
+	 * @param prep the prepared linestring
+	 * @param geom a non-empty puntal or lineal test geometry
+	 * @return true if the linestring touches the geometry
+	 */
+	static bool touches( const PreparedLineString * const prep, const geom::Geometry * geom)
+	{
+		PreparedLineStringTouches op( prep);
+		return op.touches( geom);
+	}
+
+	PreparedLineStringTouches( const PreparedLineString * const prep)
+		: PreparedLineStringPredicate( prep)
+	{ }
+
+	/**
+	 * Tests whether the target touches a given geometry.
+	 *
+	 * @param geom the test geometry
+	 * @return true if the target touches the test geometry
+	 */
+	bool touches( const geom::Geometry * geom) const;
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_PREP_PREPAREDLINESTRINGTOUCHES_H
@@ -22,6 +22,10 @@
 #define GEOS_GEOM_PREP_PREPAREDPOINT_H
 
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
+#include <geos/geom/Coordinate.h> 
+#include <geos/util/AtomicPointer.h> 
+
+#include <vector>
 
 namespace geos {
 namespace geom { // geos::geom
@@ -37,19 +41,54 @@ namespace prep { // geos::geom::prep
 class PreparedPoint: public BasicPreparedGeometry 
 {
 private:
+	/// The points, sorted, built on first use by covers
+	mutable geos::util::AtomicPointer< std::vector<geom::Coordinate> > sortedPts;
+
+	const std::vector<geom::Coordinate> * getSortedPoints() const;
+
+	/**
+	 * Tests whether the test geometry is handled without relate:
+	 * non-empty and neither puntal nor a collection.
+	 */
+	static bool isLinealOrAreal(const geom::Geometry* g);
+
 protected:
 public:
 	PreparedPoint(const Geometry * geom) 
-		: BasicPreparedGeometry( geom) 
+		: BasicPreparedGeometry( geom),
+		  sortedPts( NULL)
 	{ }
 
+	~PreparedPoint();
+
+	/// Builds the sorted points
+	void prepareAll() const;
+
+	/**
+	 * Tests whether this point covers a puntal {@link Geometry},
+	 * by looking up each of its points in the sorted points.
+	 */
+	bool covers(const geom::Geometry* g) const;
+
+	/**
+	 * Tests whether this point crosses a {@link Geometry}:
+	 * some points are in its interior, others outside of it.
+	 */
+	bool crosses(const geom::Geometry* g) const;
+
 	/**
 	 * Tests whether this point intersects a {@link Geometry}.
 	 * 
 	 * The optimization here is that computing topology for the test
 	 * geometry is avoided. This can be significant for large geometries.
 	 */
-	bool intersects(const geom::Geometry* g);
+	bool intersects(const geom::Geometry* g) const;
+
+	/**
+	 * Tests whether this point touches a {@link Geometry}:
+	 * no point is in its interior and some are on its boundary.
+	 */
+	bool touches(const geom::Geometry* g) const;
 
 };
 
@@ -23,6 +23,8 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
 #include <geos/noding/SegmentString.h> 
+#include <geos/util/AtomicPointer.h> 
+#include <cstddef> // for size_t
 
 namespace geos {
 	namespace noding {
@@ -50,23 +52,53 @@ class PreparedPolygon : public BasicPreparedGeometry
 {
 private:
 	bool isRectangle;
-	mutable noding::FastSegmentSetIntersectionFinder * segIntFinder;
-	mutable algorithm::locate::PointOnGeometryLocator * ptOnGeomLoc;
+	bool gridPointLocator;
+	std::size_t gridCells;
+	mutable geos::util::AtomicPointer<noding::FastSegmentSetIntersectionFinder> segIntFinder;
+	mutable geos::util::AtomicPointer<algorithm::locate::PointOnGeometryLocator> ptOnGeomLoc;
 	mutable noding::SegmentString::ConstVect segStrings;
 
 protected:
+	/// Uses the point locator
+	bool isAnyTestComponentInTarget( const geom::Geometry* testGeom) const;
+
 public:
-	PreparedPolygon( const geom::Geometry * geom);
+	/**
+	 * @param geom the polygonal geometry to prepare
+	 * @param gridPointLocator true to locate points with a
+	 *        GridPointInAreaLocator of about gridCells cells
+	 *        rather than an IndexedPointInAreaLocator
+	 * @param gridCells 0 to choose from the number of segments
+	 */
+	PreparedPolygon( const geom::Geometry * geom,
+	                 bool gridPointLocator = false,
+	                 std::size_t gridCells = 0);
 	~PreparedPolygon( );
   
 	noding::FastSegmentSetIntersectionFinder * getIntersectionFinder() const;
 	algorithm::locate::PointOnGeometryLocator * getPointLocator() const;
+
+	/// Builds the intersection finder and the point locator
+	void prepareAll() const;
 	
 	bool contains( const geom::Geometry* g) const;
 	bool containsProperly( const geom::Geometry* g) const;
 	bool covers( const geom::Geometry* g) const;
 	bool intersects( const geom::Geometry* g) const;
 
+	/**
+	 * Determines the {@link Location} of many points, given as
+	 * ordinate arrays, using the point locator.
+	 *
+	 * @param x the X ordinates of the points
+	 * @param y the Y ordinates of the points
+	 * @param n the number of points
+	 * @param locations the n locations are written here
+	 * @param numThreads threads to use, 0 for one per processor
+	 */
+	void locate( const double* x, const double* y, std::size_t n,
+	             int* locations, unsigned int numThreads = 1) const;
+
 };
 
 } // namespace geos::geom::prep
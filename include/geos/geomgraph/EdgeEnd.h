@@ -24,6 +24,7 @@
 
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h>  // for p0,p1
+#include <geos/util/Arena.h> // for inheritance
 #include <geos/inline.h>
 
 #include <string>
@@ -53,7 +54,7 @@ namespace geomgraph { // geos.geomgraph
  * "a has a greater angle with the x-axis than b".
  * This ordering is used to sort EdgeEnds around a node.
  */
-class GEOS_DLL EdgeEnd {
+class GEOS_DLL EdgeEnd: public util::ArenaAllocated {
 
 public:
 
@@ -25,6 +25,7 @@
 #include <geos/export.h>
 #include <geos/geomgraph/EdgeEnd.h>  // for EdgeEndLT
 #include <geos/geom/Coordinate.h>  // for p0,p1
+#include <geos/util/Arena.h> // for inheritance
 
 #include <geos/inline.h>
 
@@ -60,7 +61,7 @@ namespace geomgraph { // geos.geomgraph
  *
  * @version 1.4
  */
-class GEOS_DLL EdgeEndStar {
+class GEOS_DLL EdgeEndStar: public util::ArenaAllocated {
 public:
 
 	typedef std::set<EdgeEnd *, EdgeEndLT> container;
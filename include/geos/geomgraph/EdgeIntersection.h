@@ -25,6 +25,7 @@
 #include <geos/export.h>
 
 #include <geos/geom/Coordinate.h> // for composition and inlines
+#include <geos/util/Arena.h> // for inheritance
 
 #include <geos/inline.h>
 
@@ -42,7 +43,7 @@ namespace geomgraph { // geos.geomgraph
  * The intersection point must be precise.
  *
  */
-class GEOS_DLL EdgeIntersection {
+class GEOS_DLL EdgeIntersection: public util::ArenaAllocated {
 public:
 
 	// the point of intersection
@@ -30,6 +30,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h> // for auto_ptr<CoordinateSequence>
 #include <geos/geomgraph/PlanarGraph.h>
+#include <geos/geomgraph/index/EdgeSetIntersector.h> // for Type
 #include <geos/geom/LineString.h> // for LineStringLT
 
 #include <geos/inline.h>
@@ -109,8 +110,15 @@ private:
 
 	geom::Coordinate invalidPoint; 
 
-	/// Allocates a new EdgeSetIntersector. Remember to delete it!
-	index::EdgeSetIntersector* createEdgeSetIntersector();
+	index::EdgeSetIntersector::Type edgeSetIntersectorType;
+
+	/**
+	 * Allocates a new EdgeSetIntersector for the given edges.
+	 * Remember to delete it!
+	 */
+	index::EdgeSetIntersector* createEdgeSetIntersector(
+			std::vector<Edge*>& edges0,
+			std::vector<Edge*>* edges1=NULL);
 
 	void add(const geom::Geometry *g);
 		// throw(UnsupportedOperationException);
@@ -229,6 +237,19 @@ public:
 	const algorithm::BoundaryNodeRule& getBoundaryNodeRule() const
 	{ return boundaryNodeRule; }
 
+	/**
+	 * Sets how computeSelfNodes and computeEdgeIntersections find
+	 * the intersections of the edges. The default,
+	 * index::EdgeSetIntersector::AUTO, sweeps a line over the
+	 * monotone chains of the edges, and indexes them in a tree when
+	 * the sweep line would compare each chain with many others.
+	 */
+	void setEdgeSetIntersectorType(index::EdgeSetIntersector::Type type)
+	{ edgeSetIntersectorType = type; }
+
+	index::EdgeSetIntersector::Type getEdgeSetIntersectorType() const
+	{ return edgeSetIntersectorType; }
+
 };
 
 
@@ -23,6 +23,7 @@
 #define GEOS_GEOMGRAPH_GRAPHCOMPONENT_H
 
 #include <geos/export.h>
+#include <geos/util/Arena.h> // for inheritance
 #include <geos/inline.h>
 
 // Forward declarations
@@ -39,7 +40,7 @@ namespace geos {
 namespace geomgraph { // geos.geomgraph
 
 
-class GEOS_DLL GraphComponent {
+class GEOS_DLL GraphComponent: public util::ArenaAllocated {
 public:
 	GraphComponent();
 
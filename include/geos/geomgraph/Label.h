@@ -24,6 +24,7 @@
 
 #include <geos/export.h>
 #include <geos/geomgraph/TopologyLocation.h> 
+#include <geos/util/Arena.h> // for inheritance
 
 #include <geos/inline.h>
 
@@ -55,7 +56,7 @@ namespace geomgraph { // geos.geomgraph
  * with specific geometries.
  *
  */
-class GEOS_DLL Label {
+class GEOS_DLL Label: public util::ArenaAllocated {
 
 public:
 
@@ -28,6 +28,7 @@
 #include <string>
 
 #include <geos/geom/Coordinate.h> // for CoordinateLessThen
+#include <geos/geom/CoordinateHashMap.h> // for composition
 #include <geos/geomgraph/Node.h> // for testInvariant
 
 #include <geos/inline.h>
@@ -49,6 +50,15 @@ namespace geos {
 namespace geos {
 namespace geomgraph { // geos.geomgraph
 
+/**
+ * \brief
+ * The nodes of a graph, by location.
+ *
+ * Lookups by location (find, addNode) go through a hash index.
+ * The nodeMap container is the ordered view used for iteration,
+ * so that nodes are visited in a deterministic order. It must not
+ * be modified other than through this class.
+ */
 class GEOS_DLL NodeMap{
 public:
 
@@ -104,12 +114,21 @@ public:
 				&(n->getCoordinate())
 			);
 			assert(p.first == c);
+			// ... and the index agrees with the ordered view
+			assert(nodeIndex.find(*c) == n);
 		}
+		assert(nodeIndex.size() == nodeMap.size());
 #endif
 	}
 
 private:
 
+	/// Hash index of the nodes in nodeMap
+	geom::CoordinateHashMap<Node*> nodeIndex;
+
+	/// Adds a node which is not in the map yet
+	void insertNode(Node* n);
+
     // Declare type as noncopyable
     NodeMap(const NodeMap& other);
     NodeMap& operator=(const NodeMap& rhs);
@@ -39,6 +39,20 @@ namespace index { // geos::geomgraph::index
  */
 class GEOS_DLL EdgeSetIntersector {
 public:
+
+	/// The implementations a GeometryGraph can use
+	enum Type {
+		/// SimpleMCSweepLineIntersector, or STRtreeEdgeSetIntersector
+		/// when many chains overlap in x
+		AUTO,
+
+		/// SimpleMCSweepLineIntersector
+		SWEEPLINE,
+
+		/// STRtreeEdgeSetIntersector
+		STRTREE
+	};
+
 	/**
 	 * Computes all self-intersections between edges in a set of edges,
 	 * allowing client to choose whether self-intersections are computed.
@@ -0,0 +1,109 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOMGRAPH_INDEX_STRTREEEDGESETINTERSECTOR_H
+#define GEOS_GEOMGRAPH_INDEX_STRTREEEDGESETINTERSECTOR_H
+
+#include <geos/export.h>
+#include <vector>
+
+#include <geos/geomgraph/index/EdgeSetIntersector.h> // for inheritance
+#include <geos/geom/Envelope.h> // for composition
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geomgraph {
+		class Edge;
+		namespace index {
+			class SegmentIntersector;
+			class MonotoneChainEdge;
+		}
+	}
+}
+
+namespace geos {
+namespace geomgraph { // geos::geomgraph
+namespace index { // geos::geomgraph::index
+
+/** \brief
+ * Finds all intersections in one or two sets of edges, using a
+ * index::strtree::PackedSTRtree of the envelopes of their monotone
+ * chains.
+ *
+ * Unlike SimpleMCSweepLineIntersector, which compares every pair of
+ * chains overlapping in x, only chains with overlapping envelopes are
+ * compared, so long edges spanning much of the x range of the input
+ * (coastlines, rivers) do not make the search quadratic.
+ *
+ * The pairs of chains are compared in the order the sweep line would
+ * compare them, so both find the same intersections in the same order.
+ */
+class GEOS_DLL STRtreeEdgeSetIntersector: public EdgeSetIntersector {
+
+public:
+
+	STRtreeEdgeSetIntersector();
+
+	virtual ~STRtreeEdgeSetIntersector();
+
+	void computeIntersections(std::vector<Edge*> *edges,
+			SegmentIntersector *si, bool testAllSegments);
+
+	void computeIntersections(std::vector<Edge*> *edges0,
+			std::vector<Edge*> *edges1,
+			SegmentIntersector *si);
+
+private:
+
+	/// A monotone chain of an edge, with its position in x order
+	struct Chain {
+		MonotoneChainEdge* mce;
+		int chainIndex;
+		void* edgeSet;
+		geom::Envelope env;
+		std::size_t rank;
+	};
+
+	std::vector<Chain> chains;
+
+	// statistics information
+	int nOverlaps;
+
+	void add(std::vector<Edge*> *edges);
+
+	void add(std::vector<Edge*> *edges, void* edgeSet);
+
+	void add(Edge *edge, void* edgeSet);
+
+	void computeIntersections(SegmentIntersector *si);
+
+	// Declare type as noncopyable
+	STRtreeEdgeSetIntersector(const STRtreeEdgeSetIntersector& other);
+	STRtreeEdgeSetIntersector& operator=(const STRtreeEdgeSetIntersector& rhs);
+};
+
+} // namespace geos.geomgraph.index
+} // namespace geos.geomgraph
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_GEOMGRAPH_INDEX_STRTREEEDGESETINTERSECTOR_H
+
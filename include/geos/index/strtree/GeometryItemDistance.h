@@ -0,0 +1,37 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_INDEX_STRTREE_GEOMETRYITEMDISTANCE_H
+#define GEOS_INDEX_STRTREE_GEOMETRYITEMDISTANCE_H
+
+#include <geos/export.h>
+#include <geos/index/strtree/ItemDistance.h> // for inheritance
+
+namespace geos {
+namespace index { // geos::index
+namespace strtree { // geos::index::strtree
+
+/** \brief
+ * An ItemDistance for items which are geom::Geometry objects,
+ * using the Euclidean distance of the geometries.
+ */
+class GEOS_DLL GeometryItemDistance: public ItemDistance {
+public:
+	double distance(const void* item1, const void* item2);
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
+
+#endif // GEOS_INDEX_STRTREE_GEOMETRYITEMDISTANCE_H
@@ -0,0 +1,51 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_INDEX_STRTREE_ITEMDISTANCE_H
+#define GEOS_INDEX_STRTREE_ITEMDISTANCE_H
+
+#include <geos/export.h>
+
+namespace geos {
+namespace index { // geos::index
+namespace strtree { // geos::index::strtree
+
+/** \brief
+ * A function method which computes the distance
+ * between two items in an STR tree.
+ *
+ * Used by nearest neighbour searches. The distance returned
+ * must never be less than the distance between the envelopes
+ * of the two items, as envelope distances are used to prune
+ * the search.
+ */
+class GEOS_DLL ItemDistance {
+public:
+
+	/**
+	 * Computes the distance between two items.
+	 *
+	 * @param item1 the first item (usually the query item)
+	 * @param item2 an item stored in the tree
+	 * @return the distance between the items
+	 */
+	virtual double distance(const void* item1, const void* item2) = 0;
+
+	virtual ~ItemDistance() {}
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
+
+#endif // GEOS_INDEX_STRTREE_ITEMDISTANCE_H
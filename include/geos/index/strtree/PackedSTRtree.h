@@ -0,0 +1,334 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
+#define GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
+
+#include <geos/export.h>
+#include <geos/index/SpatialIndex.h> // for inheritance
+#include <geos/geom/Envelope.h> // for inlines
+#include <geos/platform.h> // for DoubleInfinity
+
+#include <vector>
+#include <cstddef>
+#include <cassert> // for inlines
+#include <cmath> // for inlines
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace index {
+		class ItemVisitor;
+		namespace strtree {
+			class ItemsList;
+			class ItemDistance;
+		}
+	}
+}
+
+namespace geos {
+namespace index { // geos::index
+namespace strtree { // geos::index::strtree
+
+/**
+ * \brief
+ * A query-only R-tree created using the Sort-Tile-Recursive (STR)
+ * algorithm, stored in flat arrays.
+ *
+ * This is a drop-in alternative to STRtree for the SpatialIndex
+ * interface. Instead of a graph of heap-allocated AbstractNode and
+ * ItemBoundable objects the tree is kept in two contiguous arrays:
+ * one holding the item envelopes (copied on insert, in STR order)
+ * and one holding the nodes, level by level from the leaves up
+ * to the root. Each node records the index range of its children
+ * in the level below, so a query is a loop over contiguous memory
+ * with no virtual calls and no casts.
+ *
+ * Items are inserted before the tree is built.
+ * The tree is built on the first query (or explicitly by #build).
+ * Unlike STRtree, inserting after the tree has been built is
+ * allowed: the node levels are discarded and rebuilt on the next
+ * query.
+ *
+ * Removed items are kept in place with a null envelope, so that
+ * they can never match a query.
+ */
+class GEOS_DLL PackedSTRtree: public SpatialIndex
+{
+public:
+
+	/// Envelope of an item or node, kept as a plain struct
+	struct Bounds {
+		double minX;
+		double minY;
+		double maxX;
+		double maxY;
+
+		bool intersects(const Bounds& o) const {
+			return ! ( o.minX > maxX || o.maxX < minX ||
+			           o.minY > maxY || o.maxY < minY );
+		}
+
+		bool isNull() const { return maxX < minX; }
+
+		void expandToInclude(const Bounds& o) {
+			if ( o.minX < minX ) minX = o.minX;
+			if ( o.minY < minY ) minY = o.minY;
+			if ( o.maxX > maxX ) maxX = o.maxX;
+			if ( o.maxY > maxY ) maxY = o.maxY;
+		}
+
+		/// Euclidean distance between the two boxes, 0 if they intersect
+		double distance(const Bounds& o) const {
+			double dx = 0.0, dy = 0.0;
+			if ( o.minX > maxX ) dx = o.minX - maxX;
+			else if ( minX > o.maxX ) dx = minX - o.maxX;
+			if ( o.minY > maxY ) dy = o.minY - maxY;
+			else if ( minY > o.maxY ) dy = minY - o.maxY;
+			if ( dx == 0.0 ) return dy;
+			if ( dy == 0.0 ) return dx;
+			return std::sqrt(dx * dx + dy * dy);
+		}
+
+		double centreX() const { return (minX + maxX) / 2.0; }
+		double centreY() const { return (minY + maxY) / 2.0; }
+	};
+
+	/// A node of the packed tree
+	struct Node {
+		Bounds bounds;
+
+		/// Index of the first child, in the item array for
+		/// leaf nodes, in the node array otherwise.
+		std::size_t childBegin;
+
+		/// One past the index of the last child
+		std::size_t childEnd;
+	};
+
+	/**
+	 * Constructs a PackedSTRtree with the given maximum number of
+	 * child nodes that a node may have
+	 */
+	PackedSTRtree(std::size_t nodeCapacity=10);
+
+	~PackedSTRtree();
+
+	/// Adds an item, the envelope is copied
+	void insert(const geom::Envelope *itemEnv, void* item);
+
+	void query(const geom::Envelope *searchEnv, std::vector<void*>& matches);
+
+	void query(const geom::Envelope *searchEnv, ItemVisitor& visitor);
+
+	/**
+	 * Queries the tree with many envelopes at once.
+	 *
+	 * Results are returned in compressed sparse row form: the items
+	 * found for searchEnvs[i] are matches[offsets[i]] up to (but
+	 * excluding) matches[offsets[i+1]], in the same order a single
+	 * query would report them.
+	 *
+	 * Internally the queries are run in spatial (STR) order, so that
+	 * consecutive queries walk the same nodes, and can be split in
+	 * chunks across threads. The tree is built, if necessary, before
+	 * any thread is started.
+	 *
+	 * @param searchEnvs the envelopes to query for
+	 * @param offsets set to searchEnvs.size()+1 offsets into matches
+	 * @param matches set to the items found, grouped by query
+	 * @param numThreads threads to use, 0 means one per processor
+	 */
+	void queryBatch(const std::vector<geom::Envelope>& searchEnvs,
+			std::vector<std::size_t>& offsets,
+			std::vector<void*>& matches,
+			unsigned int numThreads=1);
+
+	/// Also builds the tree, if necessary.
+	bool remove(const geom::Envelope *itemEnv, void* item);
+
+	/**
+	 * Sorts the items in STR order and creates the node levels
+	 * up to the root. Called automatically by the first query.
+	 */
+	void build();
+
+	/**
+	 * Finds the item in this tree which is nearest to the given item,
+	 * using a best-first branch-and-bound search.
+	 *
+	 * Envelope distances are used as a lower bound to prune
+	 * subtrees, the given ItemDistance is only evaluated for
+	 * items which might be closer than the best found so far.
+	 * Builds the tree, if necessary.
+	 *
+	 * @param env the envelope of the query item
+	 * @param item the query item, passed to itemDist
+	 * @param itemDist a distance metric applicable to the items
+	 * @return the nearest item, or NULL if the tree is empty
+	 */
+	void* nearestNeighbour(const geom::Envelope* env, const void* item,
+			ItemDistance& itemDist);
+
+	/**
+	 * Finds the k items in this tree which are nearest to the
+	 * given item, closest first.
+	 *
+	 * Ties are broken by tree order, so results are deterministic.
+	 *
+	 * @param env the envelope of the query item
+	 * @param item the query item, passed to itemDist
+	 * @param itemDist a distance metric applicable to the items
+	 * @param k the maximum number of items to return
+	 * @param result vector to append nearest items to
+	 * @param maxDistance items farther than this are not returned
+	 */
+	void nearestNeighbours(const geom::Envelope* env, const void* item,
+			ItemDistance& itemDist, std::size_t k,
+			std::vector<void*>& result,
+			double maxDistance=DoubleInfinity);
+
+	/**
+	 * Finds the pair of items, one of this tree and one of the
+	 * other, which are nearest to each other.
+	 *
+	 * Pairs of nodes are visited best-first, ordered by the distance
+	 * of their envelopes, which is a lower bound of the distance of
+	 * any pair of items below them. The larger node of a pair is
+	 * expanded, and pairs no closer than the best found so far are
+	 * pruned. Builds both trees, if necessary: once built, neither
+	 * tree is modified.
+	 *
+	 * @param other the tree to search against, may be this one
+	 * @param itemDist a distance metric, called with an item of
+	 *        this tree first and an item of the other second
+	 * @param item1 set to the item of this tree, if found
+	 * @param item2 set to the item of the other tree, if found
+	 * @param distance set to the distance of the pair, if found
+	 * @param maxDistance pairs farther than this are not considered
+	 * @param stopDistance the search ends as soon as a pair no
+	 *        farther than this is found, even if there may be a
+	 *        closer one (0 to always find the nearest)
+	 * @return true if a pair within maxDistance was found
+	 */
+	bool nearestNeighbour(PackedSTRtree& other, ItemDistance& itemDist,
+			void*& item1, void*& item2, double& distance,
+			double maxDistance=DoubleInfinity,
+			double stopDistance=0.0);
+
+	/**
+	 * Iterate over all items added thus far (and not removed).
+	 * Explicitly does not build the tree.
+	 */
+	void iterate(ItemVisitor& visitor);
+
+	/**
+	 * Gets a tree structure (as a nested list)
+	 * corresponding to the structure of the items and nodes in this
+	 * tree, in the same format as AbstractSTRtree::itemsTree().
+	 *
+	 * Builds the tree if necessary.
+	 *
+	 * @note The caller is responsible for releasing the list
+	 */
+	ItemsList* itemsTree();
+
+	/// Returns the maximum number of child nodes that a node may have
+	std::size_t getNodeCapacity() const { return nodeCapacity; }
+
+	/// Number of items in the tree, including removed ones
+	std::size_t size() const { return itemBounds.size(); }
+
+	bool isEmpty() const { return itemBounds.empty(); }
+
+	/// Number of nodes in the tree, 0 if not built yet
+	std::size_t getNumNodes() const { return nodes.size(); }
+
+	/**
+	 * Index of the root node in the node array.
+	 * Builds the tree. Must not be called on an empty tree.
+	 */
+	std::size_t getRoot() {
+		if (!built) build();
+		assert(!nodes.empty());
+		return nodes.size()-1;
+	}
+
+	/// True if the given node has items (rather than nodes) as children
+	bool isLeaf(std::size_t node) const { return node < leafCount; }
+
+	const Node& getNode(std::size_t i) const { return nodes[i]; }
+
+	const Bounds& getItemBounds(std::size_t i) const { return itemBounds[i]; }
+
+	void* getItem(std::size_t i) const { return items[i]; }
+
+	static Bounds toBounds(const geom::Envelope& env) {
+		Bounds b;
+		b.minX = env.getMinX(); b.minY = env.getMinY();
+		b.maxX = env.getMaxX(); b.maxY = env.getMaxY();
+		return b;
+	}
+
+private:
+
+	std::size_t nodeCapacity;
+
+	bool built;
+
+	/// Item envelopes, in STR order once built
+	std::vector<Bounds> itemBounds;
+
+	/// Items, parallel to itemBounds
+	std::vector<void*> items;
+
+	/// Nodes, leaves first and root last
+	std::vector<Node> nodes;
+
+	/// Number of leaf nodes (the first leafCount entries of nodes)
+	std::size_t leafCount;
+
+	/// Drops removed items and sorts the others in STR order,
+	/// returns the slice capacity used
+	std::size_t sortItems();
+
+	void createParentLevel(std::size_t levelBegin, std::size_t levelEnd);
+
+	ItemsList* itemsTree(std::size_t node);
+
+	template <class Visitor>
+	void query(const Bounds& searchBounds, std::size_t node,
+			Visitor& visitor) const;
+
+	/// Runs a chunk of a queryBatch call
+	class BatchQueryTask;
+
+	// Declare type as noncopyable
+	PackedSTRtree(const PackedSTRtree& other);
+	PackedSTRtree& operator=(const PackedSTRtree& rhs);
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
+
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
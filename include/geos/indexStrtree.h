@@ -30,8 +30,11 @@ namespace strtree { // geos.index.strtree
 #include <geos/index/strtree/AbstractNode.h>
 #include <geos/index/strtree/AbstractSTRtree.h>
 #include <geos/index/strtree/Boundable.h>
+#include <geos/index/strtree/GeometryItemDistance.h>
 #include <geos/index/strtree/Interval.h>
+#include <geos/index/strtree/ItemDistance.h>
 //#include <geos/index/strtree/ItemBoundable.h>
+#include <geos/index/strtree/PackedSTRtree.h>
 #include <geos/index/strtree/SIRtree.h>
 #include <geos/index/strtree/STRtree.h>
 
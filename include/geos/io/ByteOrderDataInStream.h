@@ -29,6 +29,7 @@
 #include <geos/inline.h>
 
 #include <iosfwd> // ostream, istream (if we remove inlines)
+#include <cstddef> // for size_t
 
 namespace geos {
 namespace io {
@@ -39,6 +40,10 @@ namespace io {
  * Allows reading an stream of primitive datatypes from an underlying
  * istream, with the representation being in either common byte ordering.
  *
+ * Alternatively the data can be read straight from a memory buffer
+ * (see setInBuffer), which avoids the istream overhead and any copy
+ * of the input.
+ *
  */
 class GEOS_DLL ByteOrderDataInStream {
 
@@ -54,6 +59,12 @@ public:
 	 */
 	void setInStream(std::istream *s);
 
+	/**
+	 * Reads from the given memory buffer rather than from an istream.
+	 * The buffer is not copied, it must outlive the reads.
+	 */
+	void setInBuffer(const unsigned char *buf, std::size_t size);
+
 	void setOrder(int order);
 
 	unsigned char readByte(); // throws ParseException
@@ -64,10 +75,26 @@ public:
 
 	double readDouble(); // throws ParseException
 
+	/// Reads n consecutive doubles into out
+	void readDoubles(double *out, std::size_t n); // throws ParseException
+
+	/**
+	 * Returns false if fewer than n bytes are left to read.
+	 * Always true for an istream which can not tell its size.
+	 */
+	bool hasBytes(std::size_t n);
+
 private:
 	int byteOrder;
 	std::istream *stream;
 
+	// input buffer, used when stream is NULL
+	const unsigned char *inBuf;
+	const unsigned char *inBufEnd;
+
+	// returns a pointer to the next n bytes, and skips them
+	const unsigned char *next(std::size_t n); // throws ParseException
+
 	// buffers to hold primitive datatypes
 	unsigned char buf[8];
 
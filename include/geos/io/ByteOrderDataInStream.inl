@@ -35,7 +35,9 @@ INLINE
 ByteOrderDataInStream::ByteOrderDataInStream(std::istream *s)
 	:
 	byteOrder(getMachineByteOrder()),
-	stream(s)
+	stream(s),
+	inBuf(0),
+	inBufEnd(0)
 {
 }
 
@@ -48,6 +50,15 @@ INLINE void
 ByteOrderDataInStream::setInStream(std::istream *s)
 {
 	stream=s;
+	inBuf=inBufEnd=0;
+}
+
+INLINE void 
+ByteOrderDataInStream::setInBuffer(const unsigned char *b, std::size_t size)
+{
+	stream=0;
+	inBuf=b;
+	inBufEnd=b+size;
 }
 
 INLINE void
@@ -56,40 +67,82 @@ ByteOrderDataInStream::setOrder(int order)
 	byteOrder=order;
 }
 
+INLINE const unsigned char *
+ByteOrderDataInStream::next(std::size_t n)
+{
+	if ( stream )
+	{
+		stream->read(reinterpret_cast<char *>(buf), n);
+		if ( stream->eof() )
+			throw  ParseException("Unexpected EOF parsing WKB");
+		return buf;
+	}
+
+	if ( static_cast<std::size_t>(inBufEnd - inBuf) < n )
+		throw  ParseException("Unexpected EOF parsing WKB");
+	const unsigned char *ret = inBuf;
+	inBuf += n;
+	return ret;
+}
+
 INLINE unsigned char
 ByteOrderDataInStream::readByte() // throws ParseException
 {
-	stream->read(reinterpret_cast<char *>(buf), 1);
-	if ( stream->eof() )
-		throw  ParseException("Unexpected EOF parsing WKB");
-	return buf[0];
+	return *next(1);
 }
 
 INLINE int
 ByteOrderDataInStream::readInt() 
 {
-	stream->read(reinterpret_cast<char *>(buf), 4);
-	if ( stream->eof() )
-		throw  ParseException("Unexpected EOF parsing WKB");
-	return ByteOrderValues::getInt(buf, byteOrder);
+	return ByteOrderValues::getInt(next(4), byteOrder);
 }
 
 INLINE long
 ByteOrderDataInStream::readLong() 
 {
-	stream->read(reinterpret_cast<char *>(buf), 8);
-	if ( stream->eof() )
-		throw  ParseException("Unexpected EOF parsing WKB");
-	return static_cast<long>(ByteOrderValues::getLong(buf, byteOrder));
+	return static_cast<long>(ByteOrderValues::getLong(next(8), byteOrder));
 }
 
 INLINE double
 ByteOrderDataInStream::readDouble() 
 {
-	stream->read(reinterpret_cast<char *>(buf), 8);
-	if ( stream->eof() )
+	return ByteOrderValues::getDouble(next(8), byteOrder);
+}
+
+INLINE void
+ByteOrderDataInStream::readDoubles(double *out, std::size_t n)
+{
+	const std::size_t nbytes = n * sizeof(double);
+	if ( stream )
+	{
+		// read the raw bytes in place, then decode them there
+		stream->read(reinterpret_cast<char *>(out), nbytes);
+		if ( static_cast<std::size_t>(stream->gcount()) != nbytes )
+			throw  ParseException("Unexpected EOF parsing WKB");
+		ByteOrderValues::getDoubles(reinterpret_cast<unsigned char *>(out),
+		                            out, n, byteOrder);
+		return;
+	}
+
+	if ( static_cast<std::size_t>(inBufEnd - inBuf) < nbytes )
 		throw  ParseException("Unexpected EOF parsing WKB");
-	return ByteOrderValues::getDouble(buf, byteOrder);
+	ByteOrderValues::getDoubles(inBuf, out, n, byteOrder);
+	inBuf += nbytes;
+}
+
+INLINE bool
+ByteOrderDataInStream::hasBytes(std::size_t n)
+{
+	if ( ! stream )
+		return static_cast<std::size_t>(inBufEnd - inBuf) >= n;
+
+	const std::istream::pos_type cur = stream->tellg();
+	if ( cur == std::istream::pos_type(-1) ) return true;
+	stream->seekg(0, std::ios::end);
+	const std::istream::pos_type end = stream->tellg();
+	stream->seekg(cur);
+	if ( end == std::istream::pos_type(-1) ) return true;
+	return static_cast<std::size_t>(end - cur) >= n;
 }
 
 } // namespace io
@@ -24,6 +24,8 @@
 #include <geos/export.h>
 #include <geos/platform.h>
 
+#include <cstddef>
+
 namespace geos {
 namespace io {
 
@@ -54,6 +56,17 @@ public:
 	static double getDouble(const unsigned char *buf, int byteOrder);
 	static void putDouble(double doubleValue, unsigned char *buf, int byteOrder);
 
+	/**
+	 * Decodes n consecutive doubles from buf into out.
+	 *
+	 * When byteOrder matches the machine byte order this is a
+	 * single memcpy, otherwise each value is swapped with the
+	 * compiler byte swap builtin, when available.
+	 * buf and out may point to the same memory.
+	 */
+	static void getDoubles(const unsigned char *buf, double *out,
+			std::size_t n, int byteOrder);
+
 };
 
 } // namespace io
@@ -0,0 +1,212 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_IO_GEOMETRYSTREAMREADER_H
+#define GEOS_IO_GEOMETRYSTREAMREADER_H
+
+#include <geos/export.h>
+
+#include <vector>
+#include <memory> // for auto_ptr
+#include <cstddef> // for size_t
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geom {
+		class Geometry;
+		class GeometryFactory;
+	}
+}
+
+namespace geos {
+namespace io { // geos::io
+
+/**
+ * \class GeometryStreamReader
+ *
+ * \brief
+ * Reads a sequence of geometries, one record at a time, from a file
+ * descriptor or a memory region (such as a memory-mapped file).
+ *
+ * Supported record formats are:
+ *
+ * - WKT: one geometry per line
+ * - HEXWKB: one hex-encoded WKB geometry per line
+ * - WKB: each geometry preceded by its size in bytes,
+ *   as a 4 byte little endian integer
+ *
+ * In the line based formats empty lines are skipped and a trailing
+ * carriage return is ignored.
+ *
+ * The parsers and buffers are reused from a record to the next.
+ * Input is read in blocks, and memory use is bounded by the size of
+ * the largest record (and, when parsing in parallel, by the chunk
+ * size), not by the size of the input.
+ *
+ * Geometries can be pulled one at a time with #next or pushed
+ * to a Handler by #readAll, which can parse chunks of records on
+ * several threads while still delivering them in input order.
+ *
+ * A GeometryStreamReader must not be used by several threads at once.
+ */
+class GEOS_DLL GeometryStreamReader {
+
+public:
+
+	enum Format {
+		WKT,
+		HEXWKB,
+		WKB
+	};
+
+	/// Receives the geometries read by #readAll
+	class GEOS_DLL Handler {
+	public:
+		/**
+		 * Called once per record, in input order.
+		 *
+		 * @param g the geometry read, ownership is transferred
+		 * @return false to stop reading
+		 */
+		virtual bool handle(std::auto_ptr<geom::Geometry> g)=0;
+
+		virtual ~Handler() {}
+	};
+
+	/**
+	 * @param f the factory used to create geometries, must
+	 *          outlive the reader
+	 * @param format the record format of the input
+	 */
+	GeometryStreamReader(const geom::GeometryFactory& f, Format format);
+
+	~GeometryStreamReader();
+
+	/**
+	 * Reads from the given file descriptor, up to its end.
+	 * The descriptor is not closed.
+	 */
+	void setInput(int fd);
+
+	/**
+	 * Reads from the given memory region, which is not copied
+	 * and must outlive the reads.
+	 */
+	void setInput(const char* buf, std::size_t size);
+
+	/**
+	 * Reads the next geometry.
+	 *
+	 * @return the geometry, or a null pointer at end of input
+	 * @throws ParseException if the record is malformed
+	 */
+	std::auto_ptr<geom::Geometry> next();
+
+	/**
+	 * Reads all remaining geometries and hands them to h,
+	 * in input order.
+	 *
+	 * With more than one thread, records are collected in chunks
+	 * (see #setChunkSize), and each chunk is parsed in parallel
+	 * before being handed out.
+	 *
+	 * @param h the handler to pass geometries to
+	 * @param numThreads threads to parse with, 0 means one per
+	 *        processor
+	 * @return the number of geometries handed to h
+	 * @throws ParseException if a record is malformed, after the
+	 *         geometries preceding it have been handed out.
+	 *         getRecordCount() then gives the number of the bad record.
+	 *
+	 * When h stops the reading, records of the current chunk
+	 * following the stopping one are discarded.
+	 */
+	std::size_t readAll(Handler& h, unsigned int numThreads=1);
+
+	/// Number of records kept in memory at once by a parallel #readAll
+	void setChunkSize(std::size_t n) { chunkSize = n ? n : 1; }
+
+	/// Number of records read since the input was set
+	std::size_t getRecordCount() const { return recordCount; }
+
+private:
+
+	/// Parser state for one thread
+	class Parser;
+
+	/// Parses a chunk of records on several threads
+	class ChunkTask;
+
+	const geom::GeometryFactory& factory;
+
+	Format format;
+
+	/// Input descriptor, -1 when reading from memory
+	int fd;
+
+	/// True once read() reported the end of fd
+	bool inputDone;
+
+	/// Block buffer for reads from fd
+	std::vector<char> buf;
+
+	/// Unconsumed input, in buf or in the user memory region
+	const char* cur;
+	const char* end;
+
+	std::size_t recordCount;
+
+	std::size_t chunkSize;
+
+	/// Parsers, the first one also used by #next
+	std::vector<Parser*> parsers;
+
+	/// Raw records of a parallel chunk, and their offsets
+	std::vector<char> chunkData;
+	std::vector<std::size_t> chunkOffsets;
+
+	/**
+	 * Makes more input available after cur.
+	 * Pending input is kept, cur and end may be moved.
+	 * @return false at end of input
+	 */
+	bool fill();
+
+	/// Finds the next record, valid until the following call
+	bool nextRecord(const char*& data, std::size_t& len);
+
+	bool nextLine(const char*& data, std::size_t& len);
+
+	bool nextSized(const char*& data, std::size_t& len);
+
+	/// Ensures there are at least n parsers
+	void createParsers(std::size_t n);
+
+	// Declare type as noncopyable
+	GeometryStreamReader(const GeometryStreamReader& other);
+	GeometryStreamReader& operator=(const GeometryStreamReader& rhs);
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_IO_GEOMETRYSTREAMREADER_H
@@ -47,6 +47,11 @@ public:
 
 	~ParseException() throw() {};
 
+	// See GEOSException
+	ParseException* clone() const { return new ParseException(*this); }
+
+	void raise() const { throw *this; }
+
 private:
 	static std::string stringify(double num);
 };
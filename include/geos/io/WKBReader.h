@@ -27,6 +27,7 @@
 #include <geos/io/ByteOrderDataInStream.h> // for composition
 
 #include <iosfwd> // ostream, istream
+#include <cstddef> // for size_t
 #include <vector>
 #include <string>
 
@@ -97,6 +98,20 @@ public:
 	geom::Geometry* read(std::istream &is);
 		// throws IOException, ParseException
 
+	/**
+	 * \brief Reads a Geometry from a memory buffer.
+	 *
+	 * The WKB is decoded straight from the buffer, without
+	 * copying it or going through an istream.
+	 *
+	 * @param buf the WKB bytes
+	 * @param size the number of bytes in buf
+	 * @return the Geometry read
+	 * @throws ParseException
+	 */
+	geom::Geometry* read(const unsigned char *buf, std::size_t size);
+		// throws ParseException
+
 	/**
 	 * \brief Reads a Geometry from an istream in hex format.
 	 *
@@ -127,6 +142,9 @@ private:
 
 	std::vector<double> ordValues;
 
+	// scratch space for readCoordinateSequence
+	std::vector<double> seqValues;
+
 	geom::Geometry *readGeometry();
 		// throws IOException, ParseException
 
@@ -156,6 +174,11 @@ private:
 
 	geom::CoordinateSequence *readCoordinateSequence(int); // throws IOException
 
+	/// Checks a count read from the input before allocating for it,
+	/// each item taking at least itemBytes
+	void checkCount(int count, std::size_t itemBytes);
+		// throws ParseException
+
 	void readCoordinate(); // throws IOException
 
     // Declare type as noncopyable
@@ -28,6 +28,7 @@
 namespace geos {
 	namespace noding { 
 		class SegmentIntersectionDetector;
+		class SegmentIntersector;
 		class SegmentSetMutualIntersector;
 		//class MCIndexSegmentSetMutualIntersector : public SegmentSetMutualIntersector;
 	}
@@ -44,13 +45,15 @@ namespace noding { // geos::noding
  * against a target set of lines.
  * Short-circuited to return as soon an intersection is found.
  *
+ * Once constructed, the intersects methods can be called from
+ * several threads at once.
+ *
  * @version 1.7
  */
 class FastSegmentSetIntersectionFinder
 {
 private:
 	MCIndexSegmentSetMutualIntersector * segSetMutInt; 
-	geos::algorithm::LineIntersector * lineIntersector;
 
 protected:
 public:
@@ -72,6 +75,17 @@ public:
 	bool intersects( SegmentString::ConstVect * segStrings);
 	bool intersects( SegmentString::ConstVect * segStrings, SegmentIntersectionDetector * intDetector);
 
+	/**
+	 * Passes the pairs of segments, one of the given segment strings
+	 * and one of the base ones, whose envelopes intersect to a
+	 * SegmentIntersector, given segment string first, until it
+	 * reports it is done.
+	 *
+	 * Only reads the index, so it may be called by several threads
+	 * at once, each with its own SegmentIntersector.
+	 */
+	void process( SegmentString::ConstVect * segStrings, SegmentIntersector & si) const;
+
 };
 
 } // geos::noding
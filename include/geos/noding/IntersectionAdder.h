@@ -38,6 +38,7 @@ namespace geos {
 	}
 	namespace noding {
 		class SegmentString;
+		class NodedSegmentString;
 	}
 	namespace algorithm {
 		class LineIntersector;
@@ -174,6 +175,22 @@ public:
 	virtual bool isDone() const {
 		return false;
 	}
+
+	/**
+	 * Adds the intersection counts and flags of another
+	 * IntersectionAdder, which processed other segments.
+	 */
+	void addCounts(const IntersectionAdder& other);
+
+protected:
+
+	/**
+	 * Adds the intersections found by the LineIntersector to
+	 * a segment string, as nodes of its segment geomIndex.
+	 * Overridden to collect the nodes elsewhere.
+	 */
+	virtual void addIntersections(NodedSegmentString* ss, int segIndex,
+	                              int geomIndex);
 };
  
 
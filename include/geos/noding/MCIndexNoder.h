@@ -26,7 +26,7 @@
 
 #include <geos/index/chain/MonotoneChainOverlapAction.h> // for inheritance
 #include <geos/noding/SinglePassNoder.h> // for inheritance
-#include <geos/index/strtree/STRtree.h> // for composition
+#include <geos/index/strtree/PackedSTRtree.h> // for composition
 #include <geos/util.h>
 
 #include <vector>
@@ -45,6 +45,7 @@ namespace geos {
 	namespace noding {
 		class SegmentString;
 		class SegmentIntersector;
+		class IntersectionAdder;
 	}
 }
 
@@ -57,7 +58,14 @@ namespace noding { // geos.noding
  *
  * The {@link SpatialIndex} used should be something that supports
  * envelope (range) queries efficiently (such as a index::quadtree::Quadtree
- * or index::strtree::STRtree.
+ * or index::strtree::PackedSTRtree.
+ *
+ * When the SegmentIntersector is an IntersectionAdder, the overlaps
+ * of the chains may be searched by several threads (see
+ * #setNumThreads): the chains are split into blocks, each block
+ * collecting the nodes it finds in its own buffer. The buffers are
+ * then added to the segment strings in block order, so that the
+ * result is the same as when noding with a single thread.
  *
  * Last port: noding/MCIndexNoder.java rev. 1.4 (JTS-1.7)
  */
@@ -65,14 +73,19 @@ class GEOS_DLL MCIndexNoder : public SinglePassNoder {
 
 private:
 	std::vector<index::chain::MonotoneChain*> monoChains;
-	index::strtree::STRtree index;
+	index::strtree::PackedSTRtree index;
 	int idCounter;
 	std::vector<SegmentString*>* nodedSegStrings;
 	// statistics
 	int nOverlaps;
+	unsigned int numThreads;
+
+	class ChainBlockTask;
 
 	void intersectChains();
 
+	void intersectChains(IntersectionAdder& adder, unsigned int threads);
+
 	void add(SegmentString* segStr);
 
 public:
@@ -82,7 +95,8 @@ public:
 		SinglePassNoder(nSegInt),
 		idCounter(0),
 		nodedSegStrings(NULL),
-		nOverlaps(0)
+		nOverlaps(0),
+		numThreads(1)
 	{}
 
 	~MCIndexNoder();
@@ -96,6 +110,18 @@ public:
 
 	void computeNodes(std::vector<SegmentString*>* inputSegmentStrings);
 
+	/**
+	 * Sets the number of threads searching the overlaps of the
+	 * chains, including the calling one. The default is 1, 0 means
+	 * one per available processor.
+	 *
+	 * Only used when the SegmentIntersector is an IntersectionAdder,
+	 * other ones are always run by the calling thread.
+	 *
+	 * @param n the number of threads
+	 */
+	void setNumThreads(unsigned int n) { numThreads = n; }
+
 	class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
 	public:
 		SegmentOverlapAction(SegmentIntersector& newSi)
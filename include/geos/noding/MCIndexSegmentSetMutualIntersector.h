@@ -22,6 +22,7 @@
 
 #include <geos/noding/SegmentSetMutualIntersector.h> // inherited
 #include <geos/index/chain/MonotoneChainOverlapAction.h> // inherited
+#include <geos/index/strtree/PackedSTRtree.h> // for getIndex
 
 namespace geos {
 	namespace index {
@@ -30,9 +31,6 @@ namespace geos {
 		namespace chain {
 			class MonotoneChain;
 		}
-		namespace strtree {
-			//class STRtree;
-		}
 	}
 	namespace noding {
 		class SegmentString;
@@ -73,11 +71,23 @@ public:
 		return index; 
 	}
 
+	/// Indexes the base segments, the index is built right away
 	void setBaseSegments(SegmentString::ConstVect* segStrings);
   
 	// NOTE: re-populates the MonotoneChain vector with newly created chains
 	void process(SegmentString::ConstVect* segStrings);
 
+	/**
+	 * Computes the intersections of segStrings with the base segments,
+	 * reporting them to si.
+	 *
+	 * Unlike process(SegmentString::ConstVect*), this leaves the
+	 * intersector unchanged, so several threads can call it at once,
+	 * each with its own SegmentIntersector.
+	 */
+	void process(SegmentString::ConstVect* segStrings,
+	             SegmentIntersector& si) const;
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction
     {
     private:
@@ -106,7 +116,7 @@ private:
 	 * envelope (range) queries efficiently (such as a {@link Quadtree}
 	 * or {@link STRtree}.
 	 */
-	index::SpatialIndex * index;
+	index::strtree::PackedSTRtree * index;
 	int indexCounter;
 	int processCounter;
 	// statistics
@@ -121,6 +131,9 @@ private:
 
 	void intersectChains();
 
+	void intersectChains(const MonoChains& chains,
+	                     SegmentIntersector& si) const;
+
 	void addToMonoChains( SegmentString * segStr);
 
 };
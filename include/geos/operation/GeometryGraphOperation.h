@@ -23,6 +23,8 @@
 
 #include <geos/export.h>
 #include <geos/algorithm/LineIntersector.h> // for composition
+#include <geos/util/Arena.h> // for composition
+#include <geos/geomgraph/index/EdgeSetIntersector.h> // for Type
 
 #include <vector>
 
@@ -67,8 +69,25 @@ public:
 
 	const geom::Geometry* getArgGeometry(unsigned int i) const;
 
+	/**
+	 * Sets how the graphs of the arguments find the intersections
+	 * of their edges, see geomgraph::GeometryGraph::setEdgeSetIntersectorType.
+	 * Must be called before computing the result.
+	 */
+	void setEdgeSetIntersectorType(
+			geomgraph::index::EdgeSetIntersector::Type type);
+
 protected:
 
+	/** \brief
+	 * Memory for the graph components built by the operation.
+	 *
+	 * Declared first so that it is destroyed last, after the
+	 * graphs referencing it. Subclasses make it current with a
+	 * util::Arena::Scope while building their graphs.
+	 */
+	util::Arena arena;
+
 	algorithm::LineIntersector li;
 
 	const geom::PrecisionModel* resultPrecisionModel;
@@ -29,6 +29,7 @@
 #include <geos/operation/buffer/BufferOp.h> // for inlines (BufferOp enums)
 #include <geos/operation/buffer/OffsetCurveBuilder.h> // for inline (OffsetCurveBuilder enums)
 #include <geos/geomgraph/EdgeList.h> // for composition
+#include <geos/util/Arena.h> // for composition
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -150,6 +151,10 @@ private:
 	 */
 	static int depthDelta(geomgraph::Label *label);
 
+	/// Memory for the graph components, declared first
+	/// so that it outlives them
+	util::Arena arena;
+
 	const BufferParameters& bufParams; 
 
 	const geom::PrecisionModel* workingPrecisionModel;
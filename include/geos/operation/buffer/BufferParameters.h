@@ -274,6 +274,25 @@ public:
 	  return _isSingleSided;
 	}
 
+	/**
+	 * Sets the number of threads noding the offset curves,
+	 * including the calling one. 0 means one per available
+	 * processor.
+	 *
+	 * The result does not depend on the number of threads.
+	 *
+	 * @param n the number of threads, defaults to 1
+	 */
+	void setNumThreads(unsigned int n)
+	{
+	  numThreads = n;
+	}
+
+	/// Gets the number of threads noding the offset curves
+	unsigned int getNumThreads() const {
+	  return numThreads;
+	}
+
 
 private:
 
@@ -290,6 +309,9 @@ private:
 	double mitreLimit;
 
 	bool _isSingleSided;
+
+	/// Defaults to 1
+	unsigned int numThreads;
 };
 
 } // namespace geos::operation::buffer
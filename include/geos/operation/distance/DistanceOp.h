@@ -67,9 +67,10 @@ namespace distance { // geos::operation::distance
  * the coordinate computed is a close
  * approximation to the exact point.
  * 
- * The algorithms used are straightforward O(n^2)
- * comparisons.  This worst-case performance could be improved on
- * by using Voronoi techniques or spatial indexes.
+ * Small inputs are compared with straightforward O(n^2) algorithms.
+ * For larger ones the facets of both geometries are indexed, and
+ * only the pairs of facets whose envelopes are close enough are
+ * compared (see IndexedFacetDistance).
  *
  */
 class GEOS_DLL DistanceOp {
@@ -96,10 +97,15 @@ public:
 	 * Test whether two geometries lie within a given distance of
 	 * each other.
 	 *
+	 * Geometries whose envelopes are further apart are rejected
+	 * upfront, otherwise the search for the nearest points stops
+	 * at the first pair found within the distance.
+	 *
 	 * @param g0 a {@link Geometry}
 	 * @param g1 another {@link Geometry}
 	 * @param distance the distance to test
-	 * @return true if g0.distance(g1) <= distance
+	 * @return true if g0.distance(g1) <= distance, so
+	 *         true if either geometry is empty and distance >= 0
 	 */
 	static bool isWithinDistance(const geom::Geometry& g0,
 	                             const geom::Geometry& g1,
@@ -194,6 +200,17 @@ public:
 	 */
 	geom::CoordinateSequence* nearestPoints();
 
+	/**
+	 * \brief
+	 * Sets whether the facet distance of large inputs is computed
+	 * using spatial indexes (the default).
+	 *
+	 * If false, every facet of a geometry is compared to every
+	 * facet of the other one.
+	 * Must be called before computing the distance.
+	 */
+	void setIndexed(bool isIndexed) { indexed = isIndexed; }
+
 private:
 
 	/**
@@ -214,6 +231,8 @@ private:
 	std::vector<geom::Geometry const*> geom;
 	double terminateDistance; 
 
+	bool indexed;
+
 	// working 
 	algorithm::PointLocator ptLocator;
 	// TODO: use auto_ptr
@@ -245,6 +264,12 @@ private:
 	 */
 	void computeFacetDistance();
 
+	/**
+	 * Computes distance between facets of input geometries
+	 * using an IndexedFacetDistance.
+	 */
+	void computeFacetDistanceIndexed();
+
 	void computeMinDistanceLines(
 			const std::vector<const geom::LineString*>& lines0,
 			const std::vector<const geom::LineString*>& lines1,
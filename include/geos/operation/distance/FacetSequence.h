@@ -0,0 +1,145 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: operation/distance/FacetSequence.java (JTS-1.13)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_DISTANCE_FACETSEQUENCE_H
+#define GEOS_OP_DISTANCE_FACETSEQUENCE_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h> // for composition
+
+#include <vector>
+#include <cstddef>
+
+// Forward declarations
+namespace geos {
+	namespace geom { 
+		class CoordinateSequence;
+		class Geometry;
+	}
+	namespace operation { 
+		namespace distance { 
+			class GeometryLocation;
+		}
+	}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace distance { // geos::operation::distance
+
+/**
+ * \brief
+ * Represents a sequence of facets (points or line segments)
+ * of a {@link Geometry}, specified by a subsequence of a
+ * {@link CoordinateSequence}.
+ *
+ * The coordinate sequence is not copied, it must outlive
+ * the FacetSequence.
+ */
+class GEOS_DLL FacetSequence {
+public:
+
+	/**
+	 * Creates a new sequence of facets based on a
+	 * {@link CoordinateSequence}.
+	 *
+	 * @param pts the sequence holding the facet vertices
+	 * @param start the index of the start point
+	 * @param end the index of the end point + 1
+	 */
+	FacetSequence(const geom::CoordinateSequence* pts,
+	              std::size_t start, std::size_t end);
+
+	/**
+	 * Creates a new sequence of facets of a component of a
+	 * {@link Geometry}, so that the nearest locations can be
+	 * reported.
+	 *
+	 * @param geom the LineString or Point holding pts
+	 * @param pts the sequence holding the facet vertices
+	 * @param start the index of the start point
+	 * @param end the index of the end point + 1
+	 */
+	FacetSequence(const geom::Geometry* geom,
+	              const geom::CoordinateSequence* pts,
+	              std::size_t start, std::size_t end);
+
+	/// The envelope of the facet vertices
+	const geom::Envelope* getEnvelope() const { return &env; }
+
+	/// The number of vertices in the sequence
+	std::size_t size() const { return end - start; }
+
+	/// True if the sequence is a single point
+	bool isPoint() const { return end - start == 1; }
+
+	/**
+	 * Computes the minimum distance between the facets of
+	 * this sequence and those of another.
+	 */
+	double distance(const FacetSequence& facetSeq) const;
+
+	/**
+	 * Computes the locations of the nearest points between the facets
+	 * of this sequence and those of another.
+	 *
+	 * The segment indexes of the locations are those in the
+	 * components, as for DistanceOp.
+	 *
+	 * @param facetSeq the other sequence
+	 * @param locs set to two new GeometryLocations, the one on this
+	 *        sequence first, to be deleted by the caller
+	 * @return the distance between the nearest points
+	 */
+	double nearestLocations(const FacetSequence& facetSeq,
+	                        std::vector<GeometryLocation*>& locs) const;
+
+private:
+
+	const geom::Geometry* geom;
+
+	const geom::CoordinateSequence* pts;
+
+	std::size_t start;
+
+	std::size_t end;
+
+	geom::Envelope env;
+
+	double computePointLineDistance(const FacetSequence& facetSeq) const;
+
+	double computeLineLineDistance(const FacetSequence& facetSeq) const;
+
+	/// Finds the segment nearest to pt, returns its distance
+	double findNearestSegment(const geom::Coordinate& pt,
+	                          std::size_t& segIndex) const;
+
+	/// Finds the nearest pair of segments, returns their distance
+	double findNearestSegments(const FacetSequence& facetSeq,
+	                           std::size_t& segIndex,
+	                           std::size_t& otherSegIndex) const;
+
+	/// Location of the point nearest to pt, on a segment of this sequence
+	GeometryLocation* locateNearest(const geom::Coordinate& pt,
+	                                std::size_t& segIndex) const;
+};
+
+} // namespace geos::operation::distance
+} // namespace geos::operation
+} // namespace geos
+
+#endif // GEOS_OP_DISTANCE_FACETSEQUENCE_H
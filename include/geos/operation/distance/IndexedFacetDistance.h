@@ -0,0 +1,190 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: operation/distance/IndexedFacetDistance.java (JTS-1.13)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_DISTANCE_INDEXEDFACETDISTANCE_H
+#define GEOS_OP_DISTANCE_INDEXEDFACETDISTANCE_H
+
+#include <geos/export.h>
+#include <geos/operation/distance/FacetSequence.h> // for composition
+#include <geos/index/strtree/PackedSTRtree.h> // for composition
+
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geom { 
+		class Geometry;
+	}
+	namespace operation { 
+		namespace distance { 
+			class GeometryLocation;
+		}
+	}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace distance { // geos::operation::distance
+
+/**
+ * \brief
+ * Computes the distance between the facets (segments and vertices)
+ * of two {@link Geometry}s using a Branch-and-Bound algorithm.
+ *
+ * The facets of each geometry are grouped in short
+ * {@link FacetSequence}s, which are indexed in a PackedSTRtree.
+ * The distance is found by a best-first traversal of both trees,
+ * ordered by envelope distance (see PackedSTRtree::nearestNeighbour),
+ * so that only the facets close to the other geometry are compared.
+ *
+ * This is much faster than the brute-force approach of DistanceOp
+ * for large geometries, in particular when one of them is reused
+ * for several distance computations: the index of the geometry
+ * given to the constructor is kept, only the one of the query
+ * geometry is built on each call.
+ *
+ * The distance computed is between the facets: for areal geometries
+ * it is <b>not</b> 0 when one geometry lies in the interior of the
+ * other, callers needing the full Geometry distance semantics have
+ * to test containment first.
+ *
+ * The index is built on construction and only read afterwards, so
+ * an IndexedFacetDistance may be queried by several threads at once.
+ * The geometry must outlive the IndexedFacetDistance.
+ */
+class GEOS_DLL IndexedFacetDistance {
+public:
+
+	/**
+	 * Computes the distance between the facets of two geometries.
+	 *
+	 * @return 0 if either geometry is empty
+	 */
+	static double distance(const geom::Geometry* g1,
+	                       const geom::Geometry* g2);
+
+	/**
+	 * Creates a new distance-finding instance for a given
+	 * target {@link Geometry}, indexing its facets.
+	 */
+	IndexedFacetDistance(const geom::Geometry* g);
+
+	~IndexedFacetDistance();
+
+	/**
+	 * Computes the distance from the facets of the target geometry
+	 * to those of the given one.
+	 *
+	 * @return 0 if either geometry is empty
+	 */
+	double getDistance(const geom::Geometry* g) const;
+
+	/**
+	 * Tests whether the facets of the given geometry are within
+	 * maxDistance of those of the target geometry.
+	 *
+	 * The search stops at the first pair of facets found within
+	 * maxDistance, rather than looking for the closest one.
+	 *
+	 * @return true if either geometry is empty
+	 */
+	bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
+	/**
+	 * Computes the locations of the nearest points between the facets
+	 * of the target geometry and those of the given one, as
+	 * DistanceOp does.
+	 *
+	 * The search stops at the first pair of facets found within
+	 * stopDistance.
+	 *
+	 * @param g the geometry to compute the locations to
+	 * @param locs set to two new GeometryLocations, the one on the
+	 *        target geometry first, to be deleted by the caller
+	 * @param dist set to the distance between the locations
+	 * @param maxDistance only facets within this distance are considered
+	 * @param stopDistance the distance on which to terminate the search
+	 * @return false, leaving locs untouched, if either geometry is
+	 *         empty or no facets are within maxDistance
+	 */
+	bool nearestLocations(const geom::Geometry* g,
+	                      std::vector<GeometryLocation*>& locs,
+	                      double& dist, double maxDistance,
+	                      double stopDistance) const;
+
+	/// Number of facet sequences indexed
+	std::size_t getNumFacetSequences() const { return facets.size(); }
+
+	/**
+	 * Appends the facet sequences of the lines and points
+	 * making up a geometry. The CoordinateSequences of the
+	 * geometry are referenced, not copied.
+	 */
+	static void computeFacetSequences(const geom::Geometry& g,
+	                                  std::vector<FacetSequence>& sections);
+
+private:
+
+	std::vector<FacetSequence> facets;
+
+	/// Built on construction, not modified afterwards
+	mutable index::strtree::PackedSTRtree tree;
+
+	/**
+	 * Finds the distance between the facets of g and the target
+	 * ones, stopping as soon as a distance <= stopDistance is
+	 * found.
+	 *
+	 * @return false if no facets of g are within maxDistance
+	 */
+	bool distance(const geom::Geometry* g, double maxDistance,
+	              double stopDistance, double& dist) const;
+
+	/**
+	 * Finds the nearest pair of facet sequences, appending those
+	 * of g to sections, which must outlive test.
+	 *
+	 * target and test are set to 0 if either geometry is empty.
+	 */
+	bool nearestFacets(const geom::Geometry* g,
+	                   std::vector<FacetSequence>& sections,
+	                   double maxDistance, double stopDistance,
+	                   const FacetSequence*& target,
+	                   const FacetSequence*& test, double& dist) const;
+
+	static void insertFacetSequences(std::vector<FacetSequence>& sections,
+	                                 index::strtree::PackedSTRtree& tree);
+
+	// Declare type as noncopyable
+	IndexedFacetDistance(const IndexedFacetDistance& other);
+	IndexedFacetDistance& operator=(const IndexedFacetDistance& rhs);
+};
+
+} // namespace geos::operation::distance
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_DISTANCE_INDEXEDFACETDISTANCE_H
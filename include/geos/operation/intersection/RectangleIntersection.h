@@ -0,0 +1,158 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_INTERSECTION_RECTANGLEINTERSECTION_H
+#define GEOS_OP_INTERSECTION_RECTANGLEINTERSECTION_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h> // for composition
+
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geom {
+		class Coordinate;
+		class Geometry;
+		class LineString;
+		class Polygon;
+	}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace intersection { // geos::operation::intersection
+
+/** \brief
+ * Clips geometries to an axis-aligned rectangle, without the noding,
+ * graph and labelling of the overlay used by Geometry::intersection.
+ *
+ * Points are kept when in the rectangle or on its boundary. Lines are
+ * clipped segment by segment. The rings of polygons are cut into the
+ * pieces inside the rectangle, which are then joined along the
+ * rectangle boundary into the rings of the result.
+ *
+ * Components whose intersection has parts of lower dimension (touching
+ * the boundary from outside, running along it with the interior
+ * outside, or a rectangle of zero width or height), or whose rings
+ * would touch the boundary or each other ambiguously, are intersected
+ * by the overlay instead.
+ *
+ * The result covers the same points as Geometry::intersection, but is
+ * not necessarily split the same way: a clipped line is not split
+ * where it crosses itself. Polygons are expected to be valid.
+ *
+ * Clipping many geometries to the same rectangle can reuse one
+ * instance, which can also be shared by several threads.
+ */
+class GEOS_DLL RectangleIntersection {
+
+public:
+
+	/**
+	 * Creates a clipper for a rectangle.
+	 *
+	 * @param rect the rectangle, copied
+	 */
+	RectangleIntersection(const geom::Envelope& rect);
+
+	/**
+	 * Clips a geometry to the rectangle.
+	 *
+	 * @param geom the geometry to clip
+	 * @return the part of geom in the rectangle, possibly empty
+	 */
+	std::auto_ptr<geom::Geometry> clip(const geom::Geometry& geom) const;
+
+	/**
+	 * Clips a geometry to a rectangle.
+	 *
+	 * @param geom the geometry to clip
+	 * @param rect the rectangle
+	 * @return the part of geom in the rectangle, possibly empty
+	 */
+	static std::auto_ptr<geom::Geometry> clip(const geom::Geometry& geom,
+			const geom::Envelope& rect);
+
+private:
+
+	const geom::Envelope rect;
+
+	/// Adds the clipped parts of geom
+	void addClipped(const geom::Geometry& geom,
+			std::vector<geom::Geometry*>& parts) const;
+
+	/// Adds the overlay of geom with the rectangle
+	void addOverlay(const geom::Geometry& geom,
+			std::vector<geom::Geometry*>& parts) const;
+
+	/// @return false if line touches the boundary without crossing it
+	bool clipLine(const geom::LineString& line,
+			std::vector<geom::Geometry*>& parts) const;
+
+	/// @return false if a ring touches the boundary without crossing it
+	bool clipPolygon(const geom::Polygon& poly,
+			std::vector<geom::Geometry*>& parts) const;
+
+	/// @return true if p is on the boundary of the rectangle
+	bool isOnBoundary(const geom::Coordinate& p) const;
+
+	/**
+	 * Computes the part of segment p0-p1 in the rectangle.
+	 * The end points of that part are exactly on the boundary when
+	 * they are not p0 or p1.
+	 *
+	 * @return false if the segment is outside the rectangle
+	 */
+	bool clipSegment(const geom::Coordinate& p0, const geom::Coordinate& p1,
+			geom::Coordinate& a, geom::Coordinate& b) const;
+
+	/// The point at t on segment p0-p1, snapped to side (0 to 3 for
+	/// min x, max x, min y, max y)
+	geom::Coordinate interpolate(const geom::Coordinate& p0,
+			const geom::Coordinate& p1, double t, int side) const;
+
+	/// @return true if a and b are on the same side of the rectangle
+	bool isOnSameSide(const geom::Coordinate& a,
+			const geom::Coordinate& b) const;
+
+	/**
+	 * The position of p on the rectangle boundary, going counter
+	 * clockwise from 0 at the lower left corner to 4 back there.
+	 */
+	double getPerimeterPosition(const geom::Coordinate& p) const;
+
+	/// The corner at perimeter position i, 0 to 3
+	geom::Coordinate getCorner(int i) const;
+
+	// Declare type as noncopyable
+	RectangleIntersection(const RectangleIntersection& other);
+	RectangleIntersection& operator=(const RectangleIntersection& rhs);
+};
+
+} // namespace geos::operation::intersection
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_INTERSECTION_RECTANGLEINTERSECTION_H
+
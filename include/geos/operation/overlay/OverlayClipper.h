@@ -0,0 +1,105 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_OVERLAY_OVERLAYCLIPPER_H
+#define GEOS_OP_OVERLAY_OVERLAYCLIPPER_H
+
+#include <geos/export.h>
+#include <geos/operation/overlay/OverlayOp.h> // for OpCode
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// Forward declarations
+namespace geos {
+	namespace geom {
+		class Envelope;
+		class Geometry;
+	}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace overlay { // geos::operation::overlay
+
+/** \brief
+ * Restricts the operands of an overlay to the parts which can affect
+ * its result, so that the edges far from the other operand are not
+ * noded and labelled.
+ *
+ * The intersection of A and B lies in the intersection of their
+ * envelopes, so both operands are clipped to it. The difference
+ * A - B only depends on the part of B in the envelope of A, so only
+ * B is clipped, and the parts of A outside the envelope of B are kept
+ * as they are. Union and symmetric difference are not restricted.
+ *
+ * The clipping envelope is expanded by a margin, so that the edges
+ * it adds run away from the other operand and never appear in the
+ * result. Only operands with at least MIN_POINTS points and extending
+ * out of the clipping envelope are clipped, through
+ * intersection::RectangleIntersection.
+ */
+class GEOS_DLL OverlayClipper {
+
+public:
+
+	typedef std::auto_ptr<geom::Geometry> GeomPtr;
+	typedef std::pair<GeomPtr, GeomPtr> GeomPtrPair;
+
+	/// Minimum number of points of an operand for it to be clipped
+	static const std::size_t MIN_POINTS = 128;
+
+	/**
+	 * Clips the operands of an overlay.
+	 *
+	 * @param opCode the overlay operation
+	 * @param g0 the first operand
+	 * @param g1 the second operand
+	 * @param ret the clipped operands, a null auto_ptr for those left
+	 *            as they are (output parameter)
+	 */
+	static void clip(OverlayOp::OpCode opCode,
+			const geom::Geometry& g0, const geom::Geometry& g1,
+			GeomPtrPair& ret);
+
+	/**
+	 * Computes the envelope the operands of an overlay can be
+	 * clipped to.
+	 *
+	 * @param opCode the overlay operation
+	 * @param g0 the first operand
+	 * @param g1 the second operand
+	 * @param env the clipping envelope (output parameter)
+	 * @return false if the operands can not be clipped
+	 */
+	static bool getClipEnvelope(OverlayOp::OpCode opCode,
+			const geom::Geometry& g0, const geom::Geometry& g1,
+			geom::Envelope& env);
+
+private:
+
+	/// @return the clipped geom, or a null auto_ptr if not worth it
+	static GeomPtr clip(const geom::Geometry& geom,
+			const geom::Envelope& env);
+};
+
+} // namespace geos::operation::overlay
+} // namespace geos::operation
+} // namespace geos
+
+#endif // GEOS_OP_OVERLAY_OVERLAYCLIPPER_H
@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstddef>
 
 #include "GeometryListHolder.h"
 
@@ -66,12 +67,20 @@ namespace geounion {  // geos::operation::geounion
  * The best case for buffer(0) is the trivial case
  * where there is <i>no</i> overlap between the input geometries. 
  * However, this case is likely rare in practice.
+ *
+ * The unions of disjoint subtrees of the STR tree are independent,
+ * so they can optionally be computed on several threads
+ * (see #setNumThreads). The same unions are performed, in the same
+ * order within each subtree, whatever the number of threads, so the
+ * result does not depend on it.
  */
 class GEOS_DLL CascadedPolygonUnion 
 {
 private:
     std::vector<geom::Polygon*>* inputPolys;
     geom::GeometryFactory const* geomFactory;
+    unsigned int numThreads;
+    std::size_t minGrainSize;
 
     /**
      * The effectiveness of the index is somewhat sensitive
@@ -83,6 +92,10 @@ private:
     static int const STRTREE_NODE_CAPACITY = 4;
 
 public:
+
+    /// Default for setMinGrainSize
+    static std::size_t const DEFAULT_MIN_GRAIN_SIZE = 64;
+
     CascadedPolygonUnion();
 
     /**
@@ -94,6 +107,18 @@ public:
      */
     static geom::Geometry* Union(std::vector<geom::Polygon*>* polys);
 
+    /**
+     * Computes the union of
+     * a collection of {@link Polygonal} {@link Geometry}s,
+     * using the given number of threads.
+     *
+     * @param polys a collection of {@link Polygonal} {@link Geometry}s.
+     *        ownership of elements _and_ vector are left to caller.
+     * @param numThreads see setNumThreads
+     */
+    static geom::Geometry* Union(std::vector<geom::Polygon*>* polys,
+        unsigned int numThreads);
+
     /**
      * Computes the union of a set of {@link Polygonal} {@link Geometry}s.
      * 
@@ -130,9 +155,26 @@ public:
      */
     CascadedPolygonUnion(std::vector<geom::Polygon*>* polys)
       : inputPolys(polys),
-        geomFactory(NULL)
+        geomFactory(NULL),
+        numThreads(1),
+        minGrainSize(DEFAULT_MIN_GRAIN_SIZE)
     {}
 
+    /**
+     * Sets the number of threads used to union independent subtrees.
+     *
+     * @param n number of threads, 0 means one per processor.
+     *          The default, 1, unions on the calling thread only.
+     */
+    void setNumThreads(unsigned int n) { numThreads = n; }
+
+    /**
+     * Sets the size, in input polygons, under which a subtree
+     * is unioned as a single unit of work rather than split further.
+     * Only used when more than one thread is used.
+     */
+    void setMinGrainSize(std::size_t n) { minGrainSize = n ? n : 1; }
+
     /**
      * Computes the union of the input geometries.
      * 
@@ -142,6 +184,10 @@ public:
     geom::Geometry* Union();
 
 private:
+
+    /// Schedules and runs subtree unions on several threads
+    class ParallelUnion;
+
     geom::Geometry* unionTree(index::strtree::ItemsList* geomTree);
 
     /**
@@ -0,0 +1,160 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_UNION_COVERAGEUNION_H
+#define GEOS_OP_UNION_COVERAGEUNION_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h> // for composition
+#include <geos/geom/CoordinateHashMap.h> // for composition
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+	namespace geom {
+		class CoordinateSequence;
+		class Geometry;
+		class Polygon;
+	}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace geounion {  // geos::operation::geounion
+
+/** \brief
+ * Unions a polygonal coverage: polygons which do not overlap and
+ * share their common edges exactly, with the same vertices.
+ *
+ * The rings of all polygons are oriented with the interior on their
+ * left, so that an edge shared by two polygons is found as two
+ * opposite segments. Those segments are cancelled, looking them up
+ * through a hash of the coverage vertices, and the remaining linework
+ * is polygonized. No noding or overlay is involved, cancelling the
+ * shared edges is linear in the number of vertices.
+ *
+ * Inputs which are not coverages give undefined results, unless
+ * validation is requested: overlapping edges, linework not forming
+ * rings, a result area different from the total area of the input
+ * polygons or an invalid result then throw a TopologyException.
+ */
+class GEOS_DLL CoverageUnion {
+
+public:
+
+	/**
+	 * Computes the union of a polygonal coverage.
+	 *
+	 * @param geom a Polygon, MultiPolygon or GeometryCollection of
+	 *        polygons forming a coverage
+	 * @param validate true to check that geom is a coverage
+	 * @return the union, a Polygon, MultiPolygon or empty collection
+	 * @throws IllegalArgumentException if geom is not polygonal
+	 * @throws TopologyException if validating and geom is not a coverage
+	 */
+	static std::auto_ptr<geom::Geometry> Union(const geom::Geometry& geom,
+			bool validate = false);
+
+private:
+
+	static const std::size_t NONE = static_cast<std::size_t>(-1);
+
+	/// A distinct location of the coverage
+	struct Vertex {
+		/// First segment starting at the vertex, or NONE
+		std::size_t firstOut;
+	};
+
+	/// A ring segment, starting at the ring point of the same index
+	struct Segment {
+		/// NULL for the ring closing points
+		Vertex* from;
+		Vertex* to;
+		/// Next segment starting at from, or NONE
+		std::size_t nextOut;
+		/// False once cancelled by the opposite segment
+		bool kept;
+	};
+
+	const geom::Geometry& geom;
+
+	bool validate;
+
+	/// Points of the rings, one after the other, oriented
+	std::vector<geom::Coordinate> pts;
+
+	/// Index in pts of the first point of each ring, and end of pts
+	std::vector<std::size_t> ringStarts;
+
+	/// One per point at most, so never reallocated
+	std::vector<Vertex> vertices;
+
+	geom::CoordinateHashMap<Vertex*> vertexIndex;
+
+	/// Parallel to pts
+	std::vector<Segment> segments;
+
+	CoverageUnion(const geom::Geometry& geom, bool validate);
+
+	std::auto_ptr<geom::Geometry> Union();
+
+	/// Adds the polygons of g, throwing on other components
+	void add(const geom::Geometry& g);
+
+	void addPolygon(const geom::Polygon& poly);
+
+	void addRing(const geom::CoordinateSequence& ring, bool ccw);
+
+	/// Adds the segment starting at pts[i], cancelling its opposite
+	void addSegment(std::size_t i);
+
+	Vertex* getVertex(const geom::Coordinate& p);
+
+	/// The kept segment from-to, or NONE
+	std::size_t findKept(const Vertex* from, const Vertex* to) const;
+
+	/// @return true if more than one kept segment starts at v
+	bool isNode(const Vertex* v) const;
+
+	/// Adds the runs of kept segments as lines
+	void extractLines(std::vector<geom::Geometry*>& lines) const;
+
+	/// @return true if a face of the kept linework is in the union
+	bool isInUnion(const geom::Polygon& poly) const;
+
+	// Declare type as noncopyable
+	CoverageUnion(const CoverageUnion& other);
+	CoverageUnion& operator=(const CoverageUnion& rhs);
+};
+
+} // namespace geos::operation::geounion
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_UNION_COVERAGEUNION_H
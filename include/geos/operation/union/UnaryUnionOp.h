@@ -106,10 +106,23 @@ public:
     return op.Union();
   }
 
+  /**
+   * Computes the union of geom, using the given number of threads
+   * for the polygonal components (see setNumThreads).
+   */
+  static std::auto_ptr<geom::Geometry> Union(const geom::Geometry& geom,
+      unsigned int numThreads)
+  {
+    UnaryUnionOp op(geom);
+    op.setNumThreads(numThreads);
+    return op.Union();
+  }
+
   template <class T>
   UnaryUnionOp(const T& geoms, geom::GeometryFactory& geomFactIn)
       :
-      geomFact(&geomFactIn)
+      geomFact(&geomFactIn),
+      numThreads(1)
   {
     extractGeoms(geoms);
   }
@@ -117,14 +130,16 @@ public:
   template <class T>
   UnaryUnionOp(const T& geoms)
       :
-      geomFact(0)
+      geomFact(0),
+      numThreads(1)
   {
     extractGeoms(geoms);
   }
 
   UnaryUnionOp(const geom::Geometry& geom)
       :
-      geomFact(geom.getFactory())
+      geomFact(geom.getFactory()),
+      numThreads(1)
   {
     extract(geom);
   }
@@ -141,6 +156,15 @@ public:
    */
   std::auto_ptr<geom::Geometry> Union();
 
+  /**
+   * Sets the number of threads used to union polygons,
+   * see CascadedPolygonUnion::setNumThreads.
+   * The result does not depend on the number of threads.
+   *
+   * @param n number of threads, 0 means one per processor
+   */
+  void setNumThreads(unsigned int n) { numThreads = n; }
+
 private:
 
   template <typename T>
@@ -209,6 +233,8 @@ private:
 
   const geom::GeometryFactory* geomFact;
 
+  unsigned int numThreads;
+
   std::auto_ptr<geom::Geometry> empty;
 };
  
@@ -19,6 +19,7 @@
 
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h> // for use in container
+#include <geos/geom/CoordinateHashMap.h> // for composition
 
 #include <map>
 #include <vector>
@@ -50,13 +51,18 @@ class GEOS_DLL NodeMap {
 public:
 	typedef std::map<geom::Coordinate, Node*, geom::CoordinateLessThen> container;
 private:
+	/// Ordered view, for deterministic iteration
 	container nodeMap;
+
+	/// Hash index of the nodes in nodeMap, for lookups
+	geom::CoordinateHashMap<Node*> nodeIndex;
 public:  
 	/**
 	 * \brief Constructs a NodeMap without any Nodes.
 	 */
 	NodeMap();
 
+	/// The nodes, ordered by location. Do not modify.
 	container& getNodeMap();
 
 	virtual ~NodeMap();
@@ -62,6 +62,12 @@
 /* Set to 1 if Visual C++ finite is defined */
 #cmakedefine HAVE_FINITE 1
 
+/* Set to 1 if POSIX threads are available */
+#cmakedefine HAVE_PTHREAD 1
+
+/* Set to 1 to build with 2D-only coordinates (no Z ordinate) */
+#cmakedefine GEOS_COORDINATE_2D 1
+
 
 #ifdef HAVE_IEEEFP_H
 extern "C"
@@ -0,0 +1,132 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_ARENA_H
+#define GEOS_UTIL_ARENA_H
+
+#include <geos/export.h>
+
+#include <vector>
+#include <cstddef>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace util { // geos.util
+
+/**
+ * \brief
+ * A region of memory from which objects are carved sequentially,
+ * and which is released in one shot when the Arena is destroyed.
+ *
+ * An Arena is made current for the calling thread by an Arena::Scope.
+ * While it is current, objects of classes deriving from
+ * ArenaAllocated are created in it rather than on the heap.
+ * Deleting such objects runs their destructor but does not
+ * release their memory, which is reused only once the arena itself
+ * is destroyed. Every object allocated in an arena must thus be
+ * destroyed before the arena.
+ *
+ * Operations building a temporary graph (overlay, relate, buffer)
+ * own an arena and make it current while building the graph.
+ */
+class GEOS_DLL Arena {
+
+public:
+
+	/// Makes an Arena current for the calling thread, for the
+	/// lifetime of the object. Scopes can be nested.
+	class GEOS_DLL Scope {
+	public:
+		Scope(Arena& a);
+		~Scope();
+	private:
+		Arena* previous;
+
+		// Declare type as noncopyable
+		Scope(const Scope& other);
+		Scope& operator=(const Scope& rhs);
+	};
+
+	/**
+	 * @param blockSize size of the blocks of memory requested to
+	 *        the heap. Larger allocations get a block of their own.
+	 */
+	Arena(std::size_t blockSize=65536);
+
+	/// Releases all the memory allocated from this arena
+	~Arena();
+
+	/// Returns n bytes, suitably aligned for any type
+	void* allocate(std::size_t n);
+
+	/// Number of bytes handed out by allocate
+	std::size_t getAllocatedBytes() const { return allocated; }
+
+	/// The arena of the innermost Scope of the calling thread, or NULL
+	static Arena* getCurrent();
+
+	/**
+	 * False if the platform provides no thread local storage
+	 * in a threaded build, in which case Scope has no effect.
+	 */
+	static bool isSupported();
+
+private:
+
+	std::size_t blockSize;
+
+	std::vector<char*> blocks;
+
+	char* next;
+
+	char* end;
+
+	std::size_t allocated;
+
+	// Declare type as noncopyable
+	Arena(const Arena& other);
+	Arena& operator=(const Arena& rhs);
+};
+
+/**
+ * \brief
+ * Base for classes whose objects are created in the current Arena,
+ * if any, and on the heap otherwise.
+ */
+class GEOS_DLL ArenaAllocated {
+
+public:
+
+	static void* operator new(std::size_t n);
+
+	static void operator delete(void* p);
+
+protected:
+
+	ArenaAllocated() {}
+
+	~ArenaAllocated() {}
+};
+
+} // namespace geos.util
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_UTIL_ARENA_H
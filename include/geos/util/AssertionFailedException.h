@@ -43,6 +43,11 @@ public:
 	{}
 
 	~AssertionFailedException() throw() {}
+
+	// See GEOSException
+	AssertionFailedException* clone() const { return new AssertionFailedException(*this); }
+
+	void raise() const { throw *this; }
 };
 
 } // namespace geos.util
@@ -0,0 +1,77 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_ATOMICPOINTER_H
+#define GEOS_UTIL_ATOMICPOINTER_H
+
+#include <geos/export.h>
+
+namespace geos {
+namespace util { // geos.util
+
+/// Reads *p, ordering later reads after it
+GEOS_DLL void* loadAcquire(void* const volatile* p);
+
+/// Writes *p, ordering earlier writes before it
+GEOS_DLL void storeRelease(void* volatile* p, void* value);
+
+/**
+ * \brief
+ * A pointer which can be published by one thread and read by others
+ * without locking.
+ *
+ * A thread seeing the pointer set through #load also sees the
+ * pointed object as it was when #store was called. Used with a
+ * Mutex for lazily built members, the pointer is checked without
+ * locking, and the lock only taken while it is not set:
+ *
+ * <pre>
+ * T* t = ptr.load();
+ * if ( ! t ) {
+ *     Mutex::Lock lock(mutex);
+ *     t = ptr.load();
+ *     if ( ! t ) { t = new T(); ptr.store(t); }
+ * }
+ * </pre>
+ *
+ * When GEOS is built without thread support this is a plain pointer.
+ */
+template <class T>
+class AtomicPointer {
+
+public:
+
+	AtomicPointer(T* p=0) : ptr(toVoid(p)) {}
+
+	T* load() const { return static_cast<T*>(loadAcquire(&ptr)); }
+
+	void store(T* p) { storeRelease(&ptr, toVoid(p)); }
+
+private:
+
+	// Also allows pointers to const
+	static void* toVoid(T* p) {
+		return const_cast<void*>(static_cast<const void*>(p));
+	}
+
+	void* volatile ptr;
+
+	// Declare type as noncopyable
+	AtomicPointer(const AtomicPointer& other);
+	AtomicPointer& operator=(const AtomicPointer& rhs);
+};
+
+} // namespace geos.util
+} // namespace geos
+
+#endif // GEOS_UTIL_ATOMICPOINTER_H
@@ -65,6 +65,17 @@ public:
 		return _msg.c_str();
 	}
 
+	/**
+	 * Returns a copy of the exception, of the same type, so that
+	 * an exception caught on a thread can be thrown again on
+	 * another one with raise().
+	 * Every derived class overrides it, and raise().
+	 */
+	virtual GEOSException* clone() const { return new GEOSException(*this); }
+
+	/// Throws *this, keeping its type
+	virtual void raise() const { throw *this; }
+
 };
 
 } // namespace geos.util
@@ -45,6 +45,11 @@ public:
 	{}
 
 	~IllegalArgumentException() throw() {};
+
+	// See GEOSException
+	IllegalArgumentException* clone() const { return new IllegalArgumentException(*this); }
+
+	void raise() const { throw *this; }
 };
 
 } // namespace geos::util
@@ -38,6 +38,11 @@ public:
 	{}
 
 	~IllegalStateException() throw() {};
+
+	// See GEOSException
+	IllegalStateException* clone() const { return new IllegalStateException(*this); }
+
+	void raise() const { throw *this; }
 };
 
 } // namespace geos::util
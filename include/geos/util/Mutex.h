@@ -0,0 +1,67 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_MUTEX_H
+#define GEOS_UTIL_MUTEX_H
+
+#include <geos/export.h>
+
+namespace geos {
+namespace util { // geos.util
+
+/**
+ * \brief
+ * A non-recursive mutual exclusion lock.
+ *
+ * Wraps the native threading API (pthreads or Win32).
+ * When GEOS is built without thread support locking is a no-op.
+ */
+class GEOS_DLL Mutex {
+
+public:
+
+	/// Locks a Mutex for the lifetime of the object
+	class GEOS_DLL Lock {
+	public:
+		Lock(Mutex& m) : mutex(m) { mutex.lock(); }
+		~Lock() { mutex.unlock(); }
+	private:
+		Mutex& mutex;
+
+		// Declare type as noncopyable
+		Lock(const Lock& other);
+		Lock& operator=(const Lock& rhs);
+	};
+
+	Mutex();
+
+	~Mutex();
+
+	void lock();
+
+	void unlock();
+
+private:
+
+	/// Native mutex object
+	void* impl;
+
+	// Declare type as noncopyable
+	Mutex(const Mutex& other);
+	Mutex& operator=(const Mutex& rhs);
+};
+
+} // namespace geos.util
+} // namespace geos
+
+#endif // GEOS_UTIL_MUTEX_H
@@ -0,0 +1,87 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_TASKRUNNER_H
+#define GEOS_UTIL_TASKRUNNER_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+
+namespace geos {
+namespace util { // geos.util
+
+/**
+ * \brief
+ * Runs a set of independent, indexed units of work on a number
+ * of threads.
+ *
+ * Units are handed out one at a time from a shared counter, so a
+ * thread finishing a cheap unit early picks up the next pending
+ * one. The calling thread takes part in the work, and #run only
+ * returns once every unit has completed.
+ *
+ * If a unit throws, no further units are started and the first
+ * error is rethrown from #run, whatever the number of threads:
+ * GEOS exceptions and std::bad_alloc with their original type,
+ * other exceptions as a GEOSException with the same message.
+ *
+ * When GEOS is built without thread support, or a single thread
+ * is requested, units run sequentially in index order on the
+ * calling thread.
+ */
+class GEOS_DLL TaskRunner {
+
+public:
+
+	/// A set of units of work, identified by index
+	class GEOS_DLL Task {
+	public:
+		/**
+		 * Performs unit of work number <code>index</code>.
+		 * Will be called concurrently for different indexes.
+		 */
+		virtual void run(std::size_t index)=0;
+
+		virtual ~Task() {}
+	};
+
+	/**
+	 * @param numThreads number of threads to use, including the
+	 *        calling one. 0 means one per available processor.
+	 */
+	TaskRunner(unsigned int numThreads=0);
+
+	/// Number of threads that will be used by #run
+	unsigned int getNumThreads() const { return numThreads; }
+
+	/**
+	 * Calls task.run(i) for every i in [0, count)
+	 */
+	void run(Task& task, std::size_t count);
+
+	/// Number of processors available, at least 1
+	static unsigned int getNumProcessors();
+
+	/// False if GEOS was built without thread support
+	static bool isThreadingSupported();
+
+private:
+
+	unsigned int numThreads;
+};
+
+} // namespace geos.util
+} // namespace geos
+
+#endif // GEOS_UTIL_TASKRUNNER_H
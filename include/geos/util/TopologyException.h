@@ -52,6 +52,12 @@ public:
 	{}
 
 	~TopologyException() throw() {}
+
+	// See GEOSException
+	TopologyException* clone() const { return new TopologyException(*this); }
+
+	void raise() const { throw *this; }
+
 	geom::Coordinate& getCoordinate() { return pt; }
 private:
 	geom::Coordinate pt;
@@ -47,6 +47,11 @@ public:
 	{}
 
 	~UnsupportedOperationException() throw() {};
+
+	// See GEOSException
+	UnsupportedOperationException* clone() const { return new UnsupportedOperationException(*this); }
+
+	void raise() const { throw *this; }
 };
 
 } // namespace geos::util
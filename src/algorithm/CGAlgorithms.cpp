@@ -299,6 +299,45 @@ limiting conditions:
 	return 0.0; //intersection exists
 }
 
+namespace {
+
+/// Computes the signed area sum of a ring, see applyOrdinateFilter
+struct SignedAreaFilter {
+	double sum;
+
+	SignedAreaFilter() : sum(0.0) {}
+
+	template <class Ordinates>
+	void filter(const Ordinates& pts, size_t npts)
+	{
+		for (size_t i=1; i<npts; ++i)
+		{
+			sum += (pts.getX(i-1) + pts.getX(i)) *
+			       (pts.getY(i) - pts.getY(i-1));
+		}
+	}
+};
+
+/// Computes the length of a line, see applyOrdinateFilter
+struct LengthFilter {
+	double len;
+
+	LengthFilter() : len(0.0) {}
+
+	template <class Ordinates>
+	void filter(const Ordinates& pts, size_t npts)
+	{
+		for (size_t i=1; i<npts; ++i)
+		{
+			double dx = pts.getX(i) - pts.getX(i-1);
+			double dy = pts.getY(i) - pts.getY(i-1);
+			len += sqrt(dx * dx + dy * dy);
+		}
+	}
+};
+
+} // anonymous namespace
+
 /*public static*/
 double
 CGAlgorithms::signedArea(const CoordinateSequence* ring)
@@ -307,20 +346,9 @@ CGAlgorithms::signedArea(const CoordinateSequence* ring)
 
 	if (npts<3) return 0.0;
 
-	double sum=0.0;
-	Coordinate p = ring->getAt(0);
-	double bx = p.x;
-	double by = p.y;
-	for (size_t i=1; i<npts; ++i)
-	{
-		ring->getAt(i, p);
-		double cx = p.x;
-		double cy = p.y;
-		sum += (bx+cx) * (cy-by);
-		bx = cx;
-		by = cy;
-	}
-	return -sum/2.0;
+	SignedAreaFilter filter;
+	ring->applyOrdinateFilter(filter);
+	return -filter.sum/2.0;
 }
 
 /*public static*/
@@ -332,27 +360,9 @@ CGAlgorithms::length(const CoordinateSequence* pts)
 	size_t npts=pts->getSize();
 	if (npts <= 1) return 0.0;
 
-	double len = 0.0;
-
-	const Coordinate& p = pts->getAt(0);
-	double x0 = p.x;
-	double y0 = p.y;
-
-	for(size_t i = 1; i < npts; ++i)
-	{
-		const Coordinate& p = pts->getAt(i);
-		double x1 = p.x;
-		double y1 = p.y;
-		double dx = x1 - x0;
-		double dy = y1 - y0;
-
-		len += sqrt(dx * dx + dy * dy);
-
-		x0 = x1;
-		y0 = y1;
-	}
-
-	return len;
+	LengthFilter filter;
+	pts->applyOrdinateFilter(filter);
+	return filter.len;
 }
 
 
@@ -44,7 +44,11 @@
 #endif
 
 #ifndef COMPUTE_Z
-#define COMPUTE_Z 1
+# ifdef GEOS_COORDINATE_2D
+#  define COMPUTE_Z 0
+# else
+#  define COMPUTE_Z 1
+# endif
 #endif // COMPUTE_Z
 
 using namespace std;
@@ -221,45 +225,45 @@ LineIntersector::interpolateZ(const Coordinate &p,
 	cerr<<"LineIntersector::interpolateZ("<<p.toString()<<", "<<p1.toString()<<", "<<p2.toString()<<")"<<endl;
 #endif
 
-	if ( ISNAN(p1.z) )
+	if ( ISNAN(p1.getZ()) )
 	{
 #if GEOS_DEBUG
 		cerr<<" p1 do not have a Z"<<endl;
 #endif
-		return p2.z; // might be DoubleNotANumber again
+		return p2.getZ(); // might be DoubleNotANumber again
 	}
 
-	if ( ISNAN(p2.z) )
+	if ( ISNAN(p2.getZ()) )
 	{
 #if GEOS_DEBUG
 		cerr<<" p2 do not have a Z"<<endl;
 #endif
-		return p1.z; // might be DoubleNotANumber again
+		return p1.getZ(); // might be DoubleNotANumber again
 	}
 
 	if (p==p1)
 	{
 #if GEOS_DEBUG
-		cerr<<" p==p1, returning "<<p1.z<<endl;
+		cerr<<" p==p1, returning "<<p1.getZ()<<endl;
 #endif
-		return p1.z;
+		return p1.getZ();
 	}
 	if (p==p2)
 	{
 #if GEOS_DEBUG
-		cerr<<" p==p2, returning "<<p2.z<<endl;
+		cerr<<" p==p2, returning "<<p2.getZ()<<endl;
 #endif
-		return p2.z;
+		return p2.getZ();
 	}
 
 	//double zgap = fabs(p2.z - p1.z);
-	double zgap = p2.z - p1.z;
+	double zgap = p2.getZ() - p1.getZ();
 	if ( ! zgap )
 	{
 #if GEOS_DEBUG
-		cerr<<" no zgap, returning "<<p2.z<<endl;
+		cerr<<" no zgap, returning "<<p2.getZ()<<endl;
 #endif
-		return p2.z;
+		return p2.getZ();
 	}
 	double xoff = (p2.x-p1.x);
 	double yoff = (p2.y-p1.y);
@@ -270,7 +274,7 @@ LineIntersector::interpolateZ(const Coordinate &p,
 	double fract = sqrt(pdist/seglen);
 	double zoff = zgap*fract;
 	//double interpolated = p1.z < p2.z ? p1.z+zoff : p1.z-zoff;
-	double interpolated = p1.z+zoff;
+	double interpolated = p1.getZ()+zoff;
 #if GEOS_DEBUG
 	cerr<<" zgap:"<<zgap<<" seglen:"<<seglen<<" pdist:"<<pdist
 		<<" fract:"<<fract<<" z:"<<interpolated<<endl;
@@ -303,10 +307,10 @@ LineIntersector::computeIntersection(const Coordinate& p,const Coordinate& p1,co
 			double z = interpolateZ(p, p1, p2);
 			if ( !ISNAN(z) )
 			{
-				if ( ISNAN(intPt[0].z) )
-					intPt[0].z = z;
+				if ( ISNAN(intPt[0].getZ()) )
+					intPt[0].setZ(z);
 				else
-					intPt[0].z = (intPt[0].z+z)/2;
+					intPt[0].setZ((intPt[0].getZ()+z)/2);
 			}
 #endif // COMPUTE_Z
 			result=POINT_INTERSECTION;
@@ -423,9 +427,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		if ( p1.equals2D(q1) || p1.equals2D(q2) ) {
 			intPt[0]=p1;
 #if COMPUTE_Z
-			if ( !ISNAN(p1.z) )
+			if ( !ISNAN(p1.getZ()) )
 			{
-				z += p1.z;
+				z += p1.getZ();
 				hits++;
 			}
 #endif
@@ -433,9 +437,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		else if ( p2.equals2D(q1) || p2.equals2D(q2) ) {
 			intPt[0]=p2;
 #if COMPUTE_Z
-			if ( !ISNAN(p2.z) )
+			if ( !ISNAN(p2.getZ()) )
 			{
-				z += p2.z;
+				z += p2.getZ();
 				hits++;
 			}
 #endif
@@ -447,9 +451,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		else if (Pq1==0) {
 			intPt[0]=q1;
 #if COMPUTE_Z
-			if ( !ISNAN(q1.z) )
+			if ( !ISNAN(q1.getZ()) )
 			{
-				z += q1.z;
+				z += q1.getZ();
 				hits++;
 			}
 #endif
@@ -457,9 +461,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		else if (Pq2==0) {
 			intPt[0]=q2;
 #if COMPUTE_Z
-			if ( !ISNAN(q2.z) )
+			if ( !ISNAN(q2.getZ()) )
 			{
-				z += q2.z;
+				z += q2.getZ();
 				hits++;
 			}
 #endif
@@ -467,9 +471,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		else if (Qp1==0) {
 			intPt[0]=p1;
 #if COMPUTE_Z
-			if ( !ISNAN(p1.z) )
+			if ( !ISNAN(p1.getZ()) )
 			{
-				z += p1.z;
+				z += p1.getZ();
 				hits++;
 			}
 #endif
@@ -477,9 +481,9 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 		else if (Qp2==0) {
 			intPt[0]=p2;
 #if COMPUTE_Z
-			if ( !ISNAN(p2.z) )
+			if ( !ISNAN(p2.getZ()) )
 			{
-				z += p2.z;
+				z += p2.getZ();
 				hits++;
 			}
 #endif
@@ -488,7 +492,7 @@ LineIntersector::computeIntersect(const Coordinate& p1,const Coordinate& p2,cons
 #if GEOS_DEBUG
 		cerr<<"LineIntersector::computeIntersect: z:"<<z<<" hits:"<<hits<<endl;
 #endif // GEOS_DEBUG
-		if ( hits ) intPt[0].z = z/hits;
+		if ( hits ) intPt[0].setZ(z/hits);
 #endif // COMPUTE_Z
 	} else {
 		isProperVar=true;
@@ -533,8 +537,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q1z = interpolateZ(q1, p1, p2);
 		if (!ISNAN(q1z)) { ztot+=q1z; hits++; }
-		if (!ISNAN(q1.z)) { ztot+=q1.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(q1.getZ())) { ztot+=q1.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=q2;
 #if COMPUTE_Z
@@ -542,8 +546,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q2z = interpolateZ(q2, p1, p2);
 		if (!ISNAN(q2z)) { ztot+=q2z; hits++; }
-		if (!ISNAN(q2.z)) { ztot+=q2.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(q2.getZ())) { ztot+=q2.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 #if GEOS_DEBUG
 		cerr<<" intPt[0]: "<<intPt[0].toString()<<endl;
@@ -561,8 +565,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p1z = interpolateZ(p1, q1, q2);
 		if (!ISNAN(p1z)) { ztot+=p1z; hits++; }
-		if (!ISNAN(p1.z)) { ztot+=p1.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(p1.getZ())) { ztot+=p1.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=p2;
 #if COMPUTE_Z
@@ -570,8 +574,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p2z = interpolateZ(p2, q1, q2);
 		if (!ISNAN(p2z)) { ztot+=p2z; hits++; }
-		if (!ISNAN(p2.z)) { ztot+=p2.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(p2.getZ())) { ztot+=p2.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 		return COLLINEAR_INTERSECTION;
 	}
@@ -585,8 +589,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q1z = interpolateZ(q1, p1, p2);
 		if (!ISNAN(q1z)) { ztot+=q1z; hits++; }
-		if (!ISNAN(q1.z)) { ztot+=q1.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(q1.getZ())) { ztot+=q1.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=p1;
 #if COMPUTE_Z
@@ -594,8 +598,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p1z = interpolateZ(p1, q1, q2);
 		if (!ISNAN(p1z)) { ztot+=p1z; hits++; }
-		if (!ISNAN(p1.z)) { ztot+=p1.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(p1.getZ())) { ztot+=p1.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 #if GEOS_DEBUG
 		cerr<<" intPt[0]: "<<intPt[0].toString()<<endl;
@@ -613,8 +617,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q1z = interpolateZ(q1, p1, p2);
 		if (!ISNAN(q1z)) { ztot+=q1z; hits++; }
-		if (!ISNAN(q1.z)) { ztot+=q1.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(q1.getZ())) { ztot+=q1.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=p2;
 #if COMPUTE_Z
@@ -622,8 +626,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p2z = interpolateZ(p2, q1, q2);
 		if (!ISNAN(p2z)) { ztot+=p2z; hits++; }
-		if (!ISNAN(p2.z)) { ztot+=p2.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(p2.getZ())) { ztot+=p2.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 #if GEOS_DEBUG
 		cerr<<" intPt[0]: "<<intPt[0].toString()<<endl;
@@ -641,8 +645,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q2z = interpolateZ(q2, p1, p2);
 		if (!ISNAN(q2z)) { ztot+=q2z; hits++; }
-		if (!ISNAN(q2.z)) { ztot+=q2.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(q2.getZ())) { ztot+=q2.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=p1;
 #if COMPUTE_Z
@@ -650,8 +654,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p1z = interpolateZ(p1, q1, q2);
 		if (!ISNAN(p1z)) { ztot+=p1z; hits++; }
-		if (!ISNAN(p1.z)) { ztot+=p1.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(p1.getZ())) { ztot+=p1.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 #if GEOS_DEBUG
 		cerr<<" intPt[0]: "<<intPt[0].toString()<<endl;
@@ -669,8 +673,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		q2z = interpolateZ(q2, p1, p2);
 		if (!ISNAN(q2z)) { ztot+=q2z; hits++; }
-		if (!ISNAN(q2.z)) { ztot+=q2.z; hits++; }
-		if ( hits ) intPt[0].z = ztot/hits;
+		if (!ISNAN(q2.getZ())) { ztot+=q2.getZ(); hits++; }
+		if ( hits ) intPt[0].setZ(ztot/hits);
 #endif
 		intPt[1]=p2;
 #if COMPUTE_Z
@@ -678,8 +682,8 @@ LineIntersector::computeCollinearIntersection(const Coordinate& p1,const Coordin
 		hits=0;
 		p2z = interpolateZ(p2, q1, q2);
 		if (!ISNAN(p2z)) { ztot+=p2z; hits++; }
-		if (!ISNAN(p2.z)) { ztot+=p2.z; hits++; }
-		if ( hits ) intPt[1].z = ztot/hits;
+		if (!ISNAN(p2.getZ())) { ztot+=p2.getZ(); hits++; }
+		if ( hits ) intPt[1].setZ(ztot/hits);
 #endif
 #if GEOS_DEBUG
 		cerr<<" intPt[0]: "<<intPt[0].toString()<<endl;
@@ -735,7 +739,7 @@ LineIntersector::intersection(const Coordinate& p1,
 	double zq = interpolateZ(intPt, q1, q2);
 	if ( !ISNAN(zp)) { ztot += zp; zvals++; }
 	if ( !ISNAN(zq)) { ztot += zq; zvals++; }
-	if ( zvals ) intPt.z = ztot/zvals;
+	if ( zvals ) intPt.setZ(ztot/zvals);
 #endif // COMPUTE_Z
 
 }
@@ -821,18 +825,18 @@ LineIntersector::normalizeToEnvCentre(Coordinate &n00, Coordinate &n01,
 	n11.x -= normPt.x;    n11.y -= normPt.y;
 
 #if COMPUTE_Z
-	double minZ0 = n00.z < n01.z ? n00.z : n01.z;
-	double minZ1 = n10.z < n11.z ? n10.z : n11.z;
-	double maxZ0 = n00.z > n01.z ? n00.z : n01.z;
-	double maxZ1 = n10.z > n11.z ? n10.z : n11.z;
+	double minZ0 = n00.getZ() < n01.getZ() ? n00.getZ() : n01.getZ();
+	double minZ1 = n10.getZ() < n11.getZ() ? n10.getZ() : n11.getZ();
+	double maxZ0 = n00.getZ() > n01.getZ() ? n00.getZ() : n01.getZ();
+	double maxZ1 = n10.getZ() > n11.getZ() ? n10.getZ() : n11.getZ();
 	double intMinZ = minZ0 > minZ1 ? minZ0 : minZ1;
 	double intMaxZ = maxZ0 < maxZ1 ? maxZ0 : maxZ1;
 	double intMidZ = (intMinZ + intMaxZ) / 2.0;
-	normPt.z = intMidZ;
-	n00.z -= normPt.z;
-	n01.z -= normPt.z;
-	n10.z -= normPt.z;
-	n11.z -= normPt.z;
+	normPt.setZ(intMidZ);
+	n00.setZ(n00.getZ() - normPt.getZ());
+	n01.setZ(n01.getZ() - normPt.getZ());
+	n10.setZ(n10.getZ() - normPt.getZ());
+	n11.setZ(n11.getZ() - normPt.getZ());
 #endif
 }
 
@@ -21,6 +21,7 @@
 #include <geos/algorithm/PointLocator.h>
 #include <geos/algorithm/CGAlgorithms.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/Point.h>
 #include <geos/geom/LineString.h>
 #include <geos/geom/LinearRing.h>
 #include <geos/geom/MultiLineString.h>
@@ -43,6 +44,9 @@ PointLocator::locate(const Coordinate& p, const Geometry *geom)
 {
 	if (geom->isEmpty()) return Location::EXTERIOR;
 
+	const Point *pt_geom = dynamic_cast<const Point *>(geom);
+	if (pt_geom) return locate(p, pt_geom);
+
 	const LineString *ls_geom = dynamic_cast<const LineString *>(geom);
 	if (ls_geom) return locate(p, ls_geom);
 
@@ -63,7 +67,11 @@ void
 PointLocator::computeLocation(const Coordinate& p, const Geometry *geom)
 {
 
-	if (const LineString *ls=dynamic_cast<const LineString*>(geom))
+	if (const Point *pt=dynamic_cast<const Point*>(geom))
+	{
+		updateLocationInfo(locate(p, pt));
+	}
+	else if (const LineString *ls=dynamic_cast<const LineString*>(geom))
 	{
 		updateLocationInfo(locate(p, ls));
 	}
@@ -110,6 +118,17 @@ PointLocator::updateLocationInfo(int loc)
 	if (loc==Location::BOUNDARY) ++numBoundaries;
 }
 
+/* private */
+int
+PointLocator::locate(const Coordinate& p, const Point *pt)
+{
+	// no point in doing envelope test, since equality test is just as fast
+	const Coordinate *ptCoord = pt->getCoordinate();
+	if (ptCoord && ptCoord->equals2D(p))
+		return Location::INTERIOR;
+	return Location::EXTERIOR;
+}
+
 /* private */
 int
 PointLocator::locate(const Coordinate& p, const LineString *l)
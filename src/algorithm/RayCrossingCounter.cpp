@@ -24,9 +24,42 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
 
+#include <cfloat> // for DBL_EPSILON, DBL_MIN
+#include <cmath> // for fabs
+
 
 namespace geos {
 namespace algorithm {
+
+namespace {
+
+/// Counts ring crossings, see CoordinateSequence::applyOrdinateFilter
+struct RingLocator {
+	RayCrossingCounter rcc;
+
+	RingLocator(const geom::Coordinate& point) : rcc(point) {}
+
+	template <class Ordinates>
+	void filter(const Ordinates& ring, std::size_t npts)
+	{
+		geom::Coordinate p1, p2;
+		for (std::size_t i = 1; i < npts; i++)
+		{
+			p1.x = ring.getX(i);
+			p1.y = ring.getY(i);
+			p2.x = ring.getX(i - 1);
+			p2.y = ring.getY(i - 1);
+
+			rcc.countSegment(p1, p2);
+
+			if ( rcc.isOnSegment() )
+				return;
+		}
+	}
+};
+
+} // anonymous namespace
+
 //
 // private:
 //
@@ -42,19 +75,9 @@ namespace algorithm {
 RayCrossingCounter::locatePointInRing(const geom::Coordinate& point,
                          const geom::CoordinateSequence& ring) 
 {
-	RayCrossingCounter rcc(point);
-
-	for (int i = 1, ni = ring.size(); i < ni; i++) 
-	{
-		const geom::Coordinate & p1 = ring[ i ];
-		const geom::Coordinate & p2 = ring[ i - 1 ];
-
-		rcc.countSegment(p1, p2);
-
-		if ( rcc.isOnSegment() )
-			return rcc.getLocation();
-	}
-	return rcc.getLocation();
+	RingLocator locator(point);
+	ring.applyOrdinateFilter(locator);
+	return locator.rcc.getLocation();
 }
 
 /*static*/ int 
@@ -76,6 +99,58 @@ RayCrossingCounter::locatePointInRing(const geom::Coordinate& point,
 	return rcc.getLocation();
 }
 
+/*static*/ int
+RayCrossingCounter::locatePointInSegments(const geom::Coordinate& point,
+	const double* x0, const double* y0,
+	const double* x1, const double* y1, std::size_t n)
+{
+	const double px = point.x;
+	const double py = point.y;
+
+	// Same tests as countSegment, on the segments translated so
+	// that the point is at the origin, combined with masks.
+	// "special" flags segments the point is on, or whose orientation
+	// test is within the rounding error of the determinant.
+	int crossings = 0;
+	int special = 0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const double ax = x0[i] - px;
+		const double ay = y0[i] - py;
+		const double bx = x1[i] - px;
+		const double by = y1[i] - py;
+
+		const int counted = ! ( ax < 0.0 && bx < 0.0 );
+		const int atVertex = ( bx == 0.0 && by == 0.0 );
+		const int onHorizontal = ( ay == 0.0 && by == 0.0 ) &&
+			( ( ax <= 0.0 && bx >= 0.0 ) || ( bx <= 0.0 && ax >= 0.0 ) );
+		const int straddles = ( ay > 0.0 && by <= 0.0 ) ||
+		                      ( by > 0.0 && ay <= 0.0 );
+
+		const double l = ax * by;
+		const double r = ay * bx;
+		const double det = l - r;
+		const double err = 2 * DBL_EPSILON * ( std::fabs(l) + std::fabs(r) )
+		                   + DBL_MIN;
+		const int uncertain = std::fabs(det) <= err;
+		const int positive = ( by < ay ) ? ( det < 0.0 ) : ( det > 0.0 );
+
+		crossings += counted & straddles & positive;
+		special |= counted & ( atVertex | onHorizontal |
+		                       ( straddles & uncertain ) );
+	}
+
+	if ( ! special )
+		return ( crossings % 2 ) ? geom::Location::INTERIOR : geom::Location::EXTERIOR;
+
+	RayCrossingCounter rcc(point);
+	for (std::size_t i = 0; i < n && ! rcc.isOnSegment(); ++i)
+	{
+		rcc.countSegment(geom::Coordinate(x0[i], y0[i]),
+		                 geom::Coordinate(x1[i], y1[i]));
+	}
+	return rcc.getLocation();
+}
 
 void 
 RayCrossingCounter::countSegment(const geom::Coordinate& p1,
@@ -18,7 +18,12 @@
  **********************************************************************/
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/algorithm/distance/IndexedDistanceToPoint.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/util/AtomicPointer.h>
+#include <geos/util/TaskRunner.h>
+#include <geos/platform.h> // for DoubleInfinity
 
 //#include <geos/algorithm/CGAlgorithms.h>
 //#include <geos/geom/Geometry.h>
@@ -29,6 +34,8 @@
 
 #include <typeinfo>
 #include <cassert>
+#include <algorithm>
+#include <vector>
 
 using namespace geos::geom;
 
@@ -36,6 +43,191 @@ namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
+namespace { // anonymous
+
+/// Number of sample points evaluated by a SampleTask unit of work
+const std::size_t SAMPLE_BLOCK_SIZE = 256;
+
+/// Collects the vertices of a geometry
+class VertexCollector : public CoordinateFilter
+{
+public:
+	VertexCollector(std::vector<Coordinate>& vertices)
+		: vertices(vertices)
+	{}
+
+	void filter_ro(const Coordinate* pt)
+	{
+		vertices.push_back(*pt);
+	}
+
+private:
+	std::vector<Coordinate>& vertices;
+};
+
+/// Collects the segments of a geometry, to be densified
+class SegmentCollector : public CoordinateSequenceFilter
+{
+public:
+	SegmentCollector(std::vector<LineSegment>& segments)
+		: segments(segments)
+	{}
+
+	void filter_ro(const CoordinateSequence& seq, std::size_t index)
+	{
+		// This also skips Point geometries
+		if (index == 0) return;
+		segments.push_back(LineSegment(seq.getAt(index - 1),
+		                               seq.getAt(index)));
+	}
+
+	bool isGeometryChanged() const { return false; }
+
+	bool isDone() const { return false; }
+
+private:
+	std::vector<LineSegment>& segments;
+};
+
+} // anonymous namespace
+
+/*
+ * Finds the maximum distance from sample points of a geometry to an
+ * indexed one, by blocks of SAMPLE_BLOCK_SIZE points: the vertices
+ * first, then the points densifying the segments.
+ *
+ * Each block keeps its own maximum, so that blocks can be evaluated
+ * concurrently, and merging them in order gives the same point pair
+ * as a sequential evaluation.
+ */
+class DiscreteHausdorffDistance::SampleTask : public util::TaskRunner::Task
+{
+public:
+	SampleTask(const IndexedDistanceToPoint& dist,
+	           const std::vector<Coordinate>& vertices,
+	           const std::vector<LineSegment>& segments,
+	           std::size_t numSubSegs, double maxDistance)
+		:
+		dist(dist),
+		vertices(vertices),
+		segments(segments),
+		numSubSegs(numSubSegs),
+		segmentsPerBlock((std::max)(std::size_t(1),
+		                            SAMPLE_BLOCK_SIZE / numSubSegs)),
+		vertexBlocks((vertices.size() + SAMPLE_BLOCK_SIZE - 1) /
+		             SAMPLE_BLOCK_SIZE),
+		maxDistance(maxDistance),
+		bounded(maxDistance < DoubleInfinity),
+		blockMax(getNumBlocks()),
+		blockHasMax(getNumBlocks(), 0)
+	{}
+
+	std::size_t getNumBlocks() const
+	{
+		return vertexBlocks +
+			(segments.size() + segmentsPerBlock - 1) / segmentsPerBlock;
+	}
+
+	void run(std::size_t block)
+	{
+		if ( block < vertexBlocks )
+		{
+			std::size_t end = (std::min)(vertices.size(),
+			                             (block + 1) * SAMPLE_BLOCK_SIZE);
+			for (std::size_t i=block*SAMPLE_BLOCK_SIZE; i<end; ++i)
+			{
+				if ( ! evaluate(vertices[i], block, &vertices[i]) )
+					return;
+			}
+			return;
+		}
+
+		std::size_t begin = (block - vertexBlocks) * segmentsPerBlock;
+		std::size_t end = (std::min)(segments.size(),
+		                             begin + segmentsPerBlock);
+		for (std::size_t i=begin; i<end; ++i)
+		{
+			const Coordinate& p0 = segments[i].p0;
+			const Coordinate& p1 = segments[i].p1;
+			double delx = (p1.x - p0.x)/numSubSegs;
+			double dely = (p1.y - p0.y)/numSubSegs;
+
+			for (std::size_t j=0; j<numSubSegs; ++j)
+			{
+				Coordinate pt(p0.x + j*delx, p0.y + j*dely);
+				if ( ! evaluate(pt, block, &p0) )
+					return;
+			}
+		}
+	}
+
+	/**
+	 * Merges the maximum of the blocks into ptDist
+	 * @return false if a sample point is further than maxDistance
+	 */
+	bool getMaxPointDistance(PointPairDistance& ptDist) const
+	{
+		if ( farSample.load() ) return false;
+		for (std::size_t i=0, n=blockMax.size(); i<n; ++i)
+		{
+			if ( blockHasMax[i] ) ptDist.setMaximum(blockMax[i]);
+		}
+		return true;
+	}
+
+private:
+
+	/*
+	 * Updates the maximum of the block with pt.
+	 * In bounded mode, only checks pt is within maxDistance, and
+	 * records sample, the vertex or segment start of pt, otherwise.
+	 * Returns false when the evaluation can stop.
+	 */
+	bool evaluate(const Coordinate& pt, std::size_t block,
+	              const Coordinate* sample)
+	{
+		if ( bounded )
+		{
+			if ( farSample.load() ) return false;
+			if ( dist.isWithinDistance(pt, maxDistance) ) return true;
+			farSample.store(sample);
+			return false;
+		}
+
+		// points no further than the maximum found don't change it
+		if ( blockHasMax[block] &&
+		     dist.isWithinDistance(pt, blockMax[block].getDistance()) )
+		{
+			return true;
+		}
+
+		PointPairDistance minPtDist;
+		dist.computeDistance(pt, minPtDist);
+		blockMax[block].setMaximum(minPtDist);
+		blockHasMax[block] = 1;
+		return true;
+	}
+
+	const IndexedDistanceToPoint& dist;
+	const std::vector<Coordinate>& vertices;
+	const std::vector<LineSegment>& segments;
+	std::size_t numSubSegs;
+	std::size_t segmentsPerBlock;
+	std::size_t vertexBlocks;
+	double maxDistance;
+	bool bounded;
+
+	std::vector<PointPairDistance> blockMax;
+	std::vector<char> blockHasMax;
+
+	/// Set when a sample point is found further than maxDistance
+	util::AtomicPointer<const Coordinate> farSample;
+
+	// Declare type as noncopyable
+	SampleTask(const SampleTask& other);
+	SampleTask& operator=(const SampleTask& rhs);
+};
+
 void
 DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter::filter_ro(
 	const geom::CoordinateSequence& seq, size_t index)
@@ -83,6 +275,36 @@ DiscreteHausdorffDistance::distance(const geom::Geometry& g0,
 	return dist.distance();
 }
 
+/* static public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(const geom::Geometry& g0,
+	                       const geom::Geometry& g1,
+	                       double maxDistance)
+{
+	DiscreteHausdorffDistance dist(g0, g1);
+	return dist.isWithinDistance(maxDistance);
+}
+
+/* static public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(const geom::Geometry& g0,
+	                       const geom::Geometry& g1,
+	                       double maxDistance, double densifyFrac)
+{
+	DiscreteHausdorffDistance dist(g0, g1);
+	dist.setDensifyFraction(densifyFrac);
+	return dist.isWithinDistance(maxDistance);
+}
+
+/* public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(double maxDistance)
+{
+	PointPairDistance boundedDist;
+	return computeOrientedDistance(g0, g1, boundedDist, maxDistance) &&
+	       computeOrientedDistance(g1, g0, boundedDist, maxDistance);
+}
+
 /* private */
 void
 DiscreteHausdorffDistance::computeOrientedDistance(
@@ -90,17 +312,49 @@ DiscreteHausdorffDistance::computeOrientedDistance(
 		const geom::Geometry& geom,
 		PointPairDistance& ptDist)
 {
-	MaxPointDistanceFilter distFilter(geom);
-	discreteGeom.apply_ro(&distFilter);
-	ptDist.setMaximum(distFilter.getMaxPointDistance());
+	computeOrientedDistance(discreteGeom, geom, ptDist, DoubleInfinity);
+}
+
+/* private */
+bool
+DiscreteHausdorffDistance::computeOrientedDistance(
+		const geom::Geometry& discreteGeom,
+		const geom::Geometry& geom,
+		PointPairDistance& ptDist,
+		double maxDistance)
+{
+	IndexedDistanceToPoint dist(geom);
+	// nothing to measure the sample points against
+	if ( dist.isEmpty() ) return true;
+
+	std::vector<Coordinate> vertices;
+	VertexCollector vertexCollector(vertices);
+	discreteGeom.apply_ro(&vertexCollector);
 
+	std::vector<LineSegment> segments;
+	std::size_t numSubSegs = 1;
 	if (densifyFrac > 0)
 	{
-		MaxDensifiedByFractionDistanceFilter fracFilter(geom,
-							  densifyFrac);
-		discreteGeom.apply_ro(fracFilter);
-		ptDist.setMaximum(fracFilter.getMaxPointDistance());
+		numSubSegs = std::size_t(util::round(1.0/densifyFrac));
+		SegmentCollector segmentCollector(segments);
+		discreteGeom.apply_ro(segmentCollector);
 	}
+
+	SampleTask task(dist, vertices, segments, numSubSegs, maxDistance);
+	const std::size_t blocks = task.getNumBlocks();
+
+	util::TaskRunner runner(numThreads);
+	if ( runner.getNumThreads() == 1 || blocks < 2 )
+	{
+		for (std::size_t b = 0; b < blocks; ++b)
+			task.run(b);
+	}
+	else
+	{
+		runner.run(task, blocks);
+	}
+
+	return task.getMaxPointDistance(ptDist);
 }
 
 } // namespace geos.algorithm.distance
@@ -0,0 +1,127 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/distance/IndexedDistanceToPoint.h>
+#include <geos/algorithm/distance/PointPairDistance.h>
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/geom/util/PointExtracter.h>
+#include <geos/platform.h> // for DoubleInfinity
+
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace algorithm { // geos.algorithm
+namespace distance { // geos.algorithm.distance
+
+namespace { // anonymous
+
+/*
+ * Distance from the query point to the closest point of a facet,
+ * computed as DistanceToPoint does
+ */
+class PointFacetDistance : public index::strtree::ItemDistance
+{
+public:
+	double distance(const void* item1, const void* item2)
+	{
+		const Coordinate& pt = *static_cast<const Coordinate*>(item1);
+		const LineSegment& seg = *static_cast<const LineSegment*>(item2);
+		Coordinate closestPt;
+		seg.closestPoint(pt, closestPt);
+		return closestPt.distance(pt);
+	}
+};
+
+} // anonymous namespace
+
+/*public*/
+IndexedDistanceToPoint::IndexedDistanceToPoint(const Geometry& geom)
+{
+	LineString::ConstVect lines;
+	util::LinearComponentExtracter::getLines(geom, lines);
+	for (std::size_t i=0, ni=lines.size(); i<ni; ++i)
+	{
+		const CoordinateSequence* pts = lines[i]->getCoordinatesRO();
+		for (std::size_t j=1, nj=pts->size(); j<nj; ++j)
+			facets.push_back(LineSegment(pts->getAt(j-1), pts->getAt(j)));
+	}
+
+	Point::ConstVect points;
+	util::PointExtracter::getPoints(geom, points);
+	for (std::size_t i=0, ni=points.size(); i<ni; ++i)
+	{
+		if ( points[i]->isEmpty() ) continue;
+		const Coordinate& pt = *points[i]->getCoordinate();
+		facets.push_back(LineSegment(pt, pt));
+	}
+
+	for (std::size_t i=0, ni=facets.size(); i<ni; ++i)
+	{
+		Envelope env(facets[i].p0, facets[i].p1);
+		tree.insert(&env, &facets[i]);
+	}
+	if ( ! tree.isEmpty() ) tree.build();
+}
+
+IndexedDistanceToPoint::~IndexedDistanceToPoint()
+{
+}
+
+/*public*/
+void
+IndexedDistanceToPoint::computeDistance(const Coordinate& pt,
+		PointPairDistance& ptDist) const
+{
+	const LineSegment* seg = nearestFacet(pt, DoubleInfinity);
+	if ( ! seg ) return;
+
+	Coordinate closestPt;
+	seg->closestPoint(pt, closestPt);
+	ptDist.setMinimum(closestPt, pt);
+}
+
+/*public*/
+bool
+IndexedDistanceToPoint::isWithinDistance(const Coordinate& pt,
+		double maxDistance) const
+{
+	return nearestFacet(pt, maxDistance) != 0;
+}
+
+/*private*/
+const LineSegment*
+IndexedDistanceToPoint::nearestFacet(const Coordinate& pt,
+		double maxDistance) const
+{
+	if ( tree.isEmpty() ) return 0;
+
+	Envelope env(pt);
+	PointFacetDistance itemDist;
+	std::vector<void*> nearest;
+	tree.nearestNeighbours(&env, &pt, itemDist, 1, nearest, maxDistance);
+	if ( nearest.empty() ) return 0;
+	return static_cast<const LineSegment*>(nearest[0]);
+}
+
+} // namespace geos.algorithm.distance
+} // namespace geos.algorithm
+} // namespace geos
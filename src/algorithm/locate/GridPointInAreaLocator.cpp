@@ -0,0 +1,386 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/algorithm/RayCrossingCounter.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TaskRunner.h>
+
+#include <algorithm>
+#include <utility>
+#include <typeinfo>
+#include <cmath>
+#include <cfloat>
+
+namespace geos {
+namespace algorithm {
+namespace locate {
+
+namespace {
+
+/// Number of points located by a batch task unit
+const std::size_t BATCH_BLOCK_SIZE = 1024;
+
+/// Upper bound of the number of cells chosen automatically
+const std::size_t MAX_AUTO_CELLS = 1 << 20;
+
+/// Cells per segment chosen automatically
+const std::size_t AUTO_CELLS_PER_SEGMENT = 4;
+
+/// Fraction of a cell by which segments are widened when listed in
+/// cells, on top of the rounding error of the ordinates
+const double CELL_TOLERANCE = 1e-6;
+
+/// A segment to be listed in a cell
+struct CellSpan {
+	std::size_t cell;
+	std::size_t vertex;
+	std::size_t firstCol;
+};
+
+struct CellSpanLessThan
+{
+	bool operator()( const CellSpan & a, const CellSpan & b) const
+	{
+		return a.cell < b.cell;
+	}
+};
+
+} // anonymous namespace
+
+class GridPointInAreaLocator::BatchTask : public util::TaskRunner::Task
+{
+public:
+	BatchTask( const GridPointInAreaLocator & l, const double * xs,
+	           const double * ys, std::size_t count, int * locs)
+	:	locator( l), x( xs), y( ys), n( count), locations( locs)
+	{ }
+
+	void run( std::size_t block)
+	{
+		const std::size_t end = (std::min)( n, (block + 1) * BATCH_BLOCK_SIZE);
+		for ( std::size_t i = block * BATCH_BLOCK_SIZE; i < end; ++i )
+			locations[ i ] = locator.locate( geom::Coordinate( x[ i ], y[ i ]));
+	}
+
+private:
+	const GridPointInAreaLocator & locator;
+	const double * x;
+	const double * y;
+	std::size_t n;
+	int * locations;
+
+	// Declare type as noncopyable
+	BatchTask(const BatchTask& other);
+	BatchTask& operator=(const BatchTask& rhs);
+};
+
+//
+// public:
+//
+GridPointInAreaLocator::GridPointInAreaLocator( const geom::Geometry & g,
+	std::size_t numCells)
+:	minX( 0), minY( 0), maxX( 0), maxY( 0),
+	cellWidth( 1), cellHeight( 1),
+	numCols( 0), numRows( 0)
+{
+	if (	typeid( g) != typeid( geom::Polygon)
+		&&	typeid( g) != typeid( geom::MultiPolygon) )
+		throw util::IllegalArgumentException("Argument must be Polygonal");
+
+	init( g);
+
+	if ( segments.empty() ) return;
+
+	if ( ! numCells )
+	{
+		numCells = (std::min)( MAX_AUTO_CELLS,
+		                       AUTO_CELLS_PER_SEGMENT * segments.size());
+	}
+	buildGrid( numCells);
+}
+
+GridPointInAreaLocator::~GridPointInAreaLocator()
+{
+}
+
+int
+GridPointInAreaLocator::locate( const geom::Coordinate * /*const*/ p)
+{
+	return locate( *p);
+}
+
+void
+GridPointInAreaLocator::locate( const double * x, const double * y,
+	std::size_t n, int * locations, unsigned int numThreads)
+{
+	BatchTask task( *this, x, y, n, locations);
+	const std::size_t blocks = ( n + BATCH_BLOCK_SIZE - 1 ) / BATCH_BLOCK_SIZE;
+
+	util::TaskRunner runner( numThreads);
+	if ( runner.getNumThreads() == 1 || blocks < 2 )
+	{
+		for ( std::size_t b = 0; b < blocks; ++b )
+			task.run( b);
+		return;
+	}
+
+	runner.run( task, blocks);
+}
+
+std::size_t
+GridPointInAreaLocator::getNumBoundaryCells() const
+{
+	return std::count( cells.begin(), cells.end(),
+	                   (unsigned char)geom::Location::BOUNDARY);
+}
+
+//
+// private:
+//
+void
+GridPointInAreaLocator::init( const geom::Geometry & g)
+{
+	geom::LineString::ConstVect lines;
+	geom::util::LinearComponentExtracter::getLines( g, lines);
+
+	for ( std::size_t i = 0, ni = lines.size(); i < ni; i++ )
+	{
+		const geom::CoordinateSequence * pts = lines[ i ]->getCoordinatesRO();
+		const std::size_t np = pts->size();
+		if ( np < 2 ) continue;
+
+		const std::size_t base = vertices.size();
+		for ( std::size_t j = 0; j < np; j++ )
+			vertices.push_back( pts->getAt( j));
+		for ( std::size_t j = 1; j < np; j++ )
+			segments.push_back( base + j - 1);
+	}
+
+	if ( segments.empty() ) return;
+
+	const geom::Envelope & env = *g.getEnvelopeInternal();
+	minX = env.getMinX();
+	minY = env.getMinY();
+	maxX = env.getMaxX();
+	maxY = env.getMaxY();
+}
+
+void
+GridPointInAreaLocator::buildGrid( std::size_t numCells)
+{
+	const double width = maxX - minX;
+	const double height = maxY - minY;
+
+	// cells about as wide as high
+	numCols = numRows = 1;
+	if ( width > 0 && height > 0 )
+	{
+		const double cols = std::sqrt( double( numCells) * width / height);
+		numCols = std::size_t( (std::min)( double( numCells), (std::max)( 1.0, cols)));
+		numRows = (std::max)( std::size_t( 1), numCells / numCols);
+	}
+	else if ( width > 0 )
+		numCols = numCells;
+	else if ( height > 0 )
+		numRows = numCells;
+
+	if ( width > 0 ) cellWidth = width / numCols;
+	if ( height > 0 ) cellHeight = height / numRows;
+
+	// widening of the segments, in cells
+	const double tolX = CELL_TOLERANCE + 16 * DBL_EPSILON
+		* (std::max)( std::fabs( minX), std::fabs( maxX)) / cellWidth;
+	const double tolY = CELL_TOLERANCE + 16 * DBL_EPSILON
+		* (std::max)( std::fabs( minY), std::fabs( maxY)) / cellHeight;
+
+	// List each segment in the cells it may touch, row by row, and
+	// find where it crosses the center line of each row
+	std::vector<CellSpan> spans;
+	std::vector< std::pair<std::size_t, double> > crossings;
+	spans.reserve( 2 * segments.size());
+
+	for ( std::size_t i = 0, ni = segments.size(); i < ni; ++i )
+	{
+		const geom::Coordinate & p0 = vertices[ segments[ i ] ];
+		const geom::Coordinate & p1 = vertices[ segments[ i ] + 1 ];
+
+		const std::size_t r0 = row( (std::min)( p0.y, p1.y), -tolY);
+		const std::size_t r1 = row( (std::max)( p0.y, p1.y), tolY);
+		for ( std::size_t r = r0; r <= r1; ++r )
+		{
+			const double bandMin = minY + r * cellHeight;
+			const double bandMax = bandMin + cellHeight;
+
+			double xa = p0.x;
+			double xb = p1.x;
+			if ( p0.y != p1.y )
+			{
+				const double dy = p1.y - p0.y;
+				const double ta = (std::max)( 0.0, (std::min)( 1.0, ( bandMin - p0.y ) / dy));
+				const double tb = (std::max)( 0.0, (std::min)( 1.0, ( bandMax - p0.y ) / dy));
+				xa = p0.x + ta * ( p1.x - p0.x );
+				xb = p0.x + tb * ( p1.x - p0.x );
+			}
+
+			CellSpan span;
+			span.vertex = segments[ i ];
+			span.firstCol = column( (std::min)( xa, xb), -tolX);
+			const std::size_t lastCol = column( (std::max)( xa, xb), tolX);
+			for ( std::size_t c = span.firstCol; c <= lastCol; ++c )
+			{
+				span.cell = r * numCols + c;
+				spans.push_back( span);
+			}
+
+			const double yc = bandMin + 0.5 * cellHeight;
+			if ( ( p0.y > yc ) != ( p1.y > yc ) )
+			{
+				const double x = p0.x + ( yc - p0.y ) * ( p1.x - p0.x ) / ( p1.y - p0.y );
+				crossings.push_back( std::make_pair( r, x));
+			}
+		}
+	}
+
+	// Segments of each cell
+	const std::size_t n = numCols * numRows;
+	std::stable_sort( spans.begin(), spans.end(), CellSpanLessThan());
+	cellStart.assign( n + 1, 0);
+	cellSegments.resize( spans.size());
+	for ( std::size_t i = 0, ni = spans.size(); i < ni; ++i )
+	{
+		++cellStart[ spans[ i ].cell + 1 ];
+		cellSegments[ i ].vertex = spans[ i ].vertex;
+		cellSegments[ i ].firstCol = spans[ i ].firstCol;
+	}
+	for ( std::size_t i = 0; i < n; ++i )
+		cellStart[ i + 1 ] += cellStart[ i ];
+	std::vector<CellSpan>().swap( spans);
+
+	// Cells without segments lie on one side of the boundary, given
+	// by the parity of the crossings right of their center
+	std::sort( crossings.begin(), crossings.end());
+	cells.assign( n, (unsigned char)geom::Location::EXTERIOR);
+	std::size_t k = 0;
+	for ( std::size_t r = 0; r < numRows; ++r )
+	{
+		const std::size_t begin = k;
+		while ( k < crossings.size() && crossings[ k ].first == r ) ++k;
+		const std::size_t end = k;
+
+		std::size_t right = begin;
+		for ( std::size_t c = 0; c < numCols; ++c )
+		{
+			const std::size_t cell = r * numCols + c;
+			if ( cellStart[ cell ] != cellStart[ cell + 1 ] )
+			{
+				cells[ cell ] = geom::Location::BOUNDARY;
+				continue;
+			}
+
+			const double xc = minX + ( c + 0.5 ) * cellWidth;
+			while ( right < end && crossings[ right ].second <= xc ) ++right;
+			if ( ( end - right ) % 2 )
+				cells[ cell ] = geom::Location::INTERIOR;
+		}
+	}
+}
+
+std::size_t
+GridPointInAreaLocator::column( double x, double tolerance) const
+{
+	const double c = ( x - minX ) / cellWidth + tolerance;
+	if ( ! ( c > 0 ) ) return 0;
+	if ( c >= numCols ) return numCols - 1;
+	return std::size_t( c);
+}
+
+std::size_t
+GridPointInAreaLocator::row( double y, double tolerance) const
+{
+	const double r = ( y - minY ) / cellHeight + tolerance;
+	if ( ! ( r > 0 ) ) return 0;
+	if ( r >= numRows ) return numRows - 1;
+	return std::size_t( r);
+}
+
+int
+GridPointInAreaLocator::locate( const geom::Coordinate & p) const
+{
+	if ( cells.empty()
+	     || ! ( p.x >= minX && p.x <= maxX && p.y >= minY && p.y <= maxY ) )
+		return geom::Location::EXTERIOR;
+
+	const std::size_t r = row( p.y, 0);
+	const std::size_t c = column( p.x, 0);
+	const unsigned char * rowCells = &cells[ r * numCols ];
+	if ( rowCells[ c ] != geom::Location::BOUNDARY )
+		return rowCells[ c ];
+
+	// The ray from p crosses the segments of the boundary cells up
+	// to the first cell off the boundary, whose location is known
+	std::size_t end = c + 1;
+	while ( end < numCols && rowCells[ end ] == geom::Location::BOUNDARY )
+		++end;
+
+	// Crossings beyond the edge of that cell are counted from there
+	// too, to be discounted
+	RayCrossingCounter rcc( p);
+	const geom::Coordinate edge( minX + end * cellWidth, p.y);
+	RayCrossingCounter edgeRcc( edge);
+
+	for ( std::size_t col = c; col < end; ++col )
+	{
+		const std::size_t cell = r * numCols + col;
+		for ( std::size_t i = cellStart[ cell ], ni = cellStart[ cell + 1 ]; i < ni; ++i )
+		{
+			// count segments spanning several cells only once
+			const CellSegment & seg = cellSegments[ i ];
+			if ( (std::max)( seg.firstCol, c) != col ) continue;
+
+			const geom::Coordinate & p0 = vertices[ seg.vertex ];
+			const geom::Coordinate & p1 = vertices[ seg.vertex + 1 ];
+			rcc.countSegment( p0, p1);
+			if ( rcc.isOnSegment() ) return geom::Location::BOUNDARY;
+			if ( end < numCols ) edgeRcc.countSegment( p0, p1);
+		}
+	}
+
+	if ( end == numCols ) return rcc.getLocation();
+
+	const bool crossed = ( rcc.getLocation() == geom::Location::INTERIOR )
+		!= ( edgeRcc.getLocation() == geom::Location::INTERIOR );
+	const bool interior = crossed
+		!= ( rowCells[ end ] == geom::Location::INTERIOR );
+	return interior ? geom::Location::INTERIOR : geom::Location::EXTERIOR;
+}
+
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
+
+/**********************************************************************
+ * $Log$
+ *
+ **********************************************************************/
+
@@ -19,13 +19,13 @@
 #include <geos/geom/Polygon.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/LineString.h>
-#include <geos/geom/LineSegment.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/util/LinearComponentExtracter.h>
-#include <geos/index/intervalrtree/SortedPackedIntervalRTree.h>
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/algorithm/RayCrossingCounter.h>
-#include <geos/index/ItemVisitor.h> 
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+#include <geos/util/TaskRunner.h>
 
 #include <algorithm>
 #include <typeinfo>
@@ -33,56 +33,270 @@
 namespace geos {
 namespace algorithm { 
 namespace locate { 
+
+namespace {
+
+/// Number of points located by a batch task unit
+const std::size_t BATCH_BLOCK_SIZE = 1024;
+
+/// Counts the visited segments crossing the ray of a point
+class SegmentCounter
+{
+public:
+	SegmentCounter( RayCrossingCounter & c)
+	:	counter( c)
+	{ }
+
+	void visit( double x0, double y0, double x1, double y1)
+	{
+		counter.countSegment( geom::Coordinate( x0, y0),
+		                      geom::Coordinate( x1, y1));
+	}
+
+private:
+	RayCrossingCounter & counter;
+};
+
+/// Collects the visited segments as ordinate arrays
+class SegmentCollector
+{
+public:
+	std::vector<double> x0, y0, x1, y1;
+
+	void clear()
+	{
+		x0.clear(); y0.clear(); x1.clear(); y1.clear();
+	}
+
+	void visit( double sx0, double sy0, double sx1, double sy1)
+	{
+		x0.push_back( sx0);
+		y0.push_back( sy0);
+		x1.push_back( sx1);
+		y1.push_back( sy1);
+	}
+};
+
+template <class Segment>
+struct MidYLessThan
+{
+	bool operator()( const Segment & a, const Segment & b) const
+	{
+		return a.y.min + a.y.max < b.y.min + b.y.max;
+	}
+};
+
+} // anonymous namespace
+
+class IndexedPointInAreaLocator::BatchTask : public util::TaskRunner::Task
+{
+public:
+	BatchTask( IndexedPointInAreaLocator & l, const double * xs,
+	           const double * ys, std::size_t count, int * locs)
+	:	locator( l), x( xs), y( ys), n( count), locations( locs)
+	{ }
+
+	void run( std::size_t block)
+	{
+		const geom::Envelope & env = *locator.areaGeom.getEnvelopeInternal();
+		const std::size_t end = (std::min)( n, (block + 1) * BATCH_BLOCK_SIZE);
+
+		SegmentCollector segs;
+		for ( std::size_t i = block * BATCH_BLOCK_SIZE; i < end; ++i )
+		{
+			if ( ! env.covers( x[ i ], y[ i ]) )
+			{
+				locations[ i ] = geom::Location::EXTERIOR;
+				continue;
+			}
+
+			segs.clear();
+			locator.index->query( y[ i ], y[ i ], segs);
+
+			const std::size_t ns = segs.x0.size();
+			locations[ i ] = ns ? RayCrossingCounter::locatePointInSegments(
+				geom::Coordinate( x[ i ], y[ i ]),
+				&segs.x0[ 0 ], &segs.y0[ 0 ], &segs.x1[ 0 ], &segs.y1[ 0 ], ns)
+				: geom::Location::EXTERIOR;
+		}
+	}
+
+private:
+	IndexedPointInAreaLocator & locator;
+	const double * x;
+	const double * y;
+	std::size_t n;
+	int * locations;
+
+	// Declare type as noncopyable
+	BatchTask(const BatchTask& other);
+	BatchTask& operator=(const BatchTask& rhs);
+};
 //
 // private:
 //
 IndexedPointInAreaLocator::IntervalIndexedGeometry::IntervalIndexedGeometry( const geom::Geometry & g)
 {
-	index = new index::intervalrtree::SortedPackedIntervalRTree();
 	init( g);
+	buildTree();
 }
 
-IndexedPointInAreaLocator::IntervalIndexedGeometry::~IntervalIndexedGeometry( )
+void 
+IndexedPointInAreaLocator::IntervalIndexedGeometry::init( const geom::Geometry & g)
 {
-	delete index;
+	geom::LineString::ConstVect lines;
+	geom::util::LinearComponentExtracter::getLines( g, lines);
+
+	std::size_t numSegments = 0;
+	std::size_t numOwned = 0;
+	for ( size_t i = 0, ni = lines.size(); i < ni; i++ )
+	{
+		const std::size_t np = lines[ i ]->getNumPoints();
+		if ( np > 1 ) numSegments += np - 1;
+	}
+	segments.reserve( numSegments);
+	rings.reserve( lines.size());
+
+	// Offsets in ownedOrdinates of the rings copied there, which
+	// can only be pointed to once all of them are copied
+	std::vector< std::pair<std::size_t, std::size_t> > copied;
+
+	for ( size_t i = 0, ni = lines.size(); i < ni; i++ )
+	{
+		const geom::CoordinateSequence * pts = lines[ i ]->getCoordinatesRO();
+		const std::size_t np = pts->size();
+		if ( np < 2 ) continue;
+
+		geom::CoordinateSequence::OrdinateSpan span;
+		Ring ring;
+		if ( pts->getOrdinateSpan( span) )
+		{
+			ring.x = span.x;
+			ring.y = span.y;
+			ring.stride = span.stride;
+		}
+		else
+		{
+			copied.push_back( std::make_pair( rings.size(), numOwned));
+			ring.x = ring.y = 0;
+			ring.stride = 2;
+			for ( size_t j = 0; j < np; j++ )
+			{
+				const geom::Coordinate & c = pts->getAt( j);
+				ownedOrdinates.push_back( c.x);
+				ownedOrdinates.push_back( c.y);
+			}
+			numOwned += 2 * np;
+		}
+
+		Segment seg;
+		seg.ring = rings.size();
+		for ( size_t j = 1; j < np; j++ )
+		{
+			const double y0 = pts->getAt( j - 1).y;
+			const double y1 = pts->getAt( j).y;
+			seg.y.min = (std::min)( y0, y1);
+			seg.y.max = (std::max)( y0, y1);
+			seg.vertex = j - 1;
+			segments.push_back( seg);
+		}
+		rings.push_back( ring);
+	}
 
-	for ( size_t i = 0, ni = allocatedSegments.size(); i < ni; ++i ) 
+	for ( size_t i = 0, ni = copied.size(); i < ni; i++ )
 	{
-		delete allocatedSegments[i];
+		Ring & ring = rings[ copied[ i ].first ];
+		ring.x = &ownedOrdinates[ copied[ i ].second ];
+		ring.y = ring.x + 1;
 	}
 }
 
 void 
-IndexedPointInAreaLocator::IntervalIndexedGeometry::init( const geom::Geometry & g)
+IndexedPointInAreaLocator::IntervalIndexedGeometry::buildTree()
 {
-	geom::LineString::ConstVect lines;
-	geom::util::LinearComponentExtracter::getLines( g, lines);
+	levels.push_back( 0);
+	if ( segments.empty() ) return;
 
-	for ( size_t i = 0, ni = lines.size(); i < ni; i++ )
-	{
-		const geom::LineString * line = lines[ i ];
-		geom::CoordinateSequence * pts = line->getCoordinates();
+	std::sort( segments.begin(), segments.end(), MidYLessThan<Segment>());
 
-		addLine( pts);
+	nodes.reserve( segments.size() / ( NODE_CAPACITY - 1 ) + 1);
 
-		delete pts;
+	// the leaf parents, grouping segments
+	for ( std::size_t i = 0, n = segments.size(); i < n; i += NODE_CAPACITY )
+	{
+		Interval node = segments[ i ].y;
+		for ( std::size_t j = i + 1, nj = (std::min)( n, i + NODE_CAPACITY); j < nj; ++j )
+		{
+			node.min = (std::min)( node.min, segments[ j ].y.min);
+			node.max = (std::max)( node.max, segments[ j ].y.max);
+		}
+		nodes.push_back( node);
+	}
+	levels.push_back( nodes.size());
+
+	// the upper levels, up to a single root
+	while ( levels[ levels.size() - 1 ] - levels[ levels.size() - 2 ] > 1 )
+	{
+		const std::size_t begin = levels[ levels.size() - 2 ];
+		const std::size_t end = levels[ levels.size() - 1 ];
+		for ( std::size_t i = begin; i < end; i += NODE_CAPACITY )
+		{
+			Interval node = nodes[ i ];
+			for ( std::size_t j = i + 1, nj = (std::min)( end, i + NODE_CAPACITY); j < nj; ++j )
+			{
+				node.min = (std::min)( node.min, nodes[ j ].min);
+				node.max = (std::max)( node.max, nodes[ j ].max);
+			}
+			nodes.push_back( node);
+		}
+		levels.push_back( nodes.size());
 	}
 }
 
+template <class Visitor>
 void 
-IndexedPointInAreaLocator::IntervalIndexedGeometry::addLine( geom::CoordinateSequence * pts)
+IndexedPointInAreaLocator::IntervalIndexedGeometry::query( double min, double max, Visitor & visitor) const
 {
-	for ( size_t i = 1, ni = pts->size(); i < ni; i++ ) 
+	if ( nodes.empty() ) return;
+
+	const std::size_t top = levels.size() - 2;
+	const Interval & root = nodes[ levels[ top ] ];
+	if ( root.min > max || root.max < min ) return;
+
+	queryNode( top, 0, min, max, visitor);
+}
+
+template <class Visitor>
+void 
+IndexedPointInAreaLocator::IntervalIndexedGeometry::queryNode( std::size_t level, std::size_t node, double min, double max, Visitor & visitor) const
+{
+	const std::size_t begin = node * NODE_CAPACITY;
+
+	if ( level == 0 )
+	{
+		const std::size_t end = (std::min)( segments.size(), begin + NODE_CAPACITY);
+		for ( std::size_t i = begin; i < end; ++i )
+		{
+			const Segment & seg = segments[ i ];
+			if ( seg.y.min > max || seg.y.max < min ) continue;
+
+			const Ring & ring = rings[ seg.ring ];
+			const std::size_t i0 = seg.vertex * ring.stride;
+			const std::size_t i1 = i0 + ring.stride;
+			visitor.visit( ring.x[ i0 ], ring.y[ i0 ], ring.x[ i1 ], ring.y[ i1 ]);
+		}
+		return;
+	}
+
+	const std::size_t offset = levels[ level - 1 ];
+	const std::size_t end = (std::min)( levels[ level ] - offset, begin + NODE_CAPACITY);
+	for ( std::size_t i = begin; i < end; ++i )
 	{
-		geom::LineSegment * seg = new geom::LineSegment( (*pts)[ i - 1 ], (*pts)[ i ]);
-		double const min = (std::min)( seg->p0.y, seg->p1.y);
-		double const max = (std::max)( seg->p0.y, seg->p1.y);
-		
-		// NOTE: seg ownership still ours
-		allocatedSegments.push_back(seg);
-		index->insert( min, max, seg);
+		const Interval & child = nodes[ offset + i ];
+		if ( child.min > max || child.max < min ) continue;
+		queryNode( level - 1, i, min, max, visitor);
 	}
-} 
+}
 
 
 void 
@@ -121,25 +335,29 @@ IndexedPointInAreaLocator::locate( const geom::Coordinate * /*const*/ p)
 {
 	algorithm::RayCrossingCounter rcc(*p);
 
-	IndexedPointInAreaLocator::SegmentVisitor visitor( &rcc);
+	SegmentCounter visitor( rcc);
 
-	index->query( p->y, p->y, &visitor);
+	index->query( p->y, p->y, visitor);
 
 	return rcc.getLocation();
 }
 
-void 
-IndexedPointInAreaLocator::SegmentVisitor::visitItem( void * item)
+void
+IndexedPointInAreaLocator::locate( const double * x, const double * y,
+	std::size_t n, int * locations, unsigned int numThreads)
 {
-	geom::LineSegment * seg = (geom::LineSegment *)item;
+	BatchTask task( *this, x, y, n, locations);
+	const std::size_t blocks = ( n + BATCH_BLOCK_SIZE - 1 ) / BATCH_BLOCK_SIZE;
 
-	counter->countSegment( (*seg)[ 0 ], (*seg)[ 1 ]);
-}
+	util::TaskRunner runner( numThreads);
+	if ( runner.getNumThreads() == 1 || blocks < 2 )
+	{
+		for ( std::size_t b = 0; b < blocks; ++b )
+			task.run( b);
+		return;
+	}
 
-void 
-IndexedPointInAreaLocator::IntervalIndexedGeometry::query( double min, double max, index::ItemVisitor * visitor)
-{
-	index->query( min, max, visitor);
+	runner.run( task, blocks);
 }
 
 
@@ -0,0 +1,129 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/algorithm/locate/IndexedPointOnLineLocator.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace geos {
+namespace algorithm {
+namespace locate {
+
+//
+// public:
+//
+IndexedPointOnLineLocator::IndexedPointOnLineLocator( const geom::Geometry & g)
+{
+	std::vector<const geom::LineString*> lines;
+	geom::util::LinearComponentExtracter::getLines( g, lines);
+
+	for ( std::size_t i = 0, ni = lines.size(); i < ni; i++ )
+	{
+		const geom::CoordinateSequence * pts = lines[ i ]->getCoordinatesRO();
+		std::size_t n = pts->size();
+		if ( n == 1 )
+			segments.push_back( geom::LineSegment( pts->getAt( 0), pts->getAt( 0)));
+		for ( std::size_t j = 1; j < n; j++ )
+			segments.push_back( geom::LineSegment( pts->getAt( j-1), pts->getAt( j)));
+	}
+
+	for ( std::size_t i = 0, ni = segments.size(); i < ni; i++ )
+	{
+		geom::Envelope env( segments[ i ].p0, segments[ i ].p1);
+		index.insert( &env, &segments[ i ]);
+	}
+	if ( ! index.isEmpty() ) index.build();
+
+	computeBoundary( g, boundary);
+}
+
+IndexedPointOnLineLocator::~IndexedPointOnLineLocator()
+{
+}
+
+int
+IndexedPointOnLineLocator::locate( const geom::Coordinate * /*const*/ p)
+{
+	if ( isBoundary( *p) )
+		return geom::Location::BOUNDARY;
+
+	if ( index.isEmpty() )
+		return geom::Location::EXTERIOR;
+
+	geom::Envelope env( *p);
+	std::vector<void*> matches;
+	index.query( &env, matches);
+
+	LineIntersector li;
+	for ( std::size_t i = 0, ni = matches.size(); i < ni; i++ )
+	{
+		const geom::LineSegment * seg =
+			static_cast<const geom::LineSegment*>( matches[ i ]);
+		li.computeIntersection( *p, seg->p0, seg->p1);
+		if ( li.hasIntersection() )
+			return geom::Location::INTERIOR;
+	}
+	return geom::Location::EXTERIOR;
+}
+
+bool
+IndexedPointOnLineLocator::isBoundary( const geom::Coordinate & p) const
+{
+	return std::binary_search( boundary.begin(), boundary.end(), p,
+	                           geom::CoordinateLessThen());
+}
+
+/*public static*/
+void
+IndexedPointOnLineLocator::computeBoundary( const geom::Geometry & g,
+                                            std::vector<geom::Coordinate> & boundary)
+{
+	std::vector<const geom::LineString*> lines;
+	geom::util::LinearComponentExtracter::getLines( g, lines);
+
+	std::vector<geom::Coordinate> endpoints;
+	for ( std::size_t i = 0, ni = lines.size(); i < ni; i++ )
+	{
+		const geom::LineString * line = lines[ i ];
+		if ( line->isEmpty() || line->isClosed() ) continue;
+		const geom::CoordinateSequence * pts = line->getCoordinatesRO();
+		endpoints.push_back( pts->getAt( 0));
+		endpoints.push_back( pts->getAt( pts->size() - 1));
+	}
+
+	std::sort( endpoints.begin(), endpoints.end(), geom::CoordinateLessThen());
+
+	// Mod-2 rule: endpoints of an odd number of lines
+	boundary.clear();
+	for ( std::size_t i = 0, ni = endpoints.size(); i < ni; )
+	{
+		std::size_t j = i + 1;
+		while ( j < ni && endpoints[ j ].equals2D( endpoints[ i ]) ) j++;
+		if ( ( j - i ) % 2 == 1 )
+			boundary.push_back( endpoints[ i ]);
+		i = j;
+	}
+}
+
+} // namespace geos.algorithm.locate
+} // namespace geos.algorithm
+} // namespace geos
@@ -46,11 +46,11 @@ Coordinate::toString() const
 
 std::ostream& operator<< (std::ostream& os, const Coordinate& c)
 {
-	if ( ISNAN(c.z) )
+	if ( ISNAN(c.getZ()) )
 	{
 		os << c.x << " " << c.y;
 	} else {
-		os << c.x << " " << c.y << " " << c.z;
+		os << c.x << " " << c.y << " " << c.getZ();
 	}
 	return os;
 }
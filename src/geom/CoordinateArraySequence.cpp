@@ -81,13 +81,17 @@ CoordinateArraySequence::toVector() const
 std::size_t 
 CoordinateArraySequence::getDimension() const
 {
+#ifdef GEOS_COORDINATE_2D
+    return 2;
+#endif
+
     if( dimension != 0 )
         return dimension;
 
     if( vect->size() == 0 )
         return 3;
 
-    if( ISNAN((*vect)[0].z) )
+    if( ISNAN((*vect)[0].getZ()) )
         dimension = 2;
     else
         dimension = 3;
@@ -202,6 +206,23 @@ CoordinateArraySequence::expandEnvelope(Envelope &env) const
 		env.expandToInclude((*vect)[i]);
 }
 
+bool
+CoordinateArraySequence::getOrdinateSpan(OrdinateSpan& span) const
+{
+	if ( sizeof(Coordinate) % sizeof(double) ) return false;
+
+	span.stride = sizeof(Coordinate) / sizeof(double);
+	span.size = vect->size();
+	if ( vect->empty() )
+	{
+		span.x = span.y = 0;
+		return true;
+	}
+	span.x = &(*vect)[0].x;
+	span.y = &(*vect)[0].y;
+	return true;
+}
+
 double
 CoordinateArraySequence::getOrdinate(size_t index, size_t ordinateIndex) const
 {
@@ -212,7 +233,7 @@ CoordinateArraySequence::getOrdinate(size_t index, size_t ordinateIndex) const
 		case CoordinateSequence::Y:
 			return (*vect)[index].y;
 		case CoordinateSequence::Z:
-			return (*vect)[index].z;
+			return (*vect)[index].getZ();
 		default:
 			return DoubleNotANumber;
 	}
@@ -231,7 +252,7 @@ CoordinateArraySequence::setOrdinate(size_t index, size_t ordinateIndex,
 			(*vect)[index].y = value;
 			break;
 		case CoordinateSequence::Z:
-			(*vect)[index].z = value;
+			(*vect)[index].setZ(value);
 			break;
 		default:
 		{
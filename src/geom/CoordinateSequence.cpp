@@ -262,12 +262,52 @@ CoordinateSequence::removeRepeatedPoints(const CoordinateSequence *cl)
 	return ret;
 }
 
+namespace {
+
+/// Computes the ordinate ranges of a sequence, see applyOrdinateFilter
+struct EnvelopeFilter {
+	Envelope& env;
+
+	EnvelopeFilter(Envelope& e) : env(e) {}
+
+	template <class Ordinates>
+	void filter(const Ordinates& pts, std::size_t npts)
+	{
+		if ( ! npts ) return;
+
+		double minx = pts.getX(0), maxx = minx;
+		double miny = pts.getY(0), maxy = miny;
+		for (std::size_t i=1; i<npts; ++i)
+		{
+			double x = pts.getX(i);
+			double y = pts.getY(i);
+			minx = x < minx ? x : minx;
+			maxx = x > maxx ? x : maxx;
+			miny = y < miny ? y : miny;
+			maxy = y > maxy ? y : maxy;
+		}
+		env.expandToInclude(minx, miny);
+		env.expandToInclude(maxx, maxy);
+	}
+
+private:
+	// Declare type as noncopyable
+	EnvelopeFilter& operator=(const EnvelopeFilter& rhs);
+};
+
+} // anonymous namespace
+
 void
 CoordinateSequence::expandEnvelope(Envelope &env) const
 {
-	const std::size_t size = getSize();
-	for (std::size_t i=0; i<size; i++)
-        env.expandToInclude(getAt(i));
+	EnvelopeFilter filter(env);
+	applyOrdinateFilter(filter);
+}
+
+bool
+CoordinateSequence::getOrdinateSpan(OrdinateSpan& /*span*/) const
+{
+	return false;
 }
 
 std::ostream& operator<< (std::ostream& os, const CoordinateSequence& cs)
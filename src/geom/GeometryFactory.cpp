@@ -238,7 +238,7 @@ GeometryFactory::createPoint(const Coordinate& coordinate) const
 	if (coordinate.isNull()) {
 		return createPoint();
 	} else {
-		std::size_t dim = ISNAN(coordinate.z) ? 2 : 3;
+		std::size_t dim = ISNAN(coordinate.getZ()) ? 2 : 3;
 		CoordinateSequence *cl = coordinateListFactory->create(new vector<Coordinate>(1, coordinate), dim);
 		//cl->setAt(coordinate, 0);
 		Point *ret = createPoint(cl);
@@ -0,0 +1,366 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/OrdinateArraySequence.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/Mutex.h>
+#include <geos/platform.h> // for ISNAN, DoubleNotANumber
+
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace geos {
+namespace geom { // geos::geom
+
+namespace {
+
+/// Serializes the building of the interleaved views, which is rare
+util::Mutex viewMutex;
+
+} // anonymous namespace
+
+OrdinateArraySequence::OrdinateArraySequence()
+	:
+	dimension(0)
+{
+}
+
+OrdinateArraySequence::OrdinateArraySequence(size_t n, size_t dimension_in)
+	:
+	xs(n, 0.0),
+	ys(n, 0.0),
+	dimension(dimension_in)
+{
+}
+
+OrdinateArraySequence::OrdinateArraySequence(const vector<Coordinate>& coords,
+                                             size_t dimension_in)
+	:
+	dimension(dimension_in)
+{
+	setPoints(coords);
+}
+
+OrdinateArraySequence::OrdinateArraySequence(const OrdinateArraySequence &c)
+	:
+	CoordinateSequence(c),
+	xs(c.xs),
+	ys(c.ys),
+	zs(c.zs),
+	dimension(c.dimension)
+{
+}
+
+OrdinateArraySequence::~OrdinateArraySequence()
+{
+	delete coordView.load();
+}
+
+CoordinateSequence *
+OrdinateArraySequence::clone() const
+{
+	return new OrdinateArraySequence(*this);
+}
+
+/*private*/
+void
+OrdinateArraySequence::allocateZ()
+{
+	zs.assign(xs.size(), DoubleNotANumber);
+}
+
+/*private*/
+void
+OrdinateArraySequence::setZ(size_t pos, double z)
+{
+	if ( zs.empty() )
+	{
+		if ( ISNAN(z) ) return;
+		allocateZ();
+	}
+	zs[pos] = z;
+}
+
+/*private*/
+const vector<Coordinate>&
+OrdinateArraySequence::coordinates() const
+{
+	const vector<Coordinate>* v = coordView.load();
+	if ( ! v )
+	{
+		util::Mutex::Lock lock(viewMutex);
+		v = coordView.load();
+		if ( ! v )
+		{
+			vector<Coordinate>* nv = new vector<Coordinate>(xs.size());
+			for (size_t i=0, n=xs.size(); i<n; ++i)
+				getAt(i, (*nv)[i]);
+			coordView.store(nv);
+			v = nv;
+		}
+	}
+	return *v;
+}
+
+/*private*/
+void
+OrdinateArraySequence::dropView()
+{
+	delete coordView.load();
+	coordView.store(0);
+}
+
+/*private*/
+void
+OrdinateArraySequence::updateView(size_t pos)
+{
+	vector<Coordinate>* v = const_cast<vector<Coordinate>*>(coordView.load());
+	if ( v ) getAt(pos, (*v)[pos]);
+}
+
+const Coordinate &
+OrdinateArraySequence::getAt(size_t pos) const
+{
+	return coordinates()[pos];
+}
+
+void
+OrdinateArraySequence::getAt(size_t pos, Coordinate &c) const
+{
+	c.x = xs[pos];
+	c.y = ys[pos];
+	c.setZ(zs.empty() ? DoubleNotANumber : zs[pos]);
+}
+
+const vector<Coordinate>*
+OrdinateArraySequence::toVector() const
+{
+	return &coordinates();
+}
+
+void
+OrdinateArraySequence::toVector(vector<Coordinate>& out) const
+{
+	out.reserve(out.size() + xs.size());
+	Coordinate c;
+	for (size_t i=0, n=xs.size(); i<n; ++i)
+	{
+		getAt(i, c);
+		out.push_back(c);
+	}
+}
+
+void
+OrdinateArraySequence::add(const Coordinate& c)
+{
+	dropView();
+	xs.push_back(c.x);
+	ys.push_back(c.y);
+	if ( ! zs.empty() ) zs.push_back(c.getZ());
+	else setZ(xs.size()-1, c.getZ());
+}
+
+void
+OrdinateArraySequence::add(const Coordinate& c, bool allowRepeated)
+{
+	if (!allowRepeated && ! xs.empty() )
+	{
+		if ( xs.back() == c.x && ys.back() == c.y ) return;
+	}
+	add(c);
+}
+
+/*public*/
+void
+OrdinateArraySequence::add(size_t i, const Coordinate& coord,
+                           bool allowRepeated)
+{
+	// don't add duplicate coordinates
+	if (! allowRepeated) {
+		size_t sz = size();
+		if (i > 0 && xs[i-1] == coord.x && ys[i-1] == coord.y) return;
+		if (i < sz && xs[i] == coord.x && ys[i] == coord.y) return;
+	}
+
+	dropView();
+	xs.insert(xs.begin()+i, coord.x);
+	ys.insert(ys.begin()+i, coord.y);
+	if ( ! zs.empty() ) zs.insert(zs.begin()+i, coord.getZ());
+	else setZ(i, coord.getZ());
+}
+
+void
+OrdinateArraySequence::setAt(const Coordinate& c, size_t pos)
+{
+	xs[pos] = c.x;
+	ys[pos] = c.y;
+	setZ(pos, c.getZ());
+	updateView(pos);
+}
+
+void
+OrdinateArraySequence::deleteAt(size_t pos)
+{
+	dropView();
+	xs.erase(xs.begin()+pos);
+	ys.erase(ys.begin()+pos);
+	if ( ! zs.empty() ) zs.erase(zs.begin()+pos);
+}
+
+string
+OrdinateArraySequence::toString() const
+{
+	string result("(");
+	Coordinate c;
+	for (size_t i=0, n=xs.size(); i<n; i++)
+	{
+		getAt(i, c);
+		if ( i ) result.append(", ");
+		result.append(c.toString());
+	}
+	result.append(")");
+
+	return result;
+}
+
+void
+OrdinateArraySequence::setPoints(const vector<Coordinate> &v)
+{
+	dropView();
+	size_t n = v.size();
+	xs.resize(n);
+	ys.resize(n);
+	zs.clear();
+	for (size_t i=0; i<n; ++i)
+	{
+		const Coordinate& c = v[i];
+		xs[i] = c.x;
+		ys[i] = c.y;
+		setZ(i, c.getZ());
+	}
+}
+
+std::size_t
+OrdinateArraySequence::getDimension() const
+{
+#ifndef GEOS_COORDINATE_2D
+	if ( ! zs.empty() || dimension == 3 ) return 3;
+#endif
+	return 2;
+}
+
+double
+OrdinateArraySequence::getOrdinate(size_t index, size_t ordinateIndex) const
+{
+	switch (ordinateIndex)
+	{
+		case CoordinateSequence::X:
+			return xs[index];
+		case CoordinateSequence::Y:
+			return ys[index];
+		case CoordinateSequence::Z:
+			return zs.empty() ? DoubleNotANumber : zs[index];
+		default:
+			return DoubleNotANumber;
+	}
+}
+
+void
+OrdinateArraySequence::setOrdinate(size_t index, size_t ordinateIndex,
+	double value)
+{
+	switch (ordinateIndex)
+	{
+		case CoordinateSequence::X:
+			xs[index] = value;
+			break;
+		case CoordinateSequence::Y:
+			ys[index] = value;
+			break;
+		case CoordinateSequence::Z:
+			setZ(index, value);
+			break;
+		default:
+		{
+			std::stringstream ss;
+			ss << "Unknown ordinate index " << ordinateIndex;
+			throw util::IllegalArgumentException(ss.str());
+			break;
+		}
+	}
+	updateView(index);
+}
+
+bool
+OrdinateArraySequence::getOrdinateSpan(OrdinateSpan& span) const
+{
+	span.x = getXArray();
+	span.y = getYArray();
+	span.stride = 1;
+	span.size = xs.size();
+	return true;
+}
+
+void
+OrdinateArraySequence::apply_rw(const CoordinateFilter *filter)
+{
+	Coordinate c;
+	for (size_t i=0, n=xs.size(); i<n; ++i)
+	{
+		getAt(i, c);
+		filter->filter_rw(&c);
+		setAt(c, i);
+	}
+}
+
+void
+OrdinateArraySequence::apply_ro(CoordinateFilter *filter) const
+{
+	// filters may keep the pointers they are given
+	const vector<Coordinate>& coords = coordinates();
+	for (vector<Coordinate>::const_iterator i=coords.begin(), e=coords.end(); i!=e; ++i)
+	{
+		filter->filter_ro(&(*i));
+	}
+}
+
+CoordinateSequence&
+OrdinateArraySequence::removeRepeatedPoints()
+{
+	// 2D equality, like Coordinate::operator==
+	size_t n = xs.size();
+	if ( n < 2 ) return *this;
+
+	dropView();
+	size_t last = 0;
+	for (size_t i=1; i<n; ++i)
+	{
+		if ( xs[i] == xs[last] && ys[i] == ys[last] ) continue;
+		++last;
+		xs[last] = xs[i];
+		ys[last] = ys[i];
+		if ( ! zs.empty() ) zs[last] = zs[i];
+	}
+	xs.resize(last+1);
+	ys.resize(last+1);
+	if ( ! zs.empty() ) zs.resize(last+1);
+
+	return *this;
+}
+
+} // namespace geos::geom
+} // namespace geos
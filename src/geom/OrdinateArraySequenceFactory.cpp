@@ -0,0 +1,55 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/OrdinateArraySequenceFactory.h>
+#include <geos/geom/OrdinateArraySequence.h>
+#include <geos/geom/Coordinate.h>
+
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+static OrdinateArraySequenceFactory ordinateArraySequenceFactory;
+
+CoordinateSequence *
+OrdinateArraySequenceFactory::create(std::vector<Coordinate> *coords) const
+{
+	return create(coords, 0);
+}
+
+CoordinateSequence *
+OrdinateArraySequenceFactory::create(std::vector<Coordinate> *coords,
+		std::size_t dimension) const
+{
+	std::auto_ptr< std::vector<Coordinate> > owned(coords);
+	if ( ! coords ) return new OrdinateArraySequence(0, dimension);
+	return new OrdinateArraySequence(*coords, dimension);
+}
+
+CoordinateSequence *
+OrdinateArraySequenceFactory::create(std::size_t size, std::size_t dimension)
+		const
+{
+	return new OrdinateArraySequence(size, dimension);
+}
+
+const CoordinateSequenceFactory *
+OrdinateArraySequenceFactory::instance()
+{
+	return &ordinateArraySequenceFactory;
+}
+
+} // namespace geos::geom
+} // namespace geos
@@ -20,13 +20,31 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h>
 #include <geos/geom/Coordinate.h> 
+#include <geos/geom/Geometry.h> 
+#include <geos/geom/Envelope.h> 
+#include <geos/geom/GeometryComponentFilter.h> 
 #include <geos/algorithm/PointLocator.h> 
 #include <geos/geom/util/ComponentCoordinateExtracter.h> 
+#include <geos/operation/distance/IndexedFacetDistance.h> 
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+namespace {
+
+/// Computes the envelope cached by each component
+class EnvelopeCacheFilter : public geom::GeometryComponentFilter
+{
+public:
+	void filter_ro(const geom::Geometry* g)
+	{
+		g->getEnvelopeInternal();
+	}
+};
+
+} // anonymous namespace
+
 /*            *
  * protected: *
  *            */
@@ -36,6 +54,11 @@ BasicPreparedGeometry::setGeometry( const geom::Geometry * geom )
 {
 	baseGeom = geom;
 	geom::util::ComponentCoordinateExtracter::getCoordinates(*baseGeom, representativePts);
+
+	// Geometries compute their envelope on first use, do it now so
+	// that concurrent predicates only read the base geometry
+	EnvelopeCacheFilter envelopes;
+	baseGeom->apply_ro(&envelopes);
 }
 
 bool 
@@ -50,16 +73,59 @@ BasicPreparedGeometry::envelopeCovers( const geom::Geometry* g) const
 	return baseGeom->getEnvelopeInternal()->covers(g->getEnvelopeInternal());
 }
 
+const operation::distance::IndexedFacetDistance *
+BasicPreparedGeometry::getFacetDistance() const
+{
+	operation::distance::IndexedFacetDistance * dist = facetDistance.load();
+	if (! dist)
+	{
+		geos::util::Mutex::Lock lock( buildMutex);
+		dist = facetDistance.load();
+		if (! dist)
+		{
+			dist = new operation::distance::IndexedFacetDistance( baseGeom );
+			facetDistance.store( dist);
+		}
+	}
+	return dist;
+}
+
+bool 
+BasicPreparedGeometry::isAnyTestComponentInTarget( const geom::Geometry * testGeom) const
+{
+	if ( baseGeom->getDimension() < 2 )
+		return false;
+
+	geom::Coordinate::ConstVect pts;
+	geom::util::ComponentCoordinateExtracter::getCoordinates(*testGeom, pts);
+
+	algorithm::PointLocator locator;
+	for (size_t i=0, n=pts.size(); i<n; i++)
+	{
+		if ( locator.intersects( *(pts[i]), baseGeom) )
+			return true;
+	}
+	return false;
+}
+
 /*
  * public:
  */
 BasicPreparedGeometry::BasicPreparedGeometry( const Geometry * geom)
+	: facetDistance(0)
 {
 	setGeometry( geom);
 }
 
 BasicPreparedGeometry::~BasicPreparedGeometry( )
 {
+	delete facetDistance.load();
+}
+
+void
+BasicPreparedGeometry::prepareAll() const
+{
+	getFacetDistance();
 }
 
 
@@ -146,6 +212,47 @@ BasicPreparedGeometry::within(const geom::Geometry * g) const
 	return baseGeom->within(g);
 }
 
+/*private*/
+bool 
+BasicPreparedGeometry::isAnyComponentInArea(const geom::Geometry * g) const
+{
+	if ( g->getDimension() == 2 && isAnyTargetComponentInTest( g) )
+		return true;
+	return isAnyTestComponentInTarget( g);
+}
+
+double 
+BasicPreparedGeometry::distance(const geom::Geometry * g) const
+{
+	if ( baseGeom->isEmpty() || g->isEmpty() )
+		return 0.0;
+
+	double dist = getFacetDistance()->getDistance( g);
+
+	// the facets may be apart while one geometry is inside the
+	// other, only check for that when it matters
+	if ( dist > 0.0 && isAnyComponentInArea( g) )
+		return 0.0;
+
+	return dist;
+}
+
+bool 
+BasicPreparedGeometry::isWithinDistance(const geom::Geometry * g, double dist) const
+{
+	if ( baseGeom->isEmpty() || g->isEmpty() )
+		return 0.0 <= dist;
+
+	// short-circuit test
+	if ( baseGeom->getEnvelopeInternal()->distance( g->getEnvelopeInternal()) > dist )
+		return false;
+
+	if ( getFacetDistance()->isWithinDistance( g, dist) )
+		return true;
+
+	return dist >= 0.0 && isAnyComponentInArea( g);
+}
+
 std::string 
 BasicPreparedGeometry::toString()
 {
@@ -19,11 +19,24 @@
 
 
 #include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/Geometry.h>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+double
+PreparedGeometry::distance(const geom::Geometry *g) const
+{
+	return getGeometry().distance(g);
+}
+
+bool
+PreparedGeometry::isWithinDistance(const geom::Geometry *g, double dist) const
+{
+	return getGeometry().isWithinDistance(g, dist);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
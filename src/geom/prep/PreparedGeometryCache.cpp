@@ -0,0 +1,269 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/prep/PreparedGeometryCache.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+
+#include <cstring> // for memcpy
+#include <memory>
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+namespace {
+
+inline void
+mix(std::size_t& h, std::size_t v)
+{
+	h ^= v + 0x9E3779B9u + (h << 6) + (h >> 2);
+}
+
+inline void
+mix(std::size_t& h, double d)
+{
+	unsigned int w[sizeof(double) / sizeof(unsigned int)];
+	std::memcpy(w, &d, sizeof(double));
+	for (std::size_t i = 0; i < sizeof(w) / sizeof(w[0]); ++i)
+		mix(h, static_cast<std::size_t>(w[i]));
+}
+
+/// Hashes the coordinates of a sequence
+class HashCoordinateFilter: public CoordinateFilter
+{
+public:
+	HashCoordinateFilter(std::size_t& hash): h(hash) {}
+
+	void filter_ro(const Coordinate* c)
+	{
+		mix(h, c->x);
+		mix(h, c->y);
+	}
+
+private:
+	std::size_t& h;
+
+	// Declare type as noncopyable
+	HashCoordinateFilter(const HashCoordinateFilter& other);
+	HashCoordinateFilter& operator=(const HashCoordinateFilter& rhs);
+};
+
+/// Hashes the type, size and coordinates of every component
+class HashComponentFilter: public GeometryComponentFilter
+{
+public:
+	HashComponentFilter(std::size_t& hash): h(hash) {}
+
+	void filter_ro(const Geometry* g)
+	{
+		mix(h, static_cast<std::size_t>(g->getGeometryTypeId()));
+		if ( const LineString* ls = dynamic_cast<const LineString*>(g) )
+		{
+			const CoordinateSequence* seq = ls->getCoordinatesRO();
+			mix(h, seq->getSize());
+			HashCoordinateFilter f(h);
+			seq->apply_ro(&f);
+		}
+		else if ( const Point* p = dynamic_cast<const Point*>(g) )
+		{
+			if ( ! p->isEmpty() )
+			{
+				mix(h, p->getX());
+				mix(h, p->getY());
+			}
+		}
+		else
+		{
+			mix(h, g->getNumGeometries());
+		}
+	}
+
+private:
+	std::size_t& h;
+
+	// Declare type as noncopyable
+	HashComponentFilter(const HashComponentFilter& other);
+	HashComponentFilter& operator=(const HashComponentFilter& rhs);
+};
+
+} // anonymous namespace
+
+/*public*/
+PreparedGeometryCache::PreparedGeometryCache(std::size_t nEntries,
+		std::size_t nPoints)
+	:
+	maxEntries(nEntries),
+	maxPoints(nPoints),
+	numPoints(0),
+	hits(0),
+	misses(0)
+{
+}
+
+/*public*/
+PreparedGeometryCache::~PreparedGeometryCache()
+{
+	clear();
+}
+
+/*private static*/
+std::size_t
+PreparedGeometryCache::fingerprint(const Geometry& g)
+{
+	std::size_t h = 0;
+	HashComponentFilter f(h);
+	g.apply_ro(&f);
+	return h;
+}
+
+/*private*/
+void
+PreparedGeometryCache::erase(EntryIndex::iterator it)
+{
+	EntryList::iterator e = it->second;
+	numPoints -= e->numPoints;
+	PreparedGeometryFactory::destroy(e->prepared);
+	delete e->copy;
+	entries.erase(e);
+	index.erase(it);
+}
+
+/*private*/
+void
+PreparedGeometryCache::makeRoom(std::size_t points)
+{
+	// the front entry is the one being prepared, keep it
+	while ( maxPoints && numPoints + points > maxPoints
+	        && entries.size() > 1 )
+	{
+		erase(index.find(entries.back().geom));
+	}
+}
+
+/*public*/
+const PreparedGeometry*
+PreparedGeometryCache::get(const Geometry& g)
+{
+	const std::size_t fp = fingerprint(g);
+
+	EntryIndex::iterator it = index.find(&g);
+	if ( it != index.end() )
+	{
+		EntryList::iterator e = it->second;
+		if ( e->fingerprint == fp )
+		{
+			entries.splice(entries.begin(), entries, e);
+			if ( e->prepared )
+			{
+				++hits;
+				return e->prepared;
+			}
+
+			// seen before: worth preparing now
+			++misses;
+			std::size_t n = g.getNumPoints();
+			if ( maxPoints && n > maxPoints ) return 0;
+			makeRoom(n);
+			// prepared from a copy, so that the entry never
+			// references a geometry freed or changed by the caller
+			std::auto_ptr<Geometry> copy(g.clone());
+			e->prepared = PreparedGeometryFactory::prepare(copy.get());
+			e->copy = copy.release();
+			e->numPoints = n;
+			numPoints += n;
+			return e->prepared;
+		}
+
+		// another geometry now lives at that address
+		erase(it);
+	}
+
+	++misses;
+	if ( ! maxEntries ) return 0;
+	while ( index.size() >= maxEntries )
+		erase(index.find(entries.back().geom));
+
+	Entry entry;
+	entry.geom = &g;
+	entry.fingerprint = fp;
+	entry.prepared = 0;
+	entry.copy = 0;
+	entry.numPoints = 0;
+	entries.push_front(entry);
+	index[&g] = entries.begin();
+	return 0;
+}
+
+/*public*/
+void
+PreparedGeometryCache::invalidate(const Geometry* g)
+{
+	if ( index.empty() ) return;
+
+	EntryIndex::iterator it = index.find(g);
+	if ( it != index.end() ) erase(it);
+
+	// components share the lifetime of their parent
+	if ( dynamic_cast<const GeometryCollection*>(g) )
+	{
+		for (std::size_t i = 0, n = g->getNumGeometries(); i < n; ++i)
+			invalidate(g->getGeometryN(i));
+	}
+	else if ( const Polygon* p = dynamic_cast<const Polygon*>(g) )
+	{
+		invalidate(p->getExteriorRing());
+		for (std::size_t i = 0; i < p->getNumInteriorRing(); ++i)
+			invalidate(p->getInteriorRingN(i));
+	}
+}
+
+/*public*/
+void
+PreparedGeometryCache::clear()
+{
+	for (EntryList::iterator it = entries.begin(); it != entries.end(); ++it)
+	{
+		PreparedGeometryFactory::destroy(it->prepared);
+		delete it->copy;
+	}
+	entries.clear();
+	index.clear();
+	numPoints = 0;
+}
+
+/*public*/
+void
+PreparedGeometryCache::setLimits(std::size_t nEntries, std::size_t nPoints)
+{
+	maxEntries = nEntries;
+	maxPoints = nPoints;
+	while ( ! entries.empty() && ( index.size() > maxEntries ||
+	        ( maxPoints && numPoints > maxPoints ) ) )
+	{
+		erase(index.find(entries.back().geom));
+	}
+}
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
@@ -64,7 +64,7 @@ PreparedGeometryFactory::create( const geom::Geometry * g) const
 
 		case GEOS_POLYGON:
 		case GEOS_MULTIPOLYGON:
-			pg = new PreparedPolygon( g);
+			pg = new PreparedPolygon( g, gridPointLocator, gridCells);
 			break;
 
 		default:
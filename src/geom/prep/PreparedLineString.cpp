@@ -19,7 +19,11 @@
 
 
 #include <geos/geom/prep/PreparedLineString.h>
+#include <geos/geom/prep/PreparedLineStringCovers.h>
+#include <geos/geom/prep/PreparedLineStringCrosses.h>
 #include <geos/geom/prep/PreparedLineStringIntersects.h>
+#include <geos/geom/prep/PreparedLineStringTouches.h>
+#include <geos/algorithm/locate/IndexedPointOnLineLocator.h>
 #include <geos/noding/SegmentStringUtil.h>
 #include <geos/noding/FastSegmentSetIntersectionFinder.h>
 
@@ -33,7 +37,8 @@ namespace prep { // geos.geom.prep
 
 PreparedLineString::~PreparedLineString()
 {
-	delete segIntFinder;
+	delete segIntFinder.load();
+	delete ptOnGeomLoc.load();
 	for ( noding::SegmentString::ConstVect::size_type i = 0,
 	     ni = segStrings.size(); i < ni; ++i )
 	{
@@ -43,15 +48,88 @@ PreparedLineString::~PreparedLineString()
 }
 
 noding::FastSegmentSetIntersectionFinder * 
-PreparedLineString::getIntersectionFinder()
+PreparedLineString::getIntersectionFinder() const
 {
-	if (! segIntFinder)
+	noding::FastSegmentSetIntersectionFinder * finder = segIntFinder.load();
+	if (! finder)
 	{
-		noding::SegmentStringUtil::extractSegmentStrings( &getGeometry(), segStrings );
-		segIntFinder = new noding::FastSegmentSetIntersectionFinder( &segStrings );
+		geos::util::Mutex::Lock lock( buildMutex);
+		finder = segIntFinder.load();
+		if (! finder)
+		{
+			noding::SegmentStringUtil::extractSegmentStrings( &getGeometry(), segStrings );
+			finder = new noding::FastSegmentSetIntersectionFinder( &segStrings );
+			segIntFinder.store( finder);
+		}
 	}
 
-	return segIntFinder;
+	return finder;
+}
+
+algorithm::locate::IndexedPointOnLineLocator * 
+PreparedLineString::getPointLocator() const
+{
+	algorithm::locate::IndexedPointOnLineLocator * loc = ptOnGeomLoc.load();
+	if (! loc)
+	{
+		geos::util::Mutex::Lock lock( buildMutex);
+		loc = ptOnGeomLoc.load();
+		if (! loc)
+		{
+			loc = new algorithm::locate::IndexedPointOnLineLocator( getGeometry() );
+			ptOnGeomLoc.store( loc);
+		}
+	}
+
+	return loc;
+}
+
+void
+PreparedLineString::prepareAll() const
+{
+	BasicPreparedGeometry::prepareAll();
+	getIntersectionFinder();
+	getPointLocator();
+}
+
+bool 
+PreparedLineString::covers(const geom::Geometry * g) const
+{
+	if (! envelopeCovers(g))
+		return false;
+
+	// areas and collections are left to relate
+	if ( getGeometry().isEmpty() ||
+	     ! PreparedLineStringPredicate::isSupportedTestGeometry(g) )
+		return BasicPreparedGeometry::covers(g);
+
+	return PreparedLineStringCovers::covers(this, g);
+}
+
+bool 
+PreparedLineString::crosses(const geom::Geometry * g) const
+{
+	if (! envelopesIntersect(g))
+		return false;
+
+	if ( getGeometry().isEmpty() ||
+	     ! PreparedLineStringPredicate::isSupportedTestGeometry(g) )
+		return BasicPreparedGeometry::crosses(g);
+
+	return PreparedLineStringCrosses::crosses(this, g);
+}
+
+bool 
+PreparedLineString::touches(const geom::Geometry * g) const
+{
+	if (! envelopesIntersect(g))
+		return false;
+
+	if ( getGeometry().isEmpty() ||
+	     ! PreparedLineStringPredicate::isSupportedTestGeometry(g) )
+		return BasicPreparedGeometry::touches(g);
+
+	return PreparedLineStringTouches::touches(this, g);
 }
 
 bool 
@@ -0,0 +1,171 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/prep/PreparedLineStringCovers.h>
+#include <geos/geom/prep/PreparedLineString.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Location.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/locate/IndexedPointOnLineLocator.h>
+#include <geos/noding/SegmentIntersector.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/noding/SegmentStringUtil.h>
+#include <geos/noding/FastSegmentSetIntersectionFinder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos.geom
+namespace prep { // geos.geom.prep
+
+namespace {
+
+typedef std::pair<double, double> Interval;
+
+/**
+ * Collects, for each test segment, the parts of it overlapped
+ * collinearly by target segments, as intervals of a parameter
+ * going from 0 at its start to 1 at its end.
+ */
+class SegmentCoverageCollector : public noding::SegmentIntersector
+{
+public:
+	typedef std::map<const noding::SegmentString*, std::size_t> Offsets;
+
+	SegmentCoverageCollector( const Offsets & offsets,
+	                          std::vector< std::vector<Interval> > & intervals)
+		: offsets( offsets), intervals( intervals)
+	{ }
+
+	void processIntersections(
+		noding::SegmentString* e0, int segIndex0,
+		noding::SegmentString* e1, int segIndex1)
+	{
+		// the test segment string comes first
+		Offsets::const_iterator it = offsets.find( e0);
+		if ( it == offsets.end() ) return;
+
+		const geom::CoordinateSequence * pts0 = e0->getCoordinates();
+		const geom::CoordinateSequence * pts1 = e1->getCoordinates();
+		const geom::Coordinate & a = pts0->getAt( segIndex0);
+		const geom::Coordinate & b = pts0->getAt( segIndex0 + 1);
+		li.computeIntersection( a, b,
+		                        pts1->getAt( segIndex1), pts1->getAt( segIndex1 + 1));
+		if ( li.getIntersectionNum() != 2 ) return;
+
+		double t0 = parameter( a, b, li.getIntersection( 0));
+		double t1 = parameter( a, b, li.getIntersection( 1));
+		if ( t1 < t0 ) std::swap( t0, t1);
+		intervals[ it->second + segIndex0 ].push_back( Interval( t0, t1));
+	}
+
+	/// Position of p, on segment (a, b), along its main axis
+	static double parameter( const geom::Coordinate & a,
+	                         const geom::Coordinate & b,
+	                         const geom::Coordinate & p)
+	{
+		double dx = b.x - a.x;
+		double dy = b.y - a.y;
+		if ( std::fabs( dx) >= std::fabs( dy) )
+			return ( p.x - a.x) / dx;
+		return ( p.y - a.y) / dy;
+	}
+
+private:
+	algorithm::LineIntersector li;
+	const Offsets & offsets;
+	std::vector< std::vector<Interval> > & intervals;
+};
+
+/// Tests whether the intervals cover [0, 1]
+bool
+isCovered( std::vector<Interval> & intervals)
+{
+	std::sort( intervals.begin(), intervals.end());
+	double covered = 0.0;
+	for ( std::size_t i = 0, ni = intervals.size(); i < ni; i++ )
+	{
+		if ( intervals[ i ].first > covered ) return false;
+		if ( intervals[ i ].second > covered ) covered = intervals[ i ].second;
+	}
+	return covered >= 1.0;
+}
+
+} // anonymous namespace
+
+bool
+PreparedLineStringCovers::covers( const geom::Geometry * geom) const
+{
+	if ( isPuntal( geom) )
+		return ! locateTestPoints( geom).anyExterior;
+
+	noding::SegmentString::ConstVect lineSegStr;
+	noding::SegmentStringUtil::extractSegmentStrings( geom, lineSegStr);
+
+	SegmentCoverageCollector::Offsets offsets;
+	std::size_t numSegments = 0;
+	for ( std::size_t i = 0, ni = lineSegStr.size(); i < ni; i++ )
+	{
+		offsets[ lineSegStr[ i ] ] = numSegments;
+		if ( lineSegStr[ i ]->size() > 1 )
+			numSegments += lineSegStr[ i ]->size() - 1;
+	}
+
+	std::vector< std::vector<Interval> > intervals( numSegments);
+	SegmentCoverageCollector collector( offsets, intervals);
+	prepLine->getIntersectionFinder()->process( &lineSegStr, collector);
+
+	algorithm::locate::PointOnGeometryLocator * locator = prepLine->getPointLocator();
+	bool result = true;
+	for ( std::size_t i = 0, ni = lineSegStr.size(); i < ni && result; i++ )
+	{
+		const geom::CoordinateSequence * pts = lineSegStr[ i ]->getCoordinates();
+		std::size_t offset = offsets[ lineSegStr[ i ] ];
+		for ( std::size_t j = 0, nj = pts->size(); j + 1 < nj; j++ )
+		{
+			// a zero-length segment is a point
+			if ( pts->getAt( j).equals2D( pts->getAt( j + 1)) )
+			{
+				if ( locator->locate( &pts->getAt( j)) == geom::Location::EXTERIOR )
+				{
+					result = false;
+					break;
+				}
+				continue;
+			}
+			if ( ! isCovered( intervals[ offset + j ]) )
+			{
+				result = false;
+				break;
+			}
+		}
+	}
+
+	for ( std::size_t i = 0, ni = lineSegStr.size(); i < ni; i++ )
+	{
+		delete lineSegStr[ i ]->getCoordinates();
+		delete lineSegStr[ i ];
+	}
+	return result;
+}
+
+} // namespace geos.geom.prep
+} // namespace geos.geom
+} // namespace geos
@@ -0,0 +1,39 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/prep/PreparedLineStringCrosses.h>
+#include <geos/geom/Geometry.h>
+
+namespace geos {
+namespace geom { // geos.geom
+namespace prep { // geos.geom.prep
+
+bool
+PreparedLineStringCrosses::crosses( const geom::Geometry * geom) const
+{
+	// L/P: T*****T**
+	if ( isPuntal( geom) )
+	{
+		PointLocations locs = locateTestPoints( geom);
+		return locs.anyInterior && locs.anyExterior;
+	}
+
+	// L/L: 0********
+	LineIntersections ints = findLineIntersections( geom, false);
+	return ints.interiorsIntersect && ! ints.interiorsOverlap;
+}
+
+} // namespace geos.geom.prep
+} // namespace geos.geom
+} // namespace geos
@@ -17,11 +17,12 @@
  **********************************************************************/
 
 
-#include <geos/algorithm/PointLocator.h> 
+#include <geos/algorithm/locate/IndexedPointOnLineLocator.h> 
 #include <geos/geom/prep/PreparedLineString.h>
 #include <geos/geom/prep/PreparedLineStringIntersects.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h> 
 #include <geos/geom/Coordinate.h> 
+#include <geos/geom/Location.h> 
 #include <geos/noding/SegmentStringUtil.h>
 #include <geos/noding/FastSegmentSetIntersectionFinder.h>
 
@@ -34,19 +35,14 @@ namespace prep { // geos.geom.prep
 
 	bool PreparedLineStringIntersects::isAnyTestPointInTarget(const geom::Geometry * testGeom) const
 	{
-		/**
-		 * This could be optimized by using the segment index on the lineal target.
-		 * However, it seems like the L/P case would be pretty rare in practice.
-		 */
-		PointLocator  locator;
+		locate::PointOnGeometryLocator * locator = prepLine.getPointLocator();
 
 		geom::Coordinate::ConstVect coords;
 		ComponentCoordinateExtracter::getCoordinates( *testGeom, coords);
 
 		for (size_t i=0, n=coords.size(); i<n; i++)
 		{
-			geom::Coordinate c = *(coords[i]);
-			if ( locator.intersects( c, &(prepLine.getGeometry()) ))
+			if ( locator->locate( coords[i]) != geom::Location::EXTERIOR )
 				return true;
 		}
 		return false;
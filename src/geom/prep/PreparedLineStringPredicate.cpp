@@ -0,0 +1,192 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/prep/PreparedLineStringPredicate.h>
+#include <geos/geom/prep/PreparedLineString.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/locate/IndexedPointOnLineLocator.h>
+#include <geos/noding/SegmentIntersector.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/noding/SegmentStringUtil.h>
+#include <geos/noding/FastSegmentSetIntersectionFinder.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos.geom
+namespace prep { // geos.geom.prep
+
+namespace {
+
+/**
+ * Classifies the intersections of pairs of test and target segments.
+ *
+ * An intersection point which is not proper is a vertex of one of
+ * the segments, and lies in the interiors of both geometries unless
+ * it is in the boundary of either.
+ */
+class LineIntersectionClassifier : public noding::SegmentIntersector
+{
+public:
+	LineIntersectionClassifier(
+			algorithm::locate::IndexedPointOnLineLocator & targetLocator,
+			const std::vector<geom::Coordinate> & testBoundary,
+			bool stopAtInteriorIntersection)
+		: targetLocator( targetLocator),
+		  testBoundary( testBoundary),
+		  stopAtInteriorIntersection( stopAtInteriorIntersection),
+		  intersects( false),
+		  interiorsIntersect( false),
+		  interiorsOverlap( false)
+	{ }
+
+	void processIntersections(
+		noding::SegmentString* e0, int segIndex0,
+		noding::SegmentString* e1, int segIndex1)
+	{
+		const geom::CoordinateSequence * pts0 = e0->getCoordinates();
+		const geom::CoordinateSequence * pts1 = e1->getCoordinates();
+		li.computeIntersection( pts0->getAt( segIndex0), pts0->getAt( segIndex0 + 1),
+		                        pts1->getAt( segIndex1), pts1->getAt( segIndex1 + 1));
+		if ( ! li.hasIntersection() ) return;
+
+		intersects = true;
+		if ( li.getIntersectionNum() == 2 )
+		{
+			interiorsOverlap = true;
+			interiorsIntersect = true;
+		}
+		else if ( li.isProper() )
+		{
+			interiorsIntersect = true;
+		}
+		else
+		{
+			const geom::Coordinate & p = li.getIntersection( 0);
+			if ( ! targetLocator.isBoundary( p) &&
+			     ! std::binary_search( testBoundary.begin(), testBoundary.end(),
+			                           p, geom::CoordinateLessThen()) )
+				interiorsIntersect = true;
+		}
+	}
+
+	bool isDone() const
+	{
+		return interiorsOverlap ||
+			( stopAtInteriorIntersection && interiorsIntersect );
+	}
+
+private:
+	algorithm::LineIntersector li;
+	algorithm::locate::IndexedPointOnLineLocator & targetLocator;
+	const std::vector<geom::Coordinate> & testBoundary;
+	bool stopAtInteriorIntersection;
+
+public:
+	bool intersects;
+	bool interiorsIntersect;
+	bool interiorsOverlap;
+};
+
+} // anonymous namespace
+
+//
+// protected:
+//
+PreparedLineStringPredicate::PointLocations
+PreparedLineStringPredicate::locateTestPoints( const geom::Geometry * testGeom) const
+{
+	PointLocations locs = { false, false, false };
+
+	geom::Coordinate::ConstVect pts;
+	geom::util::ComponentCoordinateExtracter::getCoordinates( *testGeom, pts);
+
+	algorithm::locate::PointOnGeometryLocator * locator = prepLine->getPointLocator();
+	for ( std::size_t i = 0, ni = pts.size(); i < ni; i++ )
+	{
+		switch ( locator->locate( pts[ i ]) )
+		{
+		case geom::Location::INTERIOR: locs.anyInterior = true; break;
+		case geom::Location::BOUNDARY: locs.anyBoundary = true; break;
+		default: locs.anyExterior = true; break;
+		}
+	}
+	return locs;
+}
+
+PreparedLineStringPredicate::LineIntersections
+PreparedLineStringPredicate::findLineIntersections( const geom::Geometry * testGeom,
+                                                    bool stopAtInteriorIntersection) const
+{
+	std::vector<geom::Coordinate> testBoundary;
+	algorithm::locate::IndexedPointOnLineLocator::computeBoundary( *testGeom, testBoundary);
+
+	LineIntersectionClassifier classifier( *prepLine->getPointLocator(),
+	                                       testBoundary,
+	                                       stopAtInteriorIntersection);
+
+	noding::SegmentString::ConstVect lineSegStr;
+	noding::SegmentStringUtil::extractSegmentStrings( testGeom, lineSegStr);
+	prepLine->getIntersectionFinder()->process( &lineSegStr, classifier);
+
+	for ( std::size_t i = 0, ni = lineSegStr.size(); i < ni; i++ )
+	{
+		delete lineSegStr[ i ]->getCoordinates();
+		delete lineSegStr[ i ];
+	}
+
+	LineIntersections result;
+	result.intersects = classifier.intersects;
+	result.interiorsIntersect = classifier.interiorsIntersect;
+	result.interiorsOverlap = classifier.interiorsOverlap;
+	return result;
+}
+
+//
+// public:
+//
+bool
+PreparedLineStringPredicate::isSupportedTestGeometry( const geom::Geometry * testGeom)
+{
+	if ( testGeom->isEmpty() ) return false;
+
+	switch ( testGeom->getGeometryTypeId() )
+	{
+	case geom::GEOS_POINT:
+	case geom::GEOS_MULTIPOINT:
+	case geom::GEOS_LINESTRING:
+	case geom::GEOS_LINEARRING:
+	case geom::GEOS_MULTILINESTRING:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool
+PreparedLineStringPredicate::isPuntal( const geom::Geometry * testGeom)
+{
+	return testGeom->getGeometryTypeId() == geom::GEOS_POINT ||
+		testGeom->getGeometryTypeId() == geom::GEOS_MULTIPOINT;
+}
+
+} // namespace geos.geom.prep
+} // namespace geos.geom
+} // namespace geos
@@ -0,0 +1,39 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/prep/PreparedLineStringTouches.h>
+#include <geos/geom/Geometry.h>
+
+namespace geos {
+namespace geom { // geos.geom
+namespace prep { // geos.geom.prep
+
+bool
+PreparedLineStringTouches::touches( const geom::Geometry * geom) const
+{
+	// points have no boundary: none may be in the interior of
+	// the target, some must be on its boundary
+	if ( isPuntal( geom) )
+	{
+		PointLocations locs = locateTestPoints( geom);
+		return ! locs.anyInterior && locs.anyBoundary;
+	}
+
+	LineIntersections ints = findLineIntersections( geom, true);
+	return ints.intersects && ! ints.interiorsIntersect;
+}
+
+} // namespace geos.geom.prep
+} // namespace geos.geom
+} // namespace geos
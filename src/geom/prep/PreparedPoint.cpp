@@ -19,13 +19,119 @@
 
 
 #include <geos/geom/prep/PreparedPoint.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
+#include <geos/algorithm/PointLocator.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
+
+#include <algorithm>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+/*private*/
+const std::vector<geom::Coordinate> * 
+PreparedPoint::getSortedPoints() const
+{
+	std::vector<geom::Coordinate> * pts = sortedPts.load();
+	if (! pts)
+	{
+		geos::util::Mutex::Lock lock( buildMutex);
+		pts = sortedPts.load();
+		if (! pts)
+		{
+			const Coordinate::ConstVect * reps = getRepresentativePoints();
+			pts = new std::vector<geom::Coordinate>();
+			pts->reserve( reps->size());
+			for (std::size_t i=0, n=reps->size(); i<n; i++)
+				pts->push_back( *(*reps)[i]);
+			std::sort( pts->begin(), pts->end(), geom::CoordinateLessThen());
+			sortedPts.store( pts);
+		}
+	}
+	return pts;
+}
+
+/*private static*/
+bool 
+PreparedPoint::isLinealOrAreal(const geom::Geometry* g)
+{
+	if ( g->isEmpty() ) return false;
+
+	switch ( g->getGeometryTypeId() )
+	{
+	case geom::GEOS_LINESTRING:
+	case geom::GEOS_LINEARRING:
+	case geom::GEOS_MULTILINESTRING:
+	case geom::GEOS_POLYGON:
+	case geom::GEOS_MULTIPOLYGON:
+		return true;
+	default:
+		return false;
+	}
+}
+
+PreparedPoint::~PreparedPoint()
+{
+	delete sortedPts.load();
+}
+
+void 
+PreparedPoint::prepareAll() const
+{
+	BasicPreparedGeometry::prepareAll();
+	getSortedPoints();
+}
+
+bool 
+PreparedPoint::covers(const geom::Geometry* g) const
+{
+	if (! envelopeCovers( g)) return false;
+
+	if ( g->isEmpty() || getGeometry().isEmpty() ||
+	     ( g->getGeometryTypeId() != geom::GEOS_POINT &&
+	       g->getGeometryTypeId() != geom::GEOS_MULTIPOINT ) )
+		return BasicPreparedGeometry::covers( g);
+
+	const std::vector<geom::Coordinate> * pts = getSortedPoints();
+
+	geom::Coordinate::ConstVect testPts;
+	geom::util::ComponentCoordinateExtracter::getCoordinates( *g, testPts);
+	for (std::size_t i=0, n=testPts.size(); i<n; i++)
+	{
+		if (! std::binary_search( pts->begin(), pts->end(), *testPts[i],
+		                          geom::CoordinateLessThen()))
+			return false;
+	}
+	return true;
+}
+
+bool 
+PreparedPoint::crosses(const geom::Geometry* g) const
+{
+	if (! envelopesIntersect( g)) return false;
+
+	if ( getGeometry().isEmpty() || ! isLinealOrAreal( g) )
+		return BasicPreparedGeometry::crosses( g);
+
+	// P/L and P/A: T*T******
+	algorithm::PointLocator locator;
+	const Coordinate::ConstVect * pts = getRepresentativePoints();
+	bool anyInterior = false;
+	bool anyExterior = false;
+	for (std::size_t i=0, n=pts->size(); i<n; i++)
+	{
+		int loc = locator.locate( *(*pts)[i], g);
+		if ( loc == geom::Location::INTERIOR ) anyInterior = true;
+		else if ( loc == geom::Location::EXTERIOR ) anyExterior = true;
+		if ( anyInterior && anyExterior ) return true;
+	}
+	return false;
+}
+
 bool 
-PreparedPoint::intersects(const geom::Geometry* g)
+PreparedPoint::intersects(const geom::Geometry* g) const
 {
 	if (! envelopesIntersect( g)) return false;
 
@@ -33,6 +139,28 @@ PreparedPoint::intersects(const geom::Geometry* g)
 	return isAnyTargetComponentInTest( g);
 }
 
+bool 
+PreparedPoint::touches(const geom::Geometry* g) const
+{
+	if (! envelopesIntersect( g)) return false;
+
+	if ( getGeometry().isEmpty() || ! isLinealOrAreal( g) )
+		return BasicPreparedGeometry::touches( g);
+
+	// points have no boundary: none may be in the interior of
+	// the test geometry, some must be on its boundary
+	algorithm::PointLocator locator;
+	const Coordinate::ConstVect * pts = getRepresentativePoints();
+	bool anyBoundary = false;
+	for (std::size_t i=0, n=pts->size(); i<n; i++)
+	{
+		int loc = locator.locate( *(*pts)[i], g);
+		if ( loc == geom::Location::INTERIOR ) return false;
+		if ( loc == geom::Location::BOUNDARY ) anyBoundary = true;
+	}
+	return anyBoundary;
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
@@ -30,25 +30,49 @@
 #include <geos/operation/predicate/RectangleIntersects.h>
 #include <geos/algorithm/locate/PointOnGeometryLocator.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
 // std
 #include <cstddef>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
+//
+// protected:
+//
+bool
+PreparedPolygon::
+isAnyTestComponentInTarget( const geom::Geometry* testGeom) const
+{
+	geom::Coordinate::ConstVect pts;
+	geom::util::ComponentCoordinateExtracter::getCoordinates(*testGeom, pts);
+
+	algorithm::locate::PointOnGeometryLocator * loc = getPointLocator();
+	for (std::size_t i = 0, ni = pts.size(); i < ni; i++)
+	{
+		if ( geom::Location::EXTERIOR != loc->locate( pts[i]) )
+			return true;
+	}
+	return false;
+}
+
 //
 // public:
 //
-PreparedPolygon::PreparedPolygon(const geom::Geometry * geom) 
-    : BasicPreparedGeometry(geom), segIntFinder(0), ptOnGeomLoc(0)
+PreparedPolygon::PreparedPolygon(const geom::Geometry * geom,
+                                 bool gridPointLocator, std::size_t gridCells)
+    : BasicPreparedGeometry(geom), gridPointLocator(gridPointLocator),
+      gridCells(gridCells), segIntFinder(0), ptOnGeomLoc(0)
 {
 	isRectangle = getGeometry().isRectangle();
 }
 
 PreparedPolygon::~PreparedPolygon()
 {
-	delete segIntFinder;
-	delete ptOnGeomLoc;
+	delete segIntFinder.load();
+	delete ptOnGeomLoc.load();
 
 	for ( std::size_t i = 0, ni = segStrings.size(); i < ni; i++ )
 	{
@@ -62,22 +86,70 @@ noding::FastSegmentSetIntersectionFinder *
 PreparedPolygon::
 getIntersectionFinder() const
 {
-	if (! segIntFinder)
+	noding::FastSegmentSetIntersectionFinder * finder = segIntFinder.load();
+	if (! finder)
 	{
-		noding::SegmentStringUtil::extractSegmentStrings( &getGeometry(), segStrings );
-		segIntFinder = new noding::FastSegmentSetIntersectionFinder( &segStrings );
+		geos::util::Mutex::Lock lock( buildMutex);
+		finder = segIntFinder.load();
+		if (! finder)
+		{
+			noding::SegmentStringUtil::extractSegmentStrings( &getGeometry(), segStrings );
+			finder = new noding::FastSegmentSetIntersectionFinder( &segStrings );
+			segIntFinder.store( finder);
+		}
 	}
-	return segIntFinder;
+	return finder;
 }
 
 algorithm::locate::PointOnGeometryLocator * 
 PreparedPolygon::
 getPointLocator() const
 {
-	if (! ptOnGeomLoc) 
-		ptOnGeomLoc = new algorithm::locate::IndexedPointInAreaLocator( getGeometry() );
+	algorithm::locate::PointOnGeometryLocator * loc = ptOnGeomLoc.load();
+	if (! loc) 
+	{
+		geos::util::Mutex::Lock lock( buildMutex);
+		loc = ptOnGeomLoc.load();
+		if (! loc)
+		{
+			if ( gridPointLocator )
+				loc = new algorithm::locate::GridPointInAreaLocator( getGeometry(), gridCells );
+			else
+				loc = new algorithm::locate::IndexedPointInAreaLocator( getGeometry() );
+			ptOnGeomLoc.store( loc);
+		}
+	}
+
+	return loc;
+}
+
+void
+PreparedPolygon::
+prepareAll() const
+{
+	BasicPreparedGeometry::prepareAll();
+	getIntersectionFinder();
+	getPointLocator();
+}
+
+void
+PreparedPolygon::
+locate( const double* x, const double* y, std::size_t n,
+        int* locations, unsigned int numThreads) const
+{
+	if ( gridPointLocator )
+	{
+		algorithm::locate::GridPointInAreaLocator* loc =
+			static_cast<algorithm::locate::GridPointInAreaLocator*>(
+				getPointLocator() );
+		loc->locate( x, y, n, locations, numThreads);
+		return;
+	}
 
-	return ptOnGeomLoc;
+	algorithm::locate::IndexedPointInAreaLocator* loc =
+		static_cast<algorithm::locate::IndexedPointInAreaLocator*>(
+			getPointLocator() );
+	loc->locate( x, y, n, locations, numThreads);
 }
 
 bool 
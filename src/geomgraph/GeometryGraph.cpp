@@ -30,6 +30,8 @@
 #include <geos/geomgraph/Position.h>
 
 #include <geos/geomgraph/index/SimpleMCSweepLineIntersector.h> 
+#include <geos/geomgraph/index/STRtreeEdgeSetIntersector.h> 
+#include <geos/geomgraph/index/MonotoneChainEdge.h> 
 #include <geos/geomgraph/index/SegmentIntersector.h> 
 #include <geos/geomgraph/index/EdgeSetIntersector.h>
 
@@ -47,6 +49,7 @@
 
 #include <geos/inline.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory> // auto_ptr
 #include <cassert>
@@ -68,6 +71,63 @@ using namespace geos::geom;
 namespace geos {
 namespace geomgraph { // geos.geomgraph
 
+namespace {
+
+/**
+ * Mean number of chains the sweep line compares each one with, from
+ * which indexing them in a tree is faster. Measured with
+ * tests/perf/geomgraph/EdgeSetIntersectorPerfTest.
+ */
+const double STRTREE_MIN_SWEEP_OVERLAPS = 256;
+
+/*
+ * Estimates the cost of the sweep line over the monotone chains of
+ * edges, which compares each chain with the chains starting within its
+ * x extent.
+ */
+struct ChainStats {
+
+	ChainStats() : numChains(0), sumWidth(0), minX(0), maxX(0) {}
+
+	void add(vector<Edge*>& edges)
+	{
+		for (size_t i=0, n=edges.size(); i<n; ++i)
+		{
+			index::MonotoneChainEdge* mce=edges[i]->getMonotoneChainEdge();
+			int nj=static_cast<int>(mce->getStartIndexes().size())-1;
+			for (int j=0; j<nj; ++j)
+			{
+				double x0=mce->getMinX(j);
+				double x1=mce->getMaxX(j);
+				if ( numChains == 0 ) { minX=x0; maxX=x1; }
+				else { minX=std::min(minX, x0); maxX=std::max(maxX, x1); }
+				sumWidth+=x1-x0;
+				++numChains;
+			}
+		}
+	}
+
+	/**
+	 * Mean number of chains starting within the x extent of a chain,
+	 * assuming they are evenly spread in x
+	 */
+	double getSweepOverlaps() const
+	{
+		if ( numChains == 0 ) return 0;
+		double width = maxX - minX;
+		// all chains at the same x
+		if ( width <= 0 ) return double(numChains);
+		return std::min(double(numChains), sumWidth / width);
+	}
+
+	size_t numChains;
+	double sumWidth;
+	double minX;
+	double maxX;
+};
+
+} // anonymous namespace
+
 /*
  * This method implements the Boundary Determination Rule
  * for determining whether
@@ -95,7 +155,8 @@ GeometryGraph::determineBoundary(int boundaryCount)
 
 
 EdgeSetIntersector*
-GeometryGraph::createEdgeSetIntersector()
+GeometryGraph::createEdgeSetIntersector(vector<Edge*>& edges0,
+		vector<Edge*>* edges1)
 {
 	// various options for computing intersections, from slowest to fastest
 
@@ -106,6 +167,17 @@ GeometryGraph::createEdgeSetIntersector()
 	//private EdgeSetIntersector esi = new MCSweepLineIntersector();
 
 	//return new SimpleEdgeSetIntersector();
+
+	bool useTree = edgeSetIntersectorType == EdgeSetIntersector::STRTREE;
+	if ( edgeSetIntersectorType == EdgeSetIntersector::AUTO )
+	{
+		ChainStats stats;
+		stats.add(edges0);
+		if ( edges1 ) stats.add(*edges1);
+		useTree = stats.getSweepOverlaps() >= STRTREE_MIN_SWEEP_OVERLAPS;
+	}
+
+	if ( useTree ) return new STRtreeEdgeSetIntersector();
 	return new SimpleMCSweepLineIntersector();
 }
 
@@ -348,7 +420,7 @@ SegmentIntersector*
 GeometryGraph::computeSelfNodes(LineIntersector *li, bool computeRingSelfNodes)
 {
 	SegmentIntersector *si=new SegmentIntersector(li,true,false);
-    	auto_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector());
+    	auto_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector(*edges));
 
 	// optimized test for Polygons and Rings
 	if (! computeRingSelfNodes
@@ -381,7 +453,8 @@ GeometryGraph::computeEdgeIntersections(GeometryGraph *g,
 	SegmentIntersector *si=new SegmentIntersector(li, includeProper, true);
 
 	si->setBoundaryNodes(getBoundaryNodes(), g->getBoundaryNodes());
-	auto_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector());
+	auto_ptr<EdgeSetIntersector> esi(
+		createEdgeSetIntersector(*edges, g->edges));
 	esi->computeIntersections(edges, g->edges, si);
 #if GEOS_DEBUG
 	cerr<<"GeometryGraph::computeEdgeIntersections returns"<<endl;
@@ -498,7 +571,8 @@ GeometryGraph::GeometryGraph(int newArgIndex,
 	useBoundaryDeterminationRule(true),
 	boundaryNodeRule(algorithm::BoundaryNodeRule::OGC_SFS_BOUNDARY_RULE),
 	argIndex(newArgIndex),
-	hasTooFewPointsVar(false)
+	hasTooFewPointsVar(false),
+	edgeSetIntersectorType(EdgeSetIntersector::AUTO)
 {
 	if (parentGeom!=NULL) add(parentGeom);
 }
@@ -512,7 +586,8 @@ GeometryGraph::GeometryGraph(int newArgIndex,
 	useBoundaryDeterminationRule(true),
 	boundaryNodeRule(bnr),
 	argIndex(newArgIndex),
-	hasTooFewPointsVar(false)
+	hasTooFewPointsVar(false),
+	edgeSetIntersectorType(EdgeSetIntersector::AUTO)
 {
 	if (parentGeom!=NULL) add(parentGeom);
 }
@@ -524,7 +599,8 @@ GeometryGraph::GeometryGraph()
 	useBoundaryDeterminationRule(true),
 	boundaryNodeRule(algorithm::BoundaryNodeRule::OGC_SFS_BOUNDARY_RULE),
 	argIndex(-1),
-	hasTooFewPointsVar(false)
+	hasTooFewPointsVar(false),
+	edgeSetIntersectorType(EdgeSetIntersector::AUTO)
 {
 }
 
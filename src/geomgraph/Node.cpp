@@ -37,8 +37,12 @@
 #define GEOS_DEBUG 0
 #endif
 #ifndef COMPUTE_Z
-#define COMPUTE_Z 1
-#endif
+# ifdef GEOS_COORDINATE_2D
+#  define COMPUTE_Z 0
+# else
+#  define COMPUTE_Z 1
+# endif
+#endif // COMPUTE_Z
 
 using namespace std;
 using namespace geos::geom;
@@ -60,14 +64,14 @@ Node::Node(const Coordinate& newCoord, EdgeEndStar* newEdges)
 
 #if COMPUTE_Z
 	ztot = 0;
-	addZ(newCoord.z);
+	addZ(newCoord.getZ());
 	if ( edges )
 	{
 		EdgeEndStar::iterator endIt = edges->end();
 		for (EdgeEndStar::iterator it=edges->begin(); it!=endIt; ++it)
 		{
 			EdgeEnd *ee = *it;
-			addZ(ee->getCoordinate().z);
+			addZ(ee->getCoordinate().getZ());
 		}
 	}
 #endif // COMPUTE_Z
@@ -150,7 +154,7 @@ Node::add(EdgeEnd *e)
 	edges->insert(e);
 	e->setNode(this);
 #if COMPUTE_Z
-	addZ(e->getCoordinate().z);
+	addZ(e->getCoordinate().getZ());
 #endif
 	testInvariant();
 }
@@ -258,9 +262,9 @@ Node::addZ(double z)
 	}
 	zvals.push_back(z);
 	ztot+=z;
-	coord.z=ztot/zvals.size();
+	coord.setZ(ztot/zvals.size());
 #if GEOS_DEBUG
-	cerr<<" added "<<z<<": ["<<ztot<<"/"<<zvals.size()<<"="<<coord.z<<"]"<<endl;
+	cerr<<" added "<<z<<": ["<<ztot<<"/"<<zvals.size()<<"="<<coord.getZ()<<"]"<<endl;
 #endif
 }
 
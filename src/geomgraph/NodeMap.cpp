@@ -68,17 +68,14 @@ NodeMap::addNode(const Coordinate& coord)
                 cerr<<" is new"<<endl;
 #endif
                 node=nodeFact.createNode(coord);
-		Coordinate* c = const_cast<Coordinate *>(
-			&(node->getCoordinate()));
-                nodeMap[c]=node;
-                //nodeMap[const_cast<Coordinate *>(&coord)]=node;
+                insertNode(node);
         }
         else
         {
 #if GEOS_DEBUG
                 cerr<<" already found ("<<node->getCoordinate().toString()<<") - adding Z"<<endl;
 #endif
-                node->addZ(coord.z);
+                node->addZ(coord.getZ());
         }
         return node;
 }
@@ -99,7 +96,7 @@ NodeMap::addNode(Node *n)
 #if GEOS_DEBUG
 		cerr<<" is new"<<endl;
 #endif
-		nodeMap[c]=n;
+		insertNode(n);
 		return n;
 	}
 #if GEOS_DEBUG
@@ -118,6 +115,15 @@ NodeMap::addNode(Node *n)
 	return node;
 }
 
+/*private*/
+void
+NodeMap::insertNode(Node *n)
+{
+	Coordinate* c = const_cast<Coordinate *>(&(n->getCoordinate()));
+	nodeMap.insert(pair(c, n));
+	nodeIndex.insert(*c, n);
+}
+
 void
 NodeMap::add(EdgeEnd *e)
 {
@@ -132,14 +138,7 @@ NodeMap::add(EdgeEnd *e)
 Node*
 NodeMap::find(const Coordinate& coord) const
 {
-	Coordinate *c=const_cast<Coordinate *>(&coord);
-
-	NodeMap::const_iterator found=nodeMap.find(c);
-
-	if (found==nodeMap.end())
-		return NULL;
-	else
-		return found->second;
+	return nodeIndex.find(coord);
 }
 
 void
@@ -0,0 +1,176 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geomgraph/index/STRtreeEdgeSetIntersector.h>
+#include <geos/geomgraph/index/MonotoneChainEdge.h>
+#include <geos/geomgraph/Edge.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+
+#include <algorithm>
+
+using namespace std;
+
+namespace geos {
+namespace geomgraph { // geos.geomgraph
+namespace index { // geos.geomgraph.index
+
+namespace {
+
+// Orders chains as the insert events of the sweep line
+template <class C>
+struct MinXLessThan {
+	bool operator()(const C* c0, const C* c1) const
+	{
+		return c0->env.getMinX() < c1->env.getMinX();
+	}
+};
+
+template <class C>
+struct RankLessThan {
+	bool operator()(const C* c0, const C* c1) const
+	{
+		return c0->rank < c1->rank;
+	}
+};
+
+} // anonymous namespace
+
+STRtreeEdgeSetIntersector::STRtreeEdgeSetIntersector()
+	:
+	nOverlaps(0)
+{
+}
+
+STRtreeEdgeSetIntersector::~STRtreeEdgeSetIntersector()
+{
+}
+
+void
+STRtreeEdgeSetIntersector::computeIntersections(vector<Edge*> *edges,
+	SegmentIntersector *si, bool testAllSegments)
+{
+	if (testAllSegments)
+		add(edges,NULL);
+	else
+		add(edges);
+	computeIntersections(si);
+}
+
+void
+STRtreeEdgeSetIntersector::computeIntersections(vector<Edge*> *edges0,
+	vector<Edge*> *edges1, SegmentIntersector *si)
+{
+	add(edges0,edges0);
+	add(edges1,edges1);
+	computeIntersections(si);
+}
+
+void
+STRtreeEdgeSetIntersector::add(vector<Edge*> *edges)
+{
+	for (size_t i=0; i<edges->size(); ++i)
+	{
+		Edge *edge=(*edges)[i];
+		// edge is its own group
+		add(edge, edge);
+	}
+}
+
+void
+STRtreeEdgeSetIntersector::add(vector<Edge*> *edges, void* edgeSet)
+{
+	for (size_t i=0; i<edges->size(); ++i)
+	{
+		Edge *edge=(*edges)[i];
+		add(edge,edgeSet);
+	}
+}
+
+void
+STRtreeEdgeSetIntersector::add(Edge *edge, void* edgeSet)
+{
+	MonotoneChainEdge *mce=edge->getMonotoneChainEdge();
+	const geom::CoordinateSequence* pts=mce->getCoordinates();
+	vector<int> &startIndex=mce->getStartIndexes();
+	size_t n = startIndex.size()-1;
+	chains.reserve(chains.size()+n);
+	for(size_t i=0; i<n; ++i)
+	{
+		Chain c;
+		c.mce=mce;
+		c.chainIndex=static_cast<int>(i);
+		c.edgeSet=edgeSet;
+		// a monotone chain lies in the envelope of its end points
+		c.env.init(pts->getAt(startIndex[i]), pts->getAt(startIndex[i+1]));
+		c.rank=0;
+		chains.push_back(c);
+	}
+}
+
+/*
+ * The sweep line compares each chain with the chains starting after it
+ * in x order and before its end. Those of them overlapping it are found
+ * by querying the tree, and compared in the same order.
+ */
+void
+STRtreeEdgeSetIntersector::computeIntersections(SegmentIntersector *si)
+{
+	nOverlaps=0;
+
+	const size_t n=chains.size();
+	vector<Chain*> byX(n);
+	for(size_t i=0; i<n; ++i) byX[i]=&chains[i];
+	stable_sort(byX.begin(), byX.end(), MinXLessThan<Chain>());
+
+	geos::index::strtree::PackedSTRtree tree;
+	for(size_t i=0; i<n; ++i)
+	{
+		byX[i]->rank=i;
+		tree.insert(&(byX[i]->env), byX[i]);
+	}
+
+	vector<void*> overlapping;
+	vector<Chain*> later;
+	for(size_t i=0; i<n; ++i)
+	{
+		Chain *c0=byX[i];
+		overlapping.clear();
+		tree.query(&(c0->env), overlapping);
+
+		later.clear();
+		for(size_t j=0, nj=overlapping.size(); j<nj; ++j)
+		{
+			Chain *c1=static_cast<Chain*>(overlapping[j]);
+			if (c1->rank<i) continue;
+			// don't compare edges in same group
+			// null group indicates that edges should be compared
+			if (c0->edgeSet==NULL || (c0->edgeSet!=c1->edgeSet))
+				later.push_back(c1);
+		}
+		sort(later.begin(), later.end(), RankLessThan<Chain>());
+
+		for(size_t j=0, nj=later.size(); j<nj; ++j)
+		{
+			Chain *c1=later[j];
+			c0->mce->computeIntersectsForChain(c0->chainIndex,
+					*(c1->mce), c1->chainIndex, *si);
+			nOverlaps++;
+		}
+	}
+}
+
+} // namespace geos.geomgraph.index
+} // namespace geos.geomgraph
+} // namespace geos
+
@@ -0,0 +1,31 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/GeometryItemDistance.h>
+#include <geos/geom/Geometry.h>
+
+namespace geos {
+namespace index { // geos.index
+namespace strtree { // geos.index.strtree
+
+double
+GeometryItemDistance::distance(const void* item1, const void* item2)
+{
+	const geom::Geometry* g1 = static_cast<const geom::Geometry*>(item1);
+	const geom::Geometry* g2 = static_cast<const geom::Geometry*>(item2);
+	return g1->distance(g2);
+}
+
+} // namespace geos.index.strtree
+} // namespace geos.index
+} // namespace geos
@@ -0,0 +1,745 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/index/strtree/AbstractSTRtree.h> // for ItemsList
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/index/ItemVisitor.h>
+#include <geos/util/TaskRunner.h>
+#include <geos/geom/Envelope.h>
+
+#include <vector>
+#include <algorithm> // std::sort
+#include <queue> // std::priority_queue
+#include <iterator> // std::iterator_traits
+#include <memory>
+#include <limits>
+#include <cassert>
+#include <cmath>
+
+using namespace std;
+using namespace geos::geom;
+
+namespace geos {
+namespace index { // geos.index
+namespace strtree { // geos.index.strtree
+
+namespace { // anonymous
+
+typedef PackedSTRtree::Bounds Bounds;
+typedef PackedSTRtree::Node Node;
+
+/// An item and its envelope, used while sorting the leaf level
+struct ItemEntry {
+	Bounds bounds;
+	void* item;
+};
+
+/// A query of a batch, used to sort queries in STR order
+struct QueryEntry {
+	Bounds bounds;
+	std::size_t index;
+	bool isNull;
+};
+
+/// Number of queries a batch query thread picks up at once
+const std::size_t QUERY_CHUNK_SIZE = 256;
+
+inline const Bounds& boundsOf(const ItemEntry& e) { return e.bounds; }
+inline const Bounds& boundsOf(const QueryEntry& e) { return e.bounds; }
+inline const Bounds& boundsOf(const Node& n) { return n.bounds; }
+
+template <class T>
+bool xComparator(const T& a, const T& b)
+{
+	// See http://trac.osgeo.org/geos/ticket/293
+	return AbstractSTRtree::compareDoubles(boundsOf(a).centreX(),
+	                                       boundsOf(b).centreX());
+}
+
+template <class T>
+bool yComparator(const T& a, const T& b)
+{
+	return AbstractSTRtree::compareDoubles(boundsOf(a).centreY(),
+	                                       boundsOf(b).centreY());
+}
+
+/*
+ * Sorts the given range in STR order: by the x-value of the
+ * envelope midpoints into vertical slices, then each slice by the
+ * y-value of the midpoints.
+ *
+ * @return the number of entries in each slice (the last slice
+ *         may be shorter)
+ */
+template <class Iter>
+std::size_t strSort(Iter begin, Iter end, std::size_t nodeCapacity)
+{
+	typedef typename std::iterator_traits<Iter>::value_type T;
+
+	std::size_t n = end - begin;
+	std::size_t minLeafCount = (std::size_t) ceil((double)n / (double)nodeCapacity);
+	std::size_t sliceCount = (std::size_t) ceil(sqrt((double)minLeafCount));
+	std::size_t sliceCapacity = (std::size_t) ceil((double)n / (double)sliceCount);
+
+	std::sort(begin, end, xComparator<T>);
+	for (std::size_t i=0; i<n; i+=sliceCapacity)
+	{
+		std::size_t sliceEnd = std::min(i+sliceCapacity, n);
+		std::sort(begin+i, begin+sliceEnd, yComparator<T>);
+	}
+	return sliceCapacity;
+}
+
+Bounds removedBounds()
+{
+	Bounds b;
+	b.minX = b.minY = std::numeric_limits<double>::infinity();
+	b.maxX = b.maxY = -std::numeric_limits<double>::infinity();
+	return b;
+}
+
+class VectorCollector {
+	std::vector<void*>& matches;
+public:
+	VectorCollector(std::vector<void*>& m) : matches(m) {}
+	void operator()(void* item) { matches.push_back(item); }
+};
+
+class VisitorAdapter {
+	ItemVisitor& visitor;
+public:
+	VisitorAdapter(ItemVisitor& v) : visitor(v) {}
+	void operator()(void* item) { visitor.visitItem(item); }
+};
+
+/// An entry of the nearest neighbour search queue
+struct NearestEntry {
+
+	enum Kind {
+		/// a node, distance is the envelope distance
+		node,
+		/// an item, distance is the envelope distance
+		item,
+		/// an item, distance is the ItemDistance
+		itemExact
+	};
+
+	double distance;
+	std::size_t index;
+	Kind kind;
+
+	NearestEntry(double d, std::size_t i, Kind k)
+		: distance(d), index(i), kind(k)
+	{}
+};
+
+/// Orders the queue closest first, exact item distances first
+/// on ties, then by tree order
+struct NearestEntryGreater {
+	bool operator()(const NearestEntry& a, const NearestEntry& b) const
+	{
+		if ( a.distance != b.distance ) return a.distance > b.distance;
+		if ( a.kind != b.kind ) return a.kind < b.kind;
+		return a.index > b.index;
+	}
+};
+
+/// An entry of the tree-vs-tree nearest pair search queue: a node
+/// or item of each tree
+struct PairEntry {
+	/// Envelope distance, or the ItemDistance if exact
+	double distance;
+	std::size_t index1;
+	std::size_t index2;
+	bool isItem1;
+	bool isItem2;
+	bool exact;
+
+	PairEntry(double d, std::size_t i1, bool item1,
+	          std::size_t i2, bool item2, bool exact=false)
+		: distance(d), index1(i1), index2(i2),
+		  isItem1(item1), isItem2(item2), exact(exact)
+	{}
+};
+
+/// Orders the queue closest first, exact distances first on ties,
+/// then by tree order
+struct PairEntryGreater {
+	bool operator()(const PairEntry& a, const PairEntry& b) const
+	{
+		if ( a.distance != b.distance ) return a.distance > b.distance;
+		if ( a.exact != b.exact ) return b.exact;
+		if ( a.index1 != b.index1 ) return a.index1 > b.index1;
+		return a.index2 > b.index2;
+	}
+};
+
+inline double area(const Bounds& b)
+{
+	return (b.maxX - b.minX) * (b.maxY - b.minY);
+}
+
+} // anonymous namespace
+
+/*public*/
+PackedSTRtree::PackedSTRtree(std::size_t newNodeCapacity)
+	:
+	nodeCapacity(newNodeCapacity),
+	built(false),
+	leafCount(0)
+{
+	assert(newNodeCapacity>1);
+}
+
+/*public*/
+PackedSTRtree::~PackedSTRtree()
+{
+}
+
+/*public*/
+void
+PackedSTRtree::insert(const Envelope *itemEnv, void* item)
+{
+	if (itemEnv->isNull()) { return; }
+
+	// Node levels will be recreated by next query
+	if (built) {
+		built = false;
+		nodes.clear();
+		leafCount = 0;
+	}
+
+	itemBounds.push_back(toBounds(*itemEnv));
+	items.push_back(item);
+}
+
+/*public*/
+void
+PackedSTRtree::build()
+{
+	nodes.clear();
+	leafCount = 0;
+	built = true;
+
+	std::size_t sliceCapacity = sortItems();
+	if (itemBounds.empty()) return;
+
+	// Leaf level, children are items
+	std::size_t n = itemBounds.size();
+	nodes.reserve(n / (nodeCapacity-1) + 2);
+	for (std::size_t slice=0; slice<n; slice+=sliceCapacity)
+	{
+		std::size_t sliceEnd = std::min(slice+sliceCapacity, n);
+		for (std::size_t i=slice; i<sliceEnd; i+=nodeCapacity)
+		{
+			Node node;
+			node.childBegin = i;
+			node.childEnd = std::min(i+nodeCapacity, sliceEnd);
+			node.bounds = itemBounds[i];
+			for (std::size_t j=i+1; j<node.childEnd; ++j)
+				node.bounds.expandToInclude(itemBounds[j]);
+			nodes.push_back(node);
+		}
+	}
+	leafCount = nodes.size();
+
+	// Higher levels, up to the root
+	std::size_t levelBegin = 0;
+	std::size_t levelEnd = nodes.size();
+	while (levelEnd - levelBegin > 1)
+	{
+		createParentLevel(levelBegin, levelEnd);
+		levelBegin = levelEnd;
+		levelEnd = nodes.size();
+	}
+}
+
+/*private*/
+std::size_t
+PackedSTRtree::sortItems()
+{
+	std::vector<ItemEntry> entries;
+	entries.reserve(itemBounds.size());
+	for (std::size_t i=0, n=itemBounds.size(); i<n; ++i)
+	{
+		// Drop removed items
+		if ( itemBounds[i].isNull() ) continue;
+		ItemEntry e;
+		e.bounds = itemBounds[i];
+		e.item = items[i];
+		entries.push_back(e);
+	}
+
+	itemBounds.clear();
+	items.clear();
+	if ( entries.empty() ) return 0;
+
+	std::size_t sliceCapacity = strSort(entries.begin(), entries.end(),
+	                                    nodeCapacity);
+
+	itemBounds.reserve(entries.size());
+	items.reserve(entries.size());
+	for (std::size_t i=0, n=entries.size(); i<n; ++i)
+	{
+		itemBounds.push_back(entries[i].bounds);
+		items.push_back(entries[i].item);
+	}
+	return sliceCapacity;
+}
+
+/*private*/
+void
+PackedSTRtree::createParentLevel(std::size_t levelBegin, std::size_t levelEnd)
+{
+	// Sorting a level only moves the nodes of that level,
+	// their child ranges in the level below stay valid.
+	std::size_t sliceCapacity = strSort(nodes.begin()+levelBegin,
+	                                    nodes.begin()+levelEnd,
+	                                    nodeCapacity);
+
+	for (std::size_t slice=levelBegin; slice<levelEnd; slice+=sliceCapacity)
+	{
+		std::size_t sliceEnd = std::min(slice+sliceCapacity, levelEnd);
+		for (std::size_t i=slice; i<sliceEnd; i+=nodeCapacity)
+		{
+			Node node;
+			node.childBegin = i;
+			node.childEnd = std::min(i+nodeCapacity, sliceEnd);
+			node.bounds = nodes[i].bounds;
+			for (std::size_t j=i+1; j<node.childEnd; ++j)
+				node.bounds.expandToInclude(nodes[j].bounds);
+			nodes.push_back(node);
+		}
+	}
+}
+
+/*private*/
+template <class Visitor>
+void
+PackedSTRtree::query(const Bounds& searchBounds, std::size_t node,
+		Visitor& visitor) const
+{
+	const Node& n = nodes[node];
+	if ( isLeaf(node) )
+	{
+		for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+		{
+			if ( itemBounds[i].intersects(searchBounds) )
+				visitor(items[i]);
+		}
+		return;
+	}
+
+	for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+	{
+		if ( nodes[i].bounds.intersects(searchBounds) )
+			query(searchBounds, i, visitor);
+	}
+}
+
+/*public*/
+void
+PackedSTRtree::query(const Envelope *searchEnv, std::vector<void*>& matches)
+{
+	if (!built) build();
+	if (nodes.empty() || searchEnv->isNull()) return;
+
+	Bounds searchBounds = toBounds(*searchEnv);
+	std::size_t root = nodes.size()-1;
+	if ( ! nodes[root].bounds.intersects(searchBounds) ) return;
+
+	VectorCollector collector(matches);
+	query(searchBounds, root, collector);
+}
+
+/*public*/
+void
+PackedSTRtree::query(const Envelope *searchEnv, ItemVisitor& visitor)
+{
+	if (!built) build();
+	if (nodes.empty() || searchEnv->isNull()) return;
+
+	Bounds searchBounds = toBounds(*searchEnv);
+	std::size_t root = nodes.size()-1;
+	if ( ! nodes[root].bounds.intersects(searchBounds) ) return;
+
+	VisitorAdapter adapter(visitor);
+	query(searchBounds, root, adapter);
+}
+
+/*private*/
+class PackedSTRtree::BatchQueryTask: public util::TaskRunner::Task {
+
+public:
+
+	/// Results of a chunk of queries, in sorted query order
+	struct Chunk {
+		std::vector<void*> matches;
+		std::vector<std::size_t> counts;
+	};
+
+	BatchQueryTask(const PackedSTRtree& t,
+	               const std::vector<QueryEntry>& q,
+	               std::vector<Chunk>& c)
+		:
+		tree(t),
+		queries(q),
+		chunks(c)
+	{}
+
+	void run(std::size_t chunkIndex)
+	{
+		Chunk& chunk = chunks[chunkIndex];
+		VectorCollector collector(chunk.matches);
+		std::size_t root = tree.nodes.size()-1;
+		const Bounds& rootBounds = tree.nodes[root].bounds;
+
+		std::size_t begin = chunkIndex * QUERY_CHUNK_SIZE;
+		std::size_t end = std::min(begin + QUERY_CHUNK_SIZE, queries.size());
+		chunk.counts.reserve(end - begin);
+		for (std::size_t i=begin; i<end; ++i)
+		{
+			const QueryEntry& q = queries[i];
+			std::size_t before = chunk.matches.size();
+			if ( ! q.isNull && rootBounds.intersects(q.bounds) )
+				tree.query(q.bounds, root, collector);
+			chunk.counts.push_back(chunk.matches.size() - before);
+		}
+	}
+
+private:
+
+	const PackedSTRtree& tree;
+	const std::vector<QueryEntry>& queries;
+	std::vector<Chunk>& chunks;
+
+	// Declare type as noncopyable
+	BatchQueryTask(const BatchQueryTask& other);
+	BatchQueryTask& operator=(const BatchQueryTask& rhs);
+};
+
+/*public*/
+void
+PackedSTRtree::queryBatch(const std::vector<Envelope>& searchEnvs,
+		std::vector<std::size_t>& offsets,
+		std::vector<void*>& matches,
+		unsigned int numThreads)
+{
+	if (!built) build();
+
+	std::size_t n = searchEnvs.size();
+	offsets.assign(n+1, 0);
+	matches.clear();
+	if ( n == 0 || nodes.empty() ) return;
+
+	// Run the queries in spatial order
+	std::vector<QueryEntry> queries(n);
+	for (std::size_t i=0; i<n; ++i)
+	{
+		queries[i].isNull = searchEnvs[i].isNull();
+		queries[i].bounds = toBounds(searchEnvs[i]);
+		queries[i].index = i;
+		if ( queries[i].isNull ) {
+			queries[i].bounds.minX = queries[i].bounds.maxX = 0;
+			queries[i].bounds.minY = queries[i].bounds.maxY = 0;
+		}
+	}
+	strSort(queries.begin(), queries.end(), nodeCapacity);
+
+	typedef BatchQueryTask::Chunk Chunk;
+	std::size_t chunkCount = (n + QUERY_CHUNK_SIZE - 1) / QUERY_CHUNK_SIZE;
+	std::vector<Chunk> chunks(chunkCount);
+	BatchQueryTask task(*this, queries, chunks);
+	util::TaskRunner runner(numThreads);
+	runner.run(task, chunkCount);
+
+	// Back to the caller's order
+	for (std::size_t c=0; c<chunkCount; ++c)
+	{
+		const std::vector<std::size_t>& counts = chunks[c].counts;
+		for (std::size_t k=0; k<counts.size(); ++k)
+			offsets[queries[c*QUERY_CHUNK_SIZE+k].index + 1] = counts[k];
+	}
+	for (std::size_t i=0; i<n; ++i)
+		offsets[i+1] += offsets[i];
+
+	matches.resize(offsets[n]);
+	for (std::size_t c=0; c<chunkCount; ++c)
+	{
+		const Chunk& chunk = chunks[c];
+		std::size_t pos = 0;
+		for (std::size_t k=0; k<chunk.counts.size(); ++k)
+		{
+			std::size_t dst = offsets[queries[c*QUERY_CHUNK_SIZE+k].index];
+			std::copy(chunk.matches.begin() + pos,
+			          chunk.matches.begin() + pos + chunk.counts[k],
+			          matches.begin() + dst);
+			pos += chunk.counts[k];
+		}
+	}
+}
+
+/*public*/
+bool
+PackedSTRtree::remove(const Envelope *itemEnv, void* item)
+{
+	if (!built) build();
+	if (nodes.empty() || itemEnv->isNull()) return false;
+
+	Bounds searchBounds = toBounds(*itemEnv);
+
+	// Leaves are the first leafCount nodes, no need to descend
+	for (std::size_t l=0; l<leafCount; ++l)
+	{
+		const Node& leaf = nodes[l];
+		if ( ! leaf.bounds.intersects(searchBounds) ) continue;
+		for (std::size_t i=leaf.childBegin; i<leaf.childEnd; ++i)
+		{
+			if ( items[i] == item && ! itemBounds[i].isNull() )
+			{
+				itemBounds[i] = removedBounds();
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/*public*/
+void*
+PackedSTRtree::nearestNeighbour(const Envelope* env, const void* item,
+		ItemDistance& itemDist)
+{
+	std::vector<void*> result;
+	nearestNeighbours(env, item, itemDist, 1, result);
+	if ( result.empty() ) return NULL;
+	return result[0];
+}
+
+/*public*/
+void
+PackedSTRtree::nearestNeighbours(const Envelope* env, const void* item,
+		ItemDistance& itemDist, std::size_t k,
+		std::vector<void*>& result, double maxDistance)
+{
+	if (!built) build();
+	if (nodes.empty() || env->isNull() || k == 0) return;
+
+	typedef std::priority_queue<NearestEntry, std::vector<NearestEntry>,
+	                            NearestEntryGreater> Queue;
+
+	Bounds searchBounds = toBounds(*env);
+	Queue queue;
+
+	std::size_t root = nodes.size()-1;
+	double rootDistance = nodes[root].bounds.distance(searchBounds);
+	if ( rootDistance > maxDistance ) return;
+	queue.push(NearestEntry(rootDistance, root, NearestEntry::node));
+
+	std::size_t found = 0;
+	while ( ! queue.empty() && found < k )
+	{
+		NearestEntry e = queue.top();
+		queue.pop();
+
+		// Anything left in the queue is even farther
+		if ( e.distance > maxDistance ) break;
+
+		if ( e.kind == NearestEntry::itemExact )
+		{
+			result.push_back(items[e.index]);
+			++found;
+		}
+		else if ( e.kind == NearestEntry::item )
+		{
+			// Envelope distance is a lower bound, compute the
+			// real one and put the item back in line
+			double d = itemDist.distance(item, items[e.index]);
+			if ( d <= maxDistance )
+				queue.push(NearestEntry(d, e.index, NearestEntry::itemExact));
+		}
+		else
+		{
+			const Node& n = nodes[e.index];
+			bool leaf = isLeaf(e.index);
+			for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+			{
+				const Bounds& b = leaf ? itemBounds[i] : nodes[i].bounds;
+				if ( b.isNull() ) continue; // removed item
+				double d = b.distance(searchBounds);
+				if ( d > maxDistance ) continue;
+				queue.push(NearestEntry(d, i,
+					leaf ? NearestEntry::item : NearestEntry::node));
+			}
+		}
+	}
+}
+
+/*public*/
+bool
+PackedSTRtree::nearestNeighbour(PackedSTRtree& other, ItemDistance& itemDist,
+		void*& item1, void*& item2, double& distance,
+		double maxDistance, double stopDistance)
+{
+	if (!built) build();
+	if (!other.built) other.build();
+	if ( nodes.empty() || other.nodes.empty() ) return false;
+
+	typedef std::priority_queue<PairEntry, std::vector<PairEntry>,
+	                            PairEntryGreater> Queue;
+
+	Queue queue;
+
+	std::size_t root1 = nodes.size()-1;
+	std::size_t root2 = other.nodes.size()-1;
+	double rootDistance = nodes[root1].bounds.distance(
+		other.nodes[root2].bounds);
+	if ( rootDistance > maxDistance ) return false;
+	queue.push(PairEntry(rootDistance, root1, false, root2, false));
+
+	// The pair closest so far, farther pairs are pruned as
+	// soon as one is found
+	bool found = false;
+
+	while ( ! queue.empty() )
+	{
+		PairEntry e = queue.top();
+		queue.pop();
+
+		// Anything left in the queue is even farther
+		if ( e.distance > maxDistance ) break;
+
+		if ( e.exact ) break; // the closest pair, already recorded
+
+		if ( e.isItem1 && e.isItem2 )
+		{
+			// Envelope distance is a lower bound, compute
+			// the real one
+			double d = itemDist.distance(items[e.index1],
+			                             other.items[e.index2]);
+			if ( d > maxDistance ) continue;
+			if ( found && d >= distance ) continue;
+
+			found = true;
+			item1 = items[e.index1];
+			item2 = other.items[e.index2];
+			distance = d;
+			if ( d <= stopDistance ) break;
+
+			maxDistance = d;
+			queue.push(PairEntry(d, e.index1, true, e.index2, true, true));
+			continue;
+		}
+
+		// Expand the larger of the two nodes, so that both
+		// sides shrink at a similar pace
+		const Bounds& b1 = e.isItem1 ? itemBounds[e.index1]
+		                             : nodes[e.index1].bounds;
+		const Bounds& b2 = e.isItem2 ? other.itemBounds[e.index2]
+		                             : other.nodes[e.index2].bounds;
+		bool expand1 = ! e.isItem1 && ( e.isItem2 || area(b1) >= area(b2) );
+
+		if ( expand1 )
+		{
+			const Node& n = nodes[e.index1];
+			bool leaf = isLeaf(e.index1);
+			for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+			{
+				const Bounds& b = leaf ? itemBounds[i] : nodes[i].bounds;
+				if ( b.isNull() ) continue; // removed item
+				double d = b.distance(b2);
+				if ( d > maxDistance ) continue;
+				queue.push(PairEntry(d, i, leaf, e.index2, e.isItem2));
+			}
+		}
+		else
+		{
+			const Node& n = other.nodes[e.index2];
+			bool leaf = other.isLeaf(e.index2);
+			for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+			{
+				const Bounds& b = leaf ? other.itemBounds[i]
+				                       : other.nodes[i].bounds;
+				if ( b.isNull() ) continue; // removed item
+				double d = b1.distance(b);
+				if ( d > maxDistance ) continue;
+				queue.push(PairEntry(d, e.index1, e.isItem1, i, leaf));
+			}
+		}
+	}
+
+	return found;
+}
+
+/*public*/
+void
+PackedSTRtree::iterate(ItemVisitor& visitor)
+{
+	for (std::size_t i=0, n=items.size(); i<n; ++i)
+	{
+		if ( itemBounds[i].isNull() ) continue;
+		visitor.visitItem(items[i]);
+	}
+}
+
+/*private*/
+ItemsList*
+PackedSTRtree::itemsTree(std::size_t node)
+{
+	std::auto_ptr<ItemsList> valuesTreeForNode (new ItemsList());
+
+	const Node& n = nodes[node];
+	if ( isLeaf(node) )
+	{
+		for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+		{
+			if ( itemBounds[i].isNull() ) continue;
+			valuesTreeForNode->push_back(items[i]);
+		}
+	}
+	else
+	{
+		for (std::size_t i=n.childBegin; i<n.childEnd; ++i)
+		{
+			ItemsList* valuesTreeForChild = itemsTree(i);
+			// only add if not null (which indicates an item
+			// somewhere in this tree
+			if (valuesTreeForChild != NULL)
+				valuesTreeForNode->push_back_owned(valuesTreeForChild);
+		}
+	}
+
+	if (valuesTreeForNode->empty())
+		return NULL;
+
+	return valuesTreeForNode.release();
+}
+
+/*public*/
+ItemsList*
+PackedSTRtree::itemsTree()
+{
+	if (!built) build();
+	if (nodes.empty()) return new ItemsList();
+
+	ItemsList* valuesTree = itemsTree(nodes.size()-1);
+	if (valuesTree == NULL)
+		return new ItemsList();
+
+	return valuesTree;
+}
+
+} // namespace geos.index.strtree
+} // namespace geos.index
+} // namespace geos
@@ -20,13 +20,38 @@
 #include <geos/io/ByteOrderValues.h>
 #include <geos/platform.h>
 #include <geos/util.h>
+#include <geos/util/Machine.h> // for getMachineByteOrder
 
 #include <cstring>
 #include <cassert>
 
+#ifdef _MSC_VER
+#include <stdlib.h> // for _byteswap_uint64
+#endif
+
 namespace geos {
 namespace io { // geos.io
 
+namespace {
+
+inline int64
+swapBytes(int64 v)
+{
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+	return (int64)__builtin_bswap64((unsigned long long)v);
+#elif defined(_MSC_VER)
+	return (int64)_byteswap_uint64((unsigned __int64)v);
+#else
+	unsigned char b[8], r[8];
+	std::memcpy(b, &v, 8);
+	for (int i=0; i<8; ++i) r[i] = b[7-i];
+	std::memcpy(&v, r, 8);
+	return v;
+#endif
+}
+
+} // anonymous namespace
+
 int
 ByteOrderValues::getInt(const unsigned char *buf, int byteOrder)
 {
@@ -154,6 +179,26 @@ ByteOrderValues::putDouble(double doubleValue, unsigned char *buf, int byteOrder
 	putLong(longValue, buf, byteOrder);
 }
 
+void
+ByteOrderValues::getDoubles(const unsigned char *buf, double *out,
+		std::size_t n, int byteOrder)
+{
+	if ( byteOrder == getMachineByteOrder() )
+	{
+		if ( static_cast<const void*>(buf) != static_cast<void*>(out) )
+			std::memmove(out, buf, n * sizeof(double));
+		return;
+	}
+
+	for (std::size_t i=0; i<n; ++i)
+	{
+		int64 v;
+		std::memcpy(&v, buf + i * sizeof(double), sizeof(double));
+		v = swapBytes(v);
+		std::memcpy(out + i, &v, sizeof(double));
+	}
+}
+
 } // namespace geos.io
 } // namespace geos
 
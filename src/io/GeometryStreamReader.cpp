@@ -0,0 +1,461 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeometryStreamReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/ByteOrderValues.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/TaskRunner.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+
+#ifdef _WIN32
+# include <io.h> // for _read
+#else
+# include <unistd.h> // for read
+#endif
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos::io
+
+namespace {
+
+/// Size of the blocks read from a file descriptor
+const std::size_t READ_BLOCK_SIZE = 65536;
+
+const std::size_t DEFAULT_CHUNK_SIZE = 4096;
+
+inline int
+hexValue(char c)
+{
+	if ( c >= '0' && c <= '9' ) return c - '0';
+	if ( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+	if ( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+	throw ParseException("Invalid HEX char");
+}
+
+inline bool
+isSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+} // anonymous namespace
+
+/*
+ * Readers and scratch buffers for one thread,
+ * reused from a record to the next.
+ */
+class GeometryStreamReader::Parser {
+
+public:
+
+	Parser(const GeometryFactory& f)
+		:
+		wktReader(&f),
+		wkbReader(f)
+	{}
+
+	/// Throws ParseException whatever the parsing error, so that
+	/// the error type does not depend on the number of threads
+	Geometry* parse(Format format, const char* data, std::size_t len)
+	{
+		try {
+			return parseRecord(format, data, len);
+		}
+		catch (const ParseException&) {
+			throw;
+		}
+		catch (const util::GEOSException& e) {
+			// invalid geometries, such as unclosed rings
+			throw ParseException(e.what());
+		}
+	}
+
+private:
+
+	Geometry* parseRecord(Format format, const char* data, std::size_t len)
+	{
+		switch (format)
+		{
+			case WKT:
+				text.assign(data, len);
+				return wktReader.read(text);
+
+			case HEXWKB:
+				if ( len % 2 )
+					throw ParseException("Odd number of HEX chars");
+				bin.resize(len / 2);
+				for (std::size_t i=0; i<bin.size(); ++i)
+				{
+					bin[i] = static_cast<unsigned char>(
+						(hexValue(data[2*i]) << 4) | hexValue(data[2*i+1]));
+				}
+				return wkbReader.read(bin.empty() ? 0 : &bin[0], bin.size());
+
+			case WKB:
+			default:
+				return wkbReader.read(
+					reinterpret_cast<const unsigned char*>(data), len);
+		}
+	}
+
+	WKTReader wktReader;
+
+	WKBReader wkbReader;
+
+	std::string text;
+
+	std::vector<unsigned char> bin;
+};
+
+/*
+ * Parses the records of a chunk, in slices of consecutive records.
+ * Errors are recorded rather than thrown, so that the records
+ * preceding the first bad one can still be handed out.
+ */
+class GeometryStreamReader::ChunkTask: public util::TaskRunner::Task {
+
+public:
+
+	ChunkTask(GeometryStreamReader& r, std::size_t nSlices,
+	          std::vector<Geometry*>& res)
+		:
+		reader(r),
+		numSlices(nSlices),
+		results(res),
+		errorIndex(nSlices, res.size()),
+		errors(nSlices)
+	{}
+
+	void run(std::size_t slice)
+	{
+		const std::size_t n = results.size();
+		const std::size_t begin = slice * n / numSlices;
+		const std::size_t end = (slice + 1) * n / numSlices;
+		const std::vector<std::size_t>& offsets = reader.chunkOffsets;
+		const char* data = reader.chunkData.empty() ? 0 : &reader.chunkData[0];
+		Parser& parser = *reader.parsers[slice];
+
+		for (std::size_t i=begin; i<end; ++i)
+		{
+			try {
+				results[i] = parser.parse(reader.format, data + offsets[i],
+				                          offsets[i+1] - offsets[i]);
+			}
+			catch (const ParseException& e) {
+				errorIndex[slice] = i;
+				errors[slice] = e;
+				return;
+			}
+		}
+	}
+
+	/// Index of the first bad record, or the chunk size
+	std::size_t firstError(ParseException& error) const
+	{
+		for (std::size_t s=0; s<numSlices; ++s)
+		{
+			if ( errorIndex[s] < results.size() )
+			{
+				error = errors[s];
+				return errorIndex[s];
+			}
+		}
+		return results.size();
+	}
+
+private:
+
+	GeometryStreamReader& reader;
+	std::size_t numSlices;
+	std::vector<Geometry*>& results;
+	std::vector<std::size_t> errorIndex;
+	std::vector<ParseException> errors;
+
+	// Declare type as noncopyable
+	ChunkTask(const ChunkTask& other);
+	ChunkTask& operator=(const ChunkTask& rhs);
+};
+
+/*public*/
+GeometryStreamReader::GeometryStreamReader(const GeometryFactory& f,
+		Format fmt)
+	:
+	factory(f),
+	format(fmt),
+	fd(-1),
+	inputDone(true),
+	cur(0),
+	end(0),
+	recordCount(0),
+	chunkSize(DEFAULT_CHUNK_SIZE)
+{
+}
+
+/*public*/
+GeometryStreamReader::~GeometryStreamReader()
+{
+	for (std::size_t i=0; i<parsers.size(); ++i)
+		delete parsers[i];
+}
+
+/*public*/
+void
+GeometryStreamReader::setInput(int newFd)
+{
+	fd = newFd;
+	inputDone = false;
+	if ( buf.size() < READ_BLOCK_SIZE ) buf.resize(READ_BLOCK_SIZE);
+	cur = end = &buf[0];
+	recordCount = 0;
+}
+
+/*public*/
+void
+GeometryStreamReader::setInput(const char* data, std::size_t size)
+{
+	fd = -1;
+	inputDone = true;
+	cur = data;
+	end = data + size;
+	recordCount = 0;
+}
+
+/*private*/
+bool
+GeometryStreamReader::fill()
+{
+	if ( inputDone ) return false;
+
+	// move pending input to the front, grow if there is no room left
+	std::size_t pending = end - cur;
+	if ( pending && cur != &buf[0] )
+		std::memmove(&buf[0], cur, pending);
+	if ( pending == buf.size() )
+		buf.resize(buf.size() * 2);
+	cur = &buf[0];
+	end = cur + pending;
+
+	for (;;)
+	{
+#ifdef _WIN32
+		int n = _read(fd, &buf[pending],
+		              static_cast<unsigned int>(buf.size() - pending));
+#else
+		ssize_t n = ::read(fd, &buf[pending], buf.size() - pending);
+#endif
+		if ( n > 0 )
+		{
+			end += n;
+			return true;
+		}
+		if ( n == 0 )
+		{
+			inputDone = true;
+			return false;
+		}
+		if ( errno != EINTR )
+		{
+			throw util::GEOSException(
+				std::string("Error reading input: ") + std::strerror(errno));
+		}
+	}
+}
+
+/*private*/
+bool
+GeometryStreamReader::nextLine(const char*& data, std::size_t& len)
+{
+	for (;;)
+	{
+		std::size_t scanned = 0;
+		const char* nl;
+		for (;;)
+		{
+			std::size_t avail = (end - cur) - scanned;
+			nl = avail ? static_cast<const char*>(
+				std::memchr(cur + scanned, '\n', avail)) : 0;
+			if ( nl ) break;
+			scanned = end - cur;
+			if ( ! fill() ) break;
+		}
+
+		const char* lineEnd = nl ? nl : end;
+		if ( cur == lineEnd && ! nl ) return false; // end of input
+
+		const char* b = cur;
+		cur = nl ? nl + 1 : end;
+
+		while ( b < lineEnd && isSpace(*b) ) ++b;
+		while ( lineEnd > b && isSpace(lineEnd[-1]) ) --lineEnd;
+		if ( b == lineEnd ) continue; // empty line
+
+		data = b;
+		len = lineEnd - b;
+		return true;
+	}
+}
+
+/*private*/
+bool
+GeometryStreamReader::nextSized(const char*& data, std::size_t& len)
+{
+	while ( end - cur < 4 )
+	{
+		if ( ! fill() )
+		{
+			if ( cur == end ) return false;
+			throw ParseException("Unexpected EOF reading WKB record size");
+		}
+	}
+
+	int size = ByteOrderValues::getInt(
+		reinterpret_cast<const unsigned char*>(cur),
+		ByteOrderValues::ENDIAN_LITTLE);
+	if ( size < 0 )
+		throw ParseException("Negative WKB record size");
+
+	len = static_cast<std::size_t>(size);
+	while ( static_cast<std::size_t>(end - cur) < 4 + len )
+	{
+		if ( ! fill() )
+			throw ParseException("Unexpected EOF reading WKB record");
+	}
+
+	data = cur + 4;
+	cur += 4 + len;
+	return true;
+}
+
+/*private*/
+bool
+GeometryStreamReader::nextRecord(const char*& data, std::size_t& len)
+{
+	bool found = ( format == WKB ) ? nextSized(data, len)
+	                               : nextLine(data, len);
+	if ( found ) ++recordCount;
+	return found;
+}
+
+/*private*/
+void
+GeometryStreamReader::createParsers(std::size_t n)
+{
+	parsers.reserve(n);
+	while ( parsers.size() < n )
+		parsers.push_back(new Parser(factory));
+}
+
+/*public*/
+std::auto_ptr<Geometry>
+GeometryStreamReader::next()
+{
+	const char* data;
+	std::size_t len;
+	if ( ! nextRecord(data, len) ) return std::auto_ptr<Geometry>();
+
+	createParsers(1);
+	return std::auto_ptr<Geometry>(parsers[0]->parse(format, data, len));
+}
+
+/*public*/
+std::size_t
+GeometryStreamReader::readAll(Handler& h, unsigned int numThreads)
+{
+	std::size_t count = 0;
+
+	util::TaskRunner runner(numThreads);
+	if ( runner.getNumThreads() == 1 )
+	{
+		for (;;)
+		{
+			std::auto_ptr<Geometry> g = next();
+			if ( ! g.get() ) return count;
+			++count;
+			if ( ! h.handle(g) ) return count;
+		}
+	}
+
+	// A few slices per thread, so that threads getting
+	// cheaper records can take over more of the chunk
+	const std::size_t numSlices = runner.getNumThreads() * 4;
+	createParsers(numSlices);
+
+	std::vector<Geometry*> results;
+	for (;;)
+	{
+		// collect the raw records of the chunk
+		chunkData.clear();
+		chunkOffsets.assign(1, 0);
+		const char* data;
+		std::size_t len;
+		while ( chunkOffsets.size() <= chunkSize && nextRecord(data, len) )
+		{
+			chunkData.insert(chunkData.end(), data, data + len);
+			chunkOffsets.push_back(chunkData.size());
+		}
+		if ( chunkOffsets.size() == 1 ) return count;
+
+		results.assign(chunkOffsets.size() - 1, 0);
+		const std::size_t slices = std::min(numSlices, results.size());
+		ChunkTask task(*this, slices, results);
+		try {
+			runner.run(task, slices);
+		} catch (...) {
+			for (std::size_t j=0; j<results.size(); ++j) delete results[j];
+			throw;
+		}
+
+		ParseException error;
+		std::size_t good = task.firstError(error);
+
+		// hand out the records, in order
+		std::size_t i = 0;
+		bool stopped = false;
+		try {
+			for (; i<good && ! stopped; ++i)
+			{
+				std::auto_ptr<Geometry> g(results[i]);
+				results[i] = 0;
+				++count;
+				stopped = ! h.handle(g);
+			}
+		} catch (...) {
+			for (; i<results.size(); ++i) delete results[i];
+			throw;
+		}
+		for (; i<results.size(); ++i) delete results[i];
+
+		if ( stopped ) return count;
+		if ( good < results.size() )
+		{
+			recordCount -= results.size() - good - 1;
+			throw error;
+		}
+	}
+}
+
+} // namespace geos::io
+} // namespace geos
@@ -34,7 +34,9 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/PrecisionModel.h>
 
+#include <cstring>
 #include <iomanip>
+#include <limits>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -47,6 +49,13 @@ using namespace geos::geom;
 namespace geos {
 namespace io { // geos.io
 
+namespace {
+
+/// Byte order and type of a WKB geometry
+const size_t MIN_GEOMETRY_BYTES = 1 + 4;
+
+} // anonymous namespace
+
 WKBReader::WKBReader()
 	:
 	factory(*(GeometryFactory::getDefaultInstance()))
@@ -230,6 +239,13 @@ WKBReader::read(istream &is)
 	return readGeometry();
 }
 
+Geometry *
+WKBReader::read(const unsigned char *buf, size_t size)
+{
+	dis.setInBuffer(buf, size);
+	return readGeometry();
+}
+
 Geometry *
 WKBReader::readGeometry()
 {
@@ -350,6 +366,7 @@ Polygon *
 WKBReader::readPolygon()
 {
 	int numRings = dis.readInt();
+	checkCount(numRings, sizeof(int));
 
 #if DEBUG_WKB_READER
 	cout<<"WKB numRings: "<<numRings<<endl;
@@ -381,6 +398,7 @@ MultiPoint *
 WKBReader::readMultiPoint()
 {
 	int numGeoms = dis.readInt();
+	checkCount(numGeoms, MIN_GEOMETRY_BYTES);
 	vector<Geometry *> *geoms = new vector<Geometry *>(numGeoms);
 
 	try {
@@ -408,6 +426,7 @@ MultiLineString *
 WKBReader::readMultiLineString()
 {
 	int numGeoms = dis.readInt();
+	checkCount(numGeoms, MIN_GEOMETRY_BYTES);
 	vector<Geometry *> *geoms = new vector<Geometry *>(numGeoms);
 
 	try {
@@ -435,6 +454,7 @@ MultiPolygon *
 WKBReader::readMultiPolygon()
 {
 	int numGeoms = dis.readInt();
+	checkCount(numGeoms, MIN_GEOMETRY_BYTES);
 	vector<Geometry *> *geoms = new vector<Geometry *>(numGeoms);
 
 	try {
@@ -462,6 +482,7 @@ GeometryCollection *
 WKBReader::readGeometryCollection()
 {
 	int numGeoms = dis.readInt();
+	checkCount(numGeoms, MIN_GEOMETRY_BYTES);
 	vector<Geometry *> *geoms = new vector<Geometry *>(numGeoms);
 
 	try {
@@ -479,17 +500,75 @@ WKBReader::readGeometryCollection()
 CoordinateSequence *
 WKBReader::readCoordinateSequence(int size)
 {
-	CoordinateSequence *seq = factory.getCoordinateSequenceFactory()->create(size, inputDimension);
-	unsigned int targetDim = seq->getDimension();
-	if ( targetDim > inputDimension )
-		targetDim = inputDimension;
-	for (int i=0; i<size; i++) {
-		readCoordinate();
-		for (unsigned int j=0; j<targetDim; j++) {
-			seq->setOrdinate(i, j, ordValues[j]);
+	if ( size < 0 )
+		throw ParseException("Negative number of points parsing WKB");
+
+	checkCount(size, inputDimension * sizeof(double));
+
+	const PrecisionModel &pm = *factory.getPrecisionModel();
+	const size_t n = static_cast<size_t>(size);
+	vector<Coordinate> *coords = new vector<Coordinate>(n);
+
+	try {
+		if ( n )
+		{
+			const size_t nords = n * inputDimension;
+			if ( inputDimension * sizeof(double) == sizeof(Coordinate) )
+			{
+				// Coordinate layout matches the WKB one,
+				// decode straight into the vector
+				dis.readDoubles(reinterpret_cast<double *>(&(*coords)[0]),
+				                nords);
+			}
+			else
+			{
+				if ( seqValues.size() < nords ) seqValues.resize(nords);
+				dis.readDoubles(&seqValues[0], nords);
+				const double *v = &seqValues[0];
+				for (size_t i=0; i<n; ++i, v+=inputDimension)
+				{
+					Coordinate &c = (*coords)[i];
+					c.x = v[0];
+					c.y = v[1];
+					if ( inputDimension > 2 ) c.setZ(v[2]);
+				}
+			}
+
+			// makePrecise is a no-op for FLOATING only,
+			// FLOATING_SINGLE rounds to float
+			if ( pm.getType() != PrecisionModel::FLOATING )
+			{
+				for (size_t i=0; i<n; ++i)
+				{
+					Coordinate &c = (*coords)[i];
+					c.x = pm.makePrecise(c.x);
+					c.y = pm.makePrecise(c.y);
+				}
+			}
 		}
+	} catch (...) {
+		delete coords;
+		throw;
+	}
+
+	return factory.getCoordinateSequenceFactory()->create(coords,
+	                                                      inputDimension);
+}
+
+void
+WKBReader::checkCount(int count, size_t itemBytes)
+{
+	if ( count < 0 )
+		throw ParseException("Negative count parsing WKB");
+
+	// the count is untrusted, don't allocate more than the input
+	// can hold
+	const size_t n = static_cast<size_t>(count);
+	if ( n > numeric_limits<size_t>::max() / itemBytes ||
+	     ! dis.hasBytes(n * itemBytes) )
+	{
+		throw ParseException("Unexpected EOF parsing WKB");
 	}
-	return seq;
 }
 
 void
@@ -108,7 +108,7 @@ WKTReader::getPreciseCoordinate(StringTokenizer *tokenizer,
 	coord.x=getNextNumber(tokenizer);
 	coord.y=getNextNumber(tokenizer);
 	if (isNumberNext(tokenizer)) {
-		coord.z=getNextNumber(tokenizer);
+		coord.setZ(getNextNumber(tokenizer));
 		dim = 3;
         
         // If there is a fourth value (M) read and discard it.
@@ -116,7 +116,7 @@ WKTReader::getPreciseCoordinate(StringTokenizer *tokenizer,
             getNextNumber(tokenizer);
 
 	} else {
-		coord.z=DoubleNotANumber;
+		coord.setZ(DoubleNotANumber);
 		dim = 2;
 	}
 	precisionModel->makePrecise(coord);
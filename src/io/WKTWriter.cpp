@@ -105,11 +105,11 @@ WKTWriter::toLineString(const Coordinate& p0, const Coordinate& p1)
 	stringstream ret(ios_base::in|ios_base::out);
 	ret << "LINESTRING (" << p0.x << " " << p0.y;
 #if PRINT_Z
-	ret << " " << p0.z;
+	ret << " " << p0.getZ();
 #endif
 	ret << ", " << p1.x << " " << p1.y;
 #if PRINT_Z
-	ret << " " << p1.z;
+	ret << " " << p1.getZ();
 #endif
     ret << ")";
 
@@ -123,7 +123,7 @@ WKTWriter::toPoint(const Coordinate& p0)
 	stringstream ret(ios_base::in|ios_base::out);
     ret << "POINT (";
 #if PRINT_Z
-	ret << p0.x << " " << p0.y  << " " << p0.z << " )";
+	ret << p0.x << " " << p0.y  << " " << p0.getZ() << " )";
 #else
 	ret << p0.x << " " << p0.y  << " )";
 #endif
@@ -326,10 +326,10 @@ WKTWriter::appendCoordinate(const Coordinate* coordinate,
     if( outputDimension == 3 )
     {
         out+=" ";
-        if( ISNAN(coordinate->z) )
+        if( ISNAN(coordinate->getZ()) )
             out+=writeNumber(0.0);
         else
-            out+=writeNumber(coordinate->z);
+            out+=writeNumber(coordinate->getZ());
     }
 	writer->write(out);
 }
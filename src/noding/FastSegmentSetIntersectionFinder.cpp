@@ -39,8 +39,7 @@ namespace noding { // geos::noding
  */
 FastSegmentSetIntersectionFinder::
 FastSegmentSetIntersectionFinder( noding::SegmentString::ConstVect * baseSegStrings)
-:	segSetMutInt( new MCIndexSegmentSetMutualIntersector()),
-	lineIntersector( new LineIntersector())
+:	segSetMutInt( new MCIndexSegmentSetMutualIntersector())
 {
 	segSetMutInt->setBaseSegments( baseSegStrings);
 }
@@ -48,7 +47,6 @@ FastSegmentSetIntersectionFinder( noding::SegmentString::ConstVect * baseSegStri
 FastSegmentSetIntersectionFinder::
 ~FastSegmentSetIntersectionFinder()
 {
-	delete lineIntersector;
 	delete segSetMutInt;
 }
 
@@ -57,7 +55,8 @@ bool
 FastSegmentSetIntersectionFinder::
 intersects( noding::SegmentString::ConstVect * segStrings)
 {
-	SegmentIntersectionDetector intFinder( lineIntersector);
+	LineIntersector li;
+	SegmentIntersectionDetector intFinder( &li);
 
 	return this->intersects( segStrings, &intFinder);
 }
@@ -67,12 +66,19 @@ FastSegmentSetIntersectionFinder::
 intersects( noding::SegmentString::ConstVect * segStrings, 
 			SegmentIntersectionDetector * intDetector)
 {
-	segSetMutInt->setSegmentIntersector( intDetector);
-	segSetMutInt->process( segStrings);
+	segSetMutInt->process( segStrings, *intDetector);
 
 	return intDetector->hasIntersection();
 }
 
+void 
+FastSegmentSetIntersectionFinder::
+process( noding::SegmentString::ConstVect * segStrings, 
+         SegmentIntersector & si) const
+{
+	segSetMutInt->process( segStrings, si);
+}
+
 } // geos::noding
 } // geos
 
@@ -95,8 +95,8 @@ IntersectionAdder::processIntersections(
 		NodedSegmentString* ee0 = dynamic_cast<NodedSegmentString*>(e0);
 		NodedSegmentString* ee1 = dynamic_cast<NodedSegmentString*>(e1);
 		assert(ee0 && ee1);
-		ee0->addIntersections(&li, segIndex0, 0);
-		ee1->addIntersections(&li, segIndex1, 1);
+		addIntersections(ee0, segIndex0, 0);
+		addIntersections(ee1, segIndex1, 1);
 
 		if (li.isProper()) {
 			numProperIntersections++;
@@ -109,6 +109,28 @@ IntersectionAdder::processIntersections(
 	}
 }
 
+/*public*/
+void
+IntersectionAdder::addCounts(const IntersectionAdder& other)
+{
+	hasIntersectionVar = hasIntersectionVar || other.hasIntersectionVar;
+	hasProper = hasProper || other.hasProper;
+	hasProperInterior = hasProperInterior || other.hasProperInterior;
+	hasInterior = hasInterior || other.hasInterior;
+	numIntersections += other.numIntersections;
+	numInteriorIntersections += other.numInteriorIntersections;
+	numProperIntersections += other.numProperIntersections;
+	numTests += other.numTests;
+}
+
+/*protected*/
+void
+IntersectionAdder::addIntersections(NodedSegmentString* ss, int segIndex,
+		int geomIndex)
+{
+	ss->addIntersections(&li, segIndex, geomIndex);
+}
+
 } // namespace geos.noding
 } // namespace geos
 
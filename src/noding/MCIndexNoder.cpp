@@ -19,9 +19,13 @@
 
 #include <geos/noding/MCIndexNoder.h>
 #include <geos/noding/SegmentIntersector.h>
+#include <geos/noding/IntersectionAdder.h>
 #include <geos/noding/NodedSegmentString.h>
 #include <geos/index/chain/MonotoneChain.h> 
 #include <geos/index/chain/MonotoneChainBuilder.h> 
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/util/TaskRunner.h>
 
 #include <cassert>
 #include <functional>
@@ -41,6 +45,144 @@ using namespace geos::index::chain;
 namespace geos {
 namespace noding { // geos.noding
 
+namespace {
+
+/// Number of query chains in a block of the parallel overlap search
+const std::size_t CHAIN_BLOCK_SIZE = 64;
+
+/*
+ * An IntersectionAdder with its own LineIntersector, buffering the
+ * nodes it finds instead of adding them to the segment strings, so
+ * that several of them can run concurrently.
+ */
+class BufferedIntersectionAdder : public IntersectionAdder
+{
+public:
+
+	// the base only keeps a reference to bufferLi, which is
+	// initialised before any use
+	BufferedIntersectionAdder(const geom::PrecisionModel* pm)
+		:
+		IntersectionAdder(bufferLi),
+		bufferLi(pm)
+	{}
+
+	/// Adds the buffered nodes to their segment strings, in order
+	void addNodes() const
+	{
+		for (std::size_t i=0, n=nodes.size(); i<n; ++i)
+		{
+			const Node& node = nodes[i];
+			node.ss->addIntersection(node.pt, node.segIndex);
+		}
+	}
+
+protected:
+
+	void addIntersections(NodedSegmentString* ss, int segIndex,
+	                      int /*geomIndex*/)
+	{
+		for (int i=0, n=bufferLi.getIntersectionNum(); i<n; ++i)
+		{
+			nodes.push_back(Node(ss, bufferLi.getIntersection(i),
+			                     segIndex));
+		}
+	}
+
+private:
+
+	struct Node {
+		Node(NodedSegmentString* ss, const geom::Coordinate& pt,
+		     int segIndex)
+			: ss(ss), pt(pt), segIndex(segIndex)
+		{}
+		NodedSegmentString* ss;
+		geom::Coordinate pt;
+		int segIndex;
+	};
+
+	algorithm::LineIntersector bufferLi;
+	std::vector<Node> nodes;
+};
+
+} // anonymous namespace
+
+/*
+ * Searches the overlaps of contiguous blocks of CHAIN_BLOCK_SIZE
+ * query chains, each block with its own BufferedIntersectionAdder.
+ * Merging the blocks in order adds the nodes in the same order as
+ * a sequential search.
+ */
+class MCIndexNoder::ChainBlockTask : public util::TaskRunner::Task
+{
+public:
+	ChainBlockTask(MCIndexNoder& noder, const geom::PrecisionModel* pm)
+		:
+		noder(noder),
+		pm(pm),
+		adders((noder.monoChains.size() + CHAIN_BLOCK_SIZE - 1) /
+		       CHAIN_BLOCK_SIZE, 0),
+		overlaps(adders.size(), 0)
+	{}
+
+	~ChainBlockTask()
+	{
+		for (std::size_t i=0, n=adders.size(); i<n; ++i)
+			delete adders[i];
+	}
+
+	std::size_t getNumBlocks() const { return adders.size(); }
+
+	void run(std::size_t block)
+	{
+		BufferedIntersectionAdder* adder = new BufferedIntersectionAdder(pm);
+		adders[block] = adder;
+		SegmentOverlapAction overlapAction(*adder);
+
+		std::size_t end = (std::min)(noder.monoChains.size(),
+		                             (block + 1) * CHAIN_BLOCK_SIZE);
+		vector<void*> overlapChains;
+		for (std::size_t i=block*CHAIN_BLOCK_SIZE; i<end; ++i)
+		{
+			MonotoneChain* queryChain = noder.monoChains[i];
+			overlapChains.clear();
+			noder.index.query(&(queryChain->getEnvelope()),
+			                  overlapChains);
+			for (std::size_t j=0, n=overlapChains.size(); j<n; ++j)
+			{
+				MonotoneChain* testChain =
+					static_cast<MonotoneChain*>(overlapChains[j]);
+				if (testChain->getId() > queryChain->getId()) {
+					queryChain->computeOverlaps(testChain,
+							&overlapAction);
+					++overlaps[block];
+				}
+			}
+		}
+	}
+
+	/// Adds the nodes and counts of all blocks, in block order
+	void merge(IntersectionAdder& target, int& nOverlaps) const
+	{
+		for (std::size_t i=0, n=adders.size(); i<n; ++i)
+		{
+			adders[i]->addNodes();
+			target.addCounts(*adders[i]);
+			nOverlaps += overlaps[i];
+		}
+	}
+
+private:
+	MCIndexNoder& noder;
+	const geom::PrecisionModel* pm;
+	std::vector<BufferedIntersectionAdder*> adders;
+	std::vector<int> overlaps;
+
+	// Declare type as noncopyable
+	ChainBlockTask(const ChainBlockTask& other);
+	ChainBlockTask& operator=(const ChainBlockTask& rhs);
+};
+
 /*public*/
 void
 MCIndexNoder::computeNodes(SegmentString::NonConstVect* inputSegStrings)
@@ -61,6 +203,18 @@ MCIndexNoder::intersectChains()
 {
 	assert(segInt);
 
+	IntersectionAdder* adder = dynamic_cast<IntersectionAdder*>(segInt);
+	if ( adder && numThreads != 1 &&
+	     monoChains.size() >= 2 * CHAIN_BLOCK_SIZE )
+	{
+		util::TaskRunner runner(numThreads);
+		if ( runner.getNumThreads() > 1 )
+		{
+			intersectChains(*adder, runner.getNumThreads());
+			return;
+		}
+	}
+
 	SegmentOverlapAction overlapAction(*segInt);
 
 	for (vector<MonotoneChain*>::iterator
@@ -99,6 +253,20 @@ MCIndexNoder::intersectChains()
 	}
 }
 
+/*private*/
+void
+MCIndexNoder::intersectChains(IntersectionAdder& adder, unsigned int threads)
+{
+	// the index must not be built lazily by the concurrent queries
+	index.build();
+
+	ChainBlockTask task(*this,
+		adder.getLineIntersector().getPrecisionModel());
+	util::TaskRunner runner(threads);
+	runner.run(task, task.getNumBlocks());
+	task.merge(adder, nOverlaps);
+}
+
 /*private*/
 void
 MCIndexNoder::add(SegmentString* segStr)
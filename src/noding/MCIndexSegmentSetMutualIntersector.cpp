@@ -24,7 +24,7 @@
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/chain/MonotoneChainBuilder.h>
 #include <geos/index/chain/MonotoneChainOverlapAction.h>
-#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/PackedSTRtree.h>
 // std
 #include <cstddef>
 
@@ -52,6 +52,32 @@ MCIndexSegmentSetMutualIntersector::addToIndex(SegmentString* segStr)
     }
 }
 
+/*private*/
+void 
+MCIndexSegmentSetMutualIntersector::intersectChains(const MonoChains& chains,
+                                                    SegmentIntersector& si) const
+{
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction( si);
+
+    std::vector<void*> overlapChains;
+    for (MonoChains::size_type i = 0, ni = chains.size(); i < ni; ++i)
+    {
+        MonotoneChain * queryChain = chains[i];
+
+        overlapChains.clear();
+        index->query( &(queryChain->getEnvelope()), overlapChains);
+
+        for (std::size_t j = 0, nj = overlapChains.size(); j < nj; j++)
+        {
+            MonotoneChain * testChain = (MonotoneChain *)(overlapChains[j]);
+
+            queryChain->computeOverlaps( testChain, &overlapAction);
+            if (si.isDone()) 
+                return;
+        }
+    }
+}
+
 /*private*/
 void 
 MCIndexSegmentSetMutualIntersector::intersectChains()
@@ -98,7 +124,7 @@ MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
 /* public */
 MCIndexSegmentSetMutualIntersector::MCIndexSegmentSetMutualIntersector() 
 :	monoChains(),
-index(new geos::index::strtree::STRtree()),
+index(new geos::index::strtree::PackedSTRtree()),
 indexCounter(0),
 processCounter(0),
 nOverlaps(0)
@@ -133,6 +159,9 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
         SegmentString* ss = const_cast<SegmentString*>(css);
         addToIndex(ss);
     }
+
+    // so that queries only read the index
+    index->build();
 }
 
 /*public*/
@@ -157,6 +186,26 @@ MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect * segString
     intersectChains();
 }
 
+/*public*/
+void 
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect * segStrings,
+                                            SegmentIntersector& si) const
+{
+    MonoChains chains;
+    for (SegmentString::ConstVect::size_type i = 0, n = segStrings->size(); i < n; i++)
+    {
+        SegmentString * seg = (SegmentString *)((*segStrings)[i]);
+        MonotoneChainBuilder::getChains(seg->getCoordinates(), seg, chains);
+    }
+
+    intersectChains(chains, si);
+
+    for (MonoChains::iterator i = chains.begin(), e = chains.end(); i != e; ++i)
+    {
+        delete *i;
+    }
+}
+
 
 /* public */
 void 
@@ -24,6 +24,7 @@
 #include <geos/geomgraph/GeometryGraph.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/Arena.h>
 
 #include <cassert>
 
@@ -53,6 +54,7 @@ GeometryGraphOperation::GeometryGraphOperation(const Geometry *g0,
 	else
 		setComputationPrecision(pm1);
 
+	util::Arena::Scope scope(arena);
 	arg[0]=new GeometryGraph(0, g0,
 		algorithm::BoundaryNodeRule::OGC_SFS_BOUNDARY_RULE);
 	arg[1]=new GeometryGraph(1, g1,
@@ -77,6 +79,7 @@ GeometryGraphOperation::GeometryGraphOperation(const Geometry *g0,
 	else
 		setComputationPrecision(pm1);
 
+	util::Arena::Scope scope(arena);
 	arg[0]=new GeometryGraph(0, g0, boundaryNodeRule);
 	arg[1]=new GeometryGraph(1, g1, boundaryNodeRule);
 }
@@ -90,6 +93,7 @@ GeometryGraphOperation::GeometryGraphOperation(const Geometry *g0):
 
 	setComputationPrecision(pm0);
 
+	util::Arena::Scope scope(arena);
 	arg[0]=new GeometryGraph(0, g0);
 }
 
@@ -100,6 +104,17 @@ GeometryGraphOperation::getArgGeometry(unsigned int i) const
 	return arg[i]->getGeometry();
 }
 
+/*public*/
+void
+GeometryGraphOperation::setEdgeSetIntersectorType(
+		geomgraph::index::EdgeSetIntersector::Type type)
+{
+	for(unsigned int i=0; i<arg.size(); ++i)
+	{
+		arg[i]->setEdgeSetIntersectorType(type);
+	}
+}
+
 /*protected*/
 void
 GeometryGraphOperation::setComputationPrecision(const PrecisionModel* pm)
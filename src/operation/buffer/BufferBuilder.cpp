@@ -375,6 +375,8 @@ BufferBuilder::buffer(const Geometry *g, double distance)
 	// factory must be the same as the one used by the input
 	geomFact=g->getFactory();
 
+	util::Arena::Scope scope(arena);
+
 	OffsetCurveBuilder curveBuilder(precisionModel, bufParams);
 	OffsetCurveSetBuilder curveSetBuilder(*g, distance, curveBuilder);
 
@@ -470,6 +472,7 @@ BufferBuilder::getNoder(const PrecisionModel* pm)
 	}
 
 	MCIndexNoder* noder = new MCIndexNoder(intersectionAdder);
+	noder->setNumThreads(bufParams.getNumThreads());
 
 #if 0
 	/* CoordinateArraySequence.cpp:84:
@@ -42,7 +42,8 @@ BufferParameters::BufferParameters()
     endCapStyle(CAP_ROUND),
     joinStyle(JOIN_ROUND),
     mitreLimit(DEFAULT_MITRE_LIMIT),
-    _isSingleSided(false)
+    _isSingleSided(false),
+    numThreads(1)
 {}
 
 // public
@@ -52,7 +53,8 @@ BufferParameters::BufferParameters(int quadrantSegments)
 	endCapStyle(CAP_ROUND),
 	joinStyle(JOIN_ROUND),
 	mitreLimit(DEFAULT_MITRE_LIMIT),
-	_isSingleSided(false)
+	_isSingleSided(false),
+	numThreads(1)
 {
 	setQuadrantSegments(quadrantSegments);
 }
@@ -65,7 +67,8 @@ BufferParameters::BufferParameters(int quadrantSegments,
 	endCapStyle(CAP_ROUND),
 	joinStyle(JOIN_ROUND),
 	mitreLimit(DEFAULT_MITRE_LIMIT),
-	_isSingleSided(false)
+	_isSingleSided(false),
+	numThreads(1)
 {
 	setQuadrantSegments(quadrantSegments);
 	setEndCapStyle(endCapStyle);
@@ -81,7 +84,8 @@ BufferParameters::BufferParameters(int quadrantSegments,
 	endCapStyle(CAP_ROUND),
 	joinStyle(JOIN_ROUND),
 	mitreLimit(DEFAULT_MITRE_LIMIT),
-	_isSingleSided(false)
+	_isSingleSided(false),
+	numThreads(1)
 {
 	setQuadrantSegments(quadrantSegments);
 	setEndCapStyle(endCapStyle);
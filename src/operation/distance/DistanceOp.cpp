@@ -22,6 +22,7 @@
 #include <geos/operation/distance/DistanceOp.h>
 #include <geos/operation/distance/GeometryLocation.h>
 #include <geos/operation/distance/ConnectedElementLocationFilter.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/algorithm/PointLocator.h> 
 #include <geos/algorithm/CGAlgorithms.h> 
 #include <geos/geom/Coordinate.h>
@@ -55,6 +56,17 @@ namespace distance { // geos.operation.distance
 using namespace geom;
 //using namespace geom::util;
 
+namespace { // anonymous
+
+/*
+ * Number of vertex pairs above which the facet distance is computed
+ * with an IndexedFacetDistance: building the indexes does not pay off
+ * for smaller inputs.
+ */
+const double INDEXED_FACET_DISTANCE_MIN_PAIRS = 100;
+
+} // anonymous namespace
+
 /*public static (deprecated)*/
 double
 DistanceOp::distance(const Geometry *g0, const Geometry *g1)
@@ -90,6 +102,7 @@ DistanceOp::nearestPoints(const Geometry *g0, const Geometry *g1)
 DistanceOp::DistanceOp(const Geometry *g0, const Geometry *g1):
 	geom(2),
 	terminateDistance(0.0),
+	indexed(true),
 	minDistanceLocation(0),
 	minDistance(DoubleMax)
 {
@@ -100,6 +113,7 @@ DistanceOp::DistanceOp(const Geometry *g0, const Geometry *g1):
 DistanceOp::DistanceOp(const Geometry& g0, const Geometry& g1):
 	geom(2),
 	terminateDistance(0.0),
+	indexed(true),
 	minDistanceLocation(0),
 	minDistance(DoubleMax)
 {
@@ -111,6 +125,7 @@ DistanceOp::DistanceOp(const Geometry& g0, const Geometry& g1, double tdist)
 	:
 	geom(2),
 	terminateDistance(tdist),
+	indexed(true),
 	minDistanceLocation(0),
 	minDistance(DoubleMax)
 {
@@ -383,6 +398,14 @@ DistanceOp::computeFacetDistance()
 	using geom::util::LinearComponentExtracter;
 	using geom::util::PointExtracter;
 
+	if ( indexed &&
+	     double(geom[0]->getNumPoints()) * geom[1]->getNumPoints() >=
+	     INDEXED_FACET_DISTANCE_MIN_PAIRS )
+	{
+		computeFacetDistanceIndexed();
+		return;
+	}
+
 	vector<GeometryLocation*> locGeom(2);
 
 	/**
@@ -456,6 +479,26 @@ DistanceOp::computeFacetDistance()
 #endif
 }
 
+/*private*/
+void
+DistanceOp::computeFacetDistanceIndexed()
+{
+	// the larger geometry is indexed once, the other one per query
+	bool flip = geom[1]->getNumPoints() > geom[0]->getNumPoints();
+	const Geometry* target = flip ? geom[1] : geom[0];
+	const Geometry* test = flip ? geom[0] : geom[1];
+
+	IndexedFacetDistance facetDistance(target);
+	vector<GeometryLocation*> locGeom(2);
+	double dist;
+	if ( facetDistance.nearestLocations(test, locGeom, dist,
+	                                    minDistance, terminateDistance) )
+	{
+		minDistance = dist;
+		updateMinDistance(locGeom, flip);
+	}
+}
+
 /*private*/
 void
 DistanceOp::computeMinDistanceLines(
@@ -622,6 +665,13 @@ DistanceOp::isWithinDistance(const geom::Geometry& g0,
 	                     const geom::Geometry& g1,
 	                     double distance)
 {
+	// as distance() does
+	if ( g0.isEmpty() || g1.isEmpty() ) return 0.0 <= distance;
+
+	const Envelope* env0 = g0.getEnvelopeInternal();
+	const Envelope* env1 = g1.getEnvelopeInternal();
+	if ( env0->distance(env1) > distance ) return false;
+
 	DistanceOp distOp(g0, g1, distance);
 	return distOp.distance() <= distance;
 }
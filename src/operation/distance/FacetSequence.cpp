@@ -0,0 +1,246 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: operation/distance/FacetSequence.java (JTS-1.13)
+ *
+ **********************************************************************/
+
+#include <geos/operation/distance/FacetSequence.h>
+#include <geos/operation/distance/GeometryLocation.h>
+#include <geos/algorithm/CGAlgorithms.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/platform.h> // for DoubleInfinity
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::algorithm::CGAlgorithms;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace distance { // geos.operation.distance
+
+/*public*/
+FacetSequence::FacetSequence(const CoordinateSequence* pts,
+		std::size_t start, std::size_t end)
+	:
+	geom(0),
+	pts(pts),
+	start(start),
+	end(end)
+{
+	assert(start < end);
+	for (std::size_t i=start; i<end; ++i)
+		env.expandToInclude(pts->getAt(i));
+}
+
+/*public*/
+FacetSequence::FacetSequence(const Geometry* geom,
+		const CoordinateSequence* pts, std::size_t start, std::size_t end)
+	:
+	geom(geom),
+	pts(pts),
+	start(start),
+	end(end)
+{
+	assert(start < end);
+	for (std::size_t i=start; i<end; ++i)
+		env.expandToInclude(pts->getAt(i));
+}
+
+/*public*/
+double
+FacetSequence::distance(const FacetSequence& facetSeq) const
+{
+	bool isPoint = this->isPoint();
+	bool isPointOther = facetSeq.isPoint();
+
+	if ( isPoint && isPointOther )
+	{
+		return pts->getAt(start).distance(
+			facetSeq.pts->getAt(facetSeq.start));
+	}
+	else if ( isPoint )
+	{
+		return facetSeq.computePointLineDistance(*this);
+	}
+	else if ( isPointOther )
+	{
+		return computePointLineDistance(facetSeq);
+	}
+	return computeLineLineDistance(facetSeq);
+}
+
+/*public*/
+double
+FacetSequence::nearestLocations(const FacetSequence& facetSeq,
+		std::vector<GeometryLocation*>& locs) const
+{
+	assert(geom && facetSeq.geom);
+	locs.resize(2);
+
+	const FacetSequence& other = facetSeq;
+	if ( isPoint() && other.isPoint() )
+	{
+		const Coordinate& pt = pts->getAt(start);
+		const Coordinate& otherPt = other.pts->getAt(other.start);
+		locs[0] = new GeometryLocation(geom, start, pt);
+		locs[1] = new GeometryLocation(other.geom, other.start, otherPt);
+		return pt.distance(otherPt);
+	}
+	else if ( isPoint() )
+	{
+		const Coordinate& pt = pts->getAt(start);
+		std::size_t segIndex;
+		locs[1] = other.locateNearest(pt, segIndex);
+		locs[0] = new GeometryLocation(geom, start, pt);
+		return pt.distance(locs[1]->getCoordinate());
+	}
+	else if ( other.isPoint() )
+	{
+		const Coordinate& pt = other.pts->getAt(other.start);
+		std::size_t segIndex;
+		locs[0] = locateNearest(pt, segIndex);
+		locs[1] = new GeometryLocation(other.geom, other.start, pt);
+		return pt.distance(locs[0]->getCoordinate());
+	}
+
+	std::size_t segIndex, otherSegIndex;
+	double dist = findNearestSegments(other, segIndex, otherSegIndex);
+
+	LineSegment seg(pts->getAt(segIndex), pts->getAt(segIndex + 1));
+	LineSegment otherSeg(other.pts->getAt(otherSegIndex),
+	                     other.pts->getAt(otherSegIndex + 1));
+	std::auto_ptr<CoordinateSequence> closestPts(seg.closestPoints(otherSeg));
+	locs[0] = new GeometryLocation(geom, segIndex, closestPts->getAt(0));
+	locs[1] = new GeometryLocation(other.geom, otherSegIndex,
+	                               closestPts->getAt(1));
+	return dist;
+}
+
+/*private*/
+double
+FacetSequence::findNearestSegment(const Coordinate& pt,
+		std::size_t& segIndex) const
+{
+	double minDistance = DoubleInfinity;
+	segIndex = start;
+
+	for (std::size_t i=start; i<end-1; ++i)
+	{
+		double dist = CGAlgorithms::distancePointLine(pt,
+			pts->getAt(i), pts->getAt(i+1));
+		if ( dist < minDistance )
+		{
+			minDistance = dist;
+			segIndex = i;
+			if ( dist == 0.0 ) break;
+		}
+	}
+	return minDistance;
+}
+
+/*private*/
+double
+FacetSequence::findNearestSegments(const FacetSequence& facetSeq,
+		std::size_t& segIndex, std::size_t& otherSegIndex) const
+{
+	double minDistance = DoubleInfinity;
+	segIndex = start;
+	otherSegIndex = facetSeq.start;
+
+	for (std::size_t i=start; i<end-1; ++i)
+	{
+		const Coordinate& p0 = pts->getAt(i);
+		const Coordinate& p1 = pts->getAt(i+1);
+
+		for (std::size_t j=facetSeq.start; j<facetSeq.end-1; ++j)
+		{
+			double dist = CGAlgorithms::distanceLineLine(p0, p1,
+				facetSeq.pts->getAt(j), facetSeq.pts->getAt(j+1));
+			if ( dist < minDistance )
+			{
+				minDistance = dist;
+				segIndex = i;
+				otherSegIndex = j;
+				if ( dist == 0.0 ) return 0.0;
+			}
+		}
+	}
+	return minDistance;
+}
+
+/*private*/
+GeometryLocation*
+FacetSequence::locateNearest(const Coordinate& pt, std::size_t& segIndex) const
+{
+	findNearestSegment(pt, segIndex);
+
+	LineSegment seg(pts->getAt(segIndex), pts->getAt(segIndex + 1));
+	Coordinate closestPt;
+	seg.closestPoint(pt, closestPt);
+	return new GeometryLocation(geom, segIndex, closestPt);
+}
+
+/*private*/
+double
+FacetSequence::computePointLineDistance(const FacetSequence& facetSeq) const
+{
+	const Coordinate& pt = facetSeq.pts->getAt(facetSeq.start);
+	double minDistance = DoubleInfinity;
+
+	for (std::size_t i=start; i<end-1; ++i)
+	{
+		double dist = CGAlgorithms::distancePointLine(pt,
+			pts->getAt(i), pts->getAt(i+1));
+		if ( dist < minDistance )
+		{
+			if ( dist == 0.0 ) return 0.0;
+			minDistance = dist;
+		}
+	}
+	return minDistance;
+}
+
+/*private*/
+double
+FacetSequence::computeLineLineDistance(const FacetSequence& facetSeq) const
+{
+	double minDistance = DoubleInfinity;
+
+	for (std::size_t i=start; i<end-1; ++i)
+	{
+		const Coordinate& p0 = pts->getAt(i);
+		const Coordinate& p1 = pts->getAt(i+1);
+
+		for (std::size_t j=facetSeq.start; j<facetSeq.end-1; ++j)
+		{
+			double dist = CGAlgorithms::distanceLineLine(p0, p1,
+				facetSeq.pts->getAt(j), facetSeq.pts->getAt(j+1));
+			if ( dist < minDistance )
+			{
+				if ( dist == 0.0 ) return 0.0;
+				minDistance = dist;
+			}
+		}
+	}
+	return minDistance;
+}
+
+} // namespace geos.operation.distance
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,216 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: operation/distance/IndexedFacetDistance.java (JTS-1.13)
+ *
+ **********************************************************************/
+
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/operation/distance/FacetSequence.h>
+#include <geos/operation/distance/GeometryLocation.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/platform.h> // for DoubleInfinity
+
+#include <vector>
+
+using namespace geos::geom;
+using geos::index::strtree::PackedSTRtree;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace distance { // geos.operation.distance
+
+namespace { // anonymous
+
+/// Number of segments grouped in a FacetSequence
+const std::size_t FACET_SEQUENCE_SIZE = 6;
+
+/// Collects the FacetSequences of the lines and points of a geometry
+class FacetSequenceFilter : public GeometryComponentFilter
+{
+public:
+	FacetSequenceFilter(std::vector<FacetSequence>& sections)
+		: sections(sections)
+	{}
+
+	void filter_ro(const Geometry* g)
+	{
+		const CoordinateSequence* pts = 0;
+		if ( const LineString* ls = dynamic_cast<const LineString*>(g) )
+			pts = ls->getCoordinatesRO();
+		else if ( const Point* pt = dynamic_cast<const Point*>(g) )
+			pts = pt->getCoordinatesRO();
+		else
+			return;
+
+		std::size_t size = pts->size();
+		std::size_t i = 0;
+		while ( i < size )
+		{
+			std::size_t end = i + FACET_SEQUENCE_SIZE + 1;
+			// if only one point remains after this section,
+			// include it in this section
+			if ( end >= size - 1 ) end = size;
+			sections.push_back(FacetSequence(g, pts, i, end));
+			if ( end == size ) break;
+			i += FACET_SEQUENCE_SIZE;
+		}
+	}
+
+private:
+	std::vector<FacetSequence>& sections;
+};
+
+class FacetSequenceDistance : public index::strtree::ItemDistance
+{
+public:
+	double distance(const void* item1, const void* item2)
+	{
+		return static_cast<const FacetSequence*>(item1)->distance(
+			*static_cast<const FacetSequence*>(item2));
+	}
+};
+
+} // anonymous namespace
+
+/*public static*/
+double
+IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
+{
+	IndexedFacetDistance dist(g1);
+	return dist.getDistance(g2);
+}
+
+/*public static*/
+void
+IndexedFacetDistance::computeFacetSequences(const Geometry& g,
+		std::vector<FacetSequence>& sections)
+{
+	FacetSequenceFilter filter(sections);
+	g.apply_ro(&filter);
+}
+
+/*private static*/
+void
+IndexedFacetDistance::insertFacetSequences(std::vector<FacetSequence>& sections,
+		PackedSTRtree& tree)
+{
+	for (std::size_t i=0, n=sections.size(); i<n; ++i)
+		tree.insert(sections[i].getEnvelope(), &sections[i]);
+	if ( ! tree.isEmpty() ) tree.build();
+}
+
+/*public*/
+IndexedFacetDistance::IndexedFacetDistance(const Geometry* g)
+{
+	computeFacetSequences(*g, facets);
+	insertFacetSequences(facets, tree);
+}
+
+IndexedFacetDistance::~IndexedFacetDistance()
+{
+}
+
+/*public*/
+double
+IndexedFacetDistance::getDistance(const Geometry* g) const
+{
+	double dist = 0.0;
+	distance(g, DoubleInfinity, 0.0, dist);
+	return dist;
+}
+
+/*public*/
+bool
+IndexedFacetDistance::isWithinDistance(const Geometry* g,
+		double maxDistance) const
+{
+	double dist = 0.0;
+	return distance(g, maxDistance, maxDistance, dist);
+}
+
+/*public*/
+bool
+IndexedFacetDistance::nearestLocations(const Geometry* g,
+		std::vector<GeometryLocation*>& locs, double& dist,
+		double maxDistance, double stopDistance) const
+{
+	std::vector<FacetSequence> sections;
+	const FacetSequence* target;
+	const FacetSequence* test;
+	if ( ! nearestFacets(g, sections, maxDistance, stopDistance,
+	                     target, test, dist) )
+	{
+		return false;
+	}
+	if ( ! target ) return false;
+
+	dist = target->nearestLocations(*test, locs);
+	return true;
+}
+
+/*private*/
+bool
+IndexedFacetDistance::distance(const Geometry* g, double maxDistance,
+		double stopDistance, double& dist) const
+{
+	std::vector<FacetSequence> sections;
+	const FacetSequence* target;
+	const FacetSequence* test;
+	return nearestFacets(g, sections, maxDistance, stopDistance,
+	                     target, test, dist);
+}
+
+/*private*/
+bool
+IndexedFacetDistance::nearestFacets(const Geometry* g,
+		std::vector<FacetSequence>& sections,
+		double maxDistance, double stopDistance,
+		const FacetSequence*& target, const FacetSequence*& test,
+		double& dist) const
+{
+	computeFacetSequences(*g, sections);
+
+	PackedSTRtree queryTree;
+	insertFacetSequences(sections, queryTree);
+
+	target = 0;
+	test = 0;
+	if ( tree.isEmpty() || queryTree.isEmpty() )
+	{
+		dist = 0.0;
+		return true;
+	}
+
+	FacetSequenceDistance itemDist;
+	void* item1;
+	void* item2;
+	if ( ! queryTree.nearestNeighbour(tree, itemDist, item1, item2,
+	                                  dist, maxDistance, stopDistance) )
+	{
+		return false;
+	}
+	test = static_cast<const FacetSequence*>(item1);
+	target = static_cast<const FacetSequence*>(item2);
+	return true;
+}
+
+} // namespace geos.operation.distance
+} // namespace geos.operation
+} // namespace geos
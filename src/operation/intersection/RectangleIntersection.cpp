@@ -0,0 +1,709 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/algorithm/CGAlgorithms.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/platform.h> // for ISNAN
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace geos::geom;
+using geos::algorithm::CGAlgorithms;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace intersection { // geos.operation.intersection
+
+namespace {
+
+// A part of a ring inside the rectangle, from where it enters the
+// rectangle to where it leaves it
+struct Piece {
+	vector<Coordinate> pts;
+	size_t ring;
+	double startPos;
+	double endPos;
+};
+
+// How a ring lies with respect to the rectangle
+enum RingLocation {
+	RING_INSIDE,
+	RING_OUTSIDE,
+	RING_CROSSING
+};
+
+// Distance going counter clockwise around the rectangle from
+// perimeter position p0 to p1, all around if they are the same
+double
+perimeterDistance(double p0, double p1)
+{
+	return p1 > p0 ? p1 - p0 : p1 + 4 - p0;
+}
+
+// Perimeter positions closer than this, relative to the side lengths,
+// may be in the wrong order after rounding the crossing points
+const double POSITION_TOLERANCE = 1e-10;
+
+// A piece end or start on the rectangle boundary
+struct BoundaryEvent {
+	double pos;
+	const Coordinate* pt;
+	size_t piece;
+	bool isStart;
+	bool operator<(const BoundaryEvent& other) const
+	{
+		return pos < other.pos;
+	}
+};
+
+// Copies a ring, reversed if needed to have the wanted orientation
+void
+orientedCopy(const CoordinateSequence& ring, bool ccw,
+		vector<Coordinate>& pts)
+{
+	ring.toVector(pts);
+	if (CGAlgorithms::isCCW(&ring) != ccw)
+		reverse(pts.begin(), pts.end());
+}
+
+// @return true if p is in ring or on its boundary
+bool
+isInRing(const Coordinate& p, const vector<Coordinate>& ring)
+{
+	vector<const Coordinate*> pts(ring.size());
+	for (size_t i=0, n=ring.size(); i<n; ++i) pts[i] = &ring[i];
+	return CGAlgorithms::isPointInRing(p, pts);
+}
+
+} // anonymous namespace
+
+RectangleIntersection::RectangleIntersection(const Envelope& nRect)
+	:
+	rect(nRect)
+{
+}
+
+/*public static*/
+auto_ptr<Geometry>
+RectangleIntersection::clip(const Geometry& geom, const Envelope& rect)
+{
+	RectangleIntersection ri(rect);
+	return ri.clip(geom);
+}
+
+/*public*/
+auto_ptr<Geometry>
+RectangleIntersection::clip(const Geometry& geom) const
+{
+	const GeometryFactory* factory = geom.getFactory();
+	if (rect.isNull() || geom.isEmpty())
+		return auto_ptr<Geometry>(factory->createGeometryCollection());
+
+	const Envelope* env = geom.getEnvelopeInternal();
+	if (!rect.intersects(env))
+		return auto_ptr<Geometry>(factory->createGeometryCollection());
+	if (rect.covers(env))
+		return auto_ptr<Geometry>(geom.clone());
+
+	vector<Geometry*>* parts = new vector<Geometry*>();
+	try {
+		addClipped(geom, *parts);
+	}
+	catch (...) {
+		for (size_t i=0, n=parts->size(); i<n; ++i) delete (*parts)[i];
+		delete parts;
+		throw;
+	}
+	return auto_ptr<Geometry>(factory->buildGeometry(parts));
+}
+
+/*private*/
+void
+RectangleIntersection::addClipped(const Geometry& geom,
+		vector<Geometry*>& parts) const
+{
+	if (geom.isEmpty()) return;
+
+	const Envelope* env = geom.getEnvelopeInternal();
+	if (!rect.intersects(env)) return;
+
+	if (const GeometryCollection* gc =
+			dynamic_cast<const GeometryCollection*>(&geom))
+	{
+		for (size_t i=0, n=gc->getNumGeometries(); i<n; ++i)
+			addClipped(*gc->getGeometryN(i), parts);
+		return;
+	}
+
+	// a degenerate rectangle only has a boundary
+	if (rect.getWidth() == 0 || rect.getHeight() == 0)
+	{
+		addOverlay(geom, parts);
+		return;
+	}
+
+	if (rect.covers(env))
+	{
+		parts.push_back(geom.clone());
+		return;
+	}
+
+	if (const LineString* line = dynamic_cast<const LineString*>(&geom))
+	{
+		if (!clipLine(*line, parts)) addOverlay(geom, parts);
+	}
+	else if (const Polygon* poly = dynamic_cast<const Polygon*>(&geom))
+	{
+		if (!clipPolygon(*poly, parts)) addOverlay(geom, parts);
+	}
+	// a point in the envelope is covered by the rectangle,
+	// so only lines and polygons can get here
+	else
+	{
+		addOverlay(geom, parts);
+	}
+}
+
+/*private*/
+void
+RectangleIntersection::addOverlay(const Geometry& geom,
+		vector<Geometry*>& parts) const
+{
+	const GeometryFactory* factory = geom.getFactory();
+	auto_ptr<Geometry> rectGeom(factory->toGeometry(&rect));
+	auto_ptr<Geometry> result(geom.intersection(rectGeom.get()));
+	for (size_t i=0, n=result->getNumGeometries(); i<n; ++i)
+	{
+		const Geometry* g = result->getGeometryN(i);
+		if (!g->isEmpty()) parts.push_back(g->clone());
+	}
+}
+
+/*private*/
+bool
+RectangleIntersection::clipLine(const LineString& line,
+		vector<Geometry*>& parts) const
+{
+	const CoordinateSequence* seq = line.getCoordinatesRO();
+	const size_t npts = seq->getSize();
+
+	// the parts of the line in the rectangle, split where it leaves
+	vector< vector<Coordinate> > pieces;
+	Coordinate a, b;
+	for (size_t i=1; i<npts; ++i)
+	{
+		const Coordinate& p0 = seq->getAt(i-1);
+		const Coordinate& p1 = seq->getAt(i);
+		if (!clipSegment(p0, p1, a, b)) continue;
+
+		if (pieces.empty() || !pieces.back().back().equals2D(a))
+			pieces.push_back(vector<Coordinate>(1, a));
+		if (!b.equals2D(a)) pieces.back().push_back(b);
+	}
+
+	// a closed line starting on the boundary
+	if (pieces.size() > 1 && line.isClosed())
+	{
+		if (pieces.front().size() == 1 &&
+				pieces.front().front().equals2D(pieces.back().back()))
+			pieces.erase(pieces.begin());
+		else if (pieces.back().size() == 1 &&
+				pieces.back().front().equals2D(pieces.front().front()))
+			pieces.pop_back();
+	}
+
+	// touching the boundary from outside leaves a point, which is
+	// dropped if on another part of the line
+	for (size_t i=0, n=pieces.size(); i<n; ++i)
+		if (pieces[i].size() < 2) return false;
+
+	const GeometryFactory* factory = line.getFactory();
+	const CoordinateSequenceFactory* csf =
+		factory->getCoordinateSequenceFactory();
+	size_t dim = seq->getDimension();
+	for (size_t i=0, n=pieces.size(); i<n; ++i)
+	{
+		vector<Coordinate>* pts = new vector<Coordinate>();
+		pts->swap(pieces[i]);
+		parts.push_back(factory->createLineString(csf->create(pts, dim)));
+	}
+	return true;
+}
+
+/*private*/
+bool
+RectangleIntersection::clipPolygon(const Polygon& poly,
+		vector<Geometry*>& parts) const
+{
+	// Shell counter clockwise and holes clockwise, so that the
+	// polygon interior is on the left of all pieces and, inside the
+	// rectangle, the rectangle boundary is followed counter clockwise
+	// from where a piece leaves to where the next one enters.
+	const size_t nholes = poly.getNumInteriorRing();
+	vector< vector<Coordinate> > rings(nholes+1);
+	orientedCopy(*poly.getExteriorRing()->getCoordinatesRO(), true,
+			rings[0]);
+	for (size_t i=0; i<nholes; ++i)
+	{
+		orientedCopy(*poly.getInteriorRingN(i)->getCoordinatesRO(),
+				false, rings[i+1]);
+	}
+
+	vector<Piece> pieces;
+	vector<RingLocation> locations(nholes+1);
+	vector<bool> touching(nholes+1, false);
+	for (size_t r=0; r<=nholes; ++r)
+	{
+		const vector<Coordinate>& ring = rings[r];
+		const size_t n = ring.size()-1; // ring is closed
+
+		// start the walk from a vertex outside the rectangle, so
+		// that every piece has both its ends on the boundary
+		size_t start = n;
+		bool touches = false;
+		for (size_t i=0; i<n; ++i)
+		{
+			if (!rect.covers(ring[i]))
+			{
+				start = i;
+				break;
+			}
+			touches = touches || isOnBoundary(ring[i]);
+		}
+		if (start == n)
+		{
+			// a hole touching the rectangle boundary could touch
+			// the result shells in more than one point
+			if (r > 0 && touches) return false;
+			locations[r] = RING_INSIDE;
+			continue;
+		}
+
+		size_t firstPiece = pieces.size();
+		Coordinate a, b;
+		for (size_t k=0; k<n; ++k)
+		{
+			const Coordinate& p0 = ring[(start+k) % n];
+			const Coordinate& p1 = ring[(start+k+1) % n];
+			if (!clipSegment(p0, p1, a, b)) continue;
+
+			if (pieces.size() == firstPiece ||
+					!pieces.back().pts.back().equals2D(a))
+			{
+				pieces.push_back(Piece());
+				pieces.back().pts.push_back(a);
+				pieces.back().ring = r;
+			}
+			if (b.equals2D(a)) continue;
+
+			// running along a side with the interior outside
+			// leaves a line
+			if (isOnSameSide(a, b) && perimeterDistance(
+					getPerimeterPosition(a), getPerimeterPosition(b)) > 2)
+				return false;
+
+			pieces.back().pts.push_back(b);
+		}
+
+		// A piece touching the boundary from inside, with the polygon
+		// interior along the boundary on both sides, is split there
+		// into an exit and an entry, so that the boundary is followed
+		// from the exit and the result rings do not touch themselves.
+		for (size_t i=firstPiece; i<pieces.size(); ++i)
+		{
+			vector<Coordinate>& pts = pieces[i].pts;
+			for (size_t k=1; k+1<pts.size(); ++k)
+			{
+				if (isOnBoundary(pts[k]) &&
+						CGAlgorithms::orientationIndex(pts[k-1], pts[k],
+							pts[k+1]) == CGAlgorithms::CLOCKWISE)
+				{
+					Piece rest;
+					rest.ring = r;
+					rest.pts.assign(pts.begin()+k, pts.end());
+					pts.resize(k+1);
+					pieces.insert(pieces.begin()+i+1, rest);
+					break;
+				}
+			}
+		}
+
+		for (size_t i=firstPiece; i<pieces.size(); )
+		{
+			Piece& piece = pieces[i];
+			if (piece.pts.size() > 1)
+			{
+				piece.startPos = getPerimeterPosition(piece.pts.front());
+				piece.endPos = getPerimeterPosition(piece.pts.back());
+				++i;
+				continue;
+			}
+			// touching the boundary from outside leaves a point,
+			// which is in the result polygons for a hole not
+			// around the rectangle
+			if (r == 0) return false;
+			touching[r] = true;
+			pieces.erase(pieces.begin() + i);
+		}
+
+		locations[r] = pieces.size() > firstPiece ?
+				RING_CROSSING : RING_OUTSIDE;
+	}
+
+	// Rings touching each other on the boundary, or crossing it
+	// about at the same place, could not be told apart when following
+	// it. Only the exit and entry of two pieces at the same point, as
+	// left by a ring touching the boundary, are kept.
+	vector<BoundaryEvent> events(2*pieces.size());
+	for (size_t i=0, n=pieces.size(); i<n; ++i)
+	{
+		events[2*i].pos = pieces[i].startPos;
+		events[2*i].pt = &pieces[i].pts.front();
+		events[2*i].piece = i;
+		events[2*i].isStart = true;
+		events[2*i+1].pos = pieces[i].endPos;
+		events[2*i+1].pt = &pieces[i].pts.back();
+		events[2*i+1].piece = i;
+		events[2*i+1].isStart = false;
+	}
+	sort(events.begin(), events.end());
+	for (size_t i=1, n=events.size(); i<n; ++i)
+	{
+		const BoundaryEvent& e0 = events[i-1];
+		const BoundaryEvent& e1 = events[i];
+		if (e1.pos - e0.pos >= POSITION_TOLERANCE) continue;
+		if (e1.isStart == e0.isStart || e1.piece == e0.piece ||
+				!e1.pt->equals2D(*e0.pt))
+			return false;
+		if (i > 1 && e0.pos - events[i-2].pos < POSITION_TOLERANCE)
+			return false;
+	}
+	if (!events.empty() && events.front().pos + 4 - events.back().pos <
+			POSITION_TOLERANCE)
+		return false;
+
+	// shells of the result, counter clockwise
+	vector< vector<Coordinate> > shells;
+	if (locations[0] == RING_INSIDE)
+	{
+		shells.push_back(rings[0]);
+	}
+	else if (pieces.empty())
+	{
+		// the shell is outside the rectangle, which is then either
+		// inside the shell or disjoint from the polygon
+		Coordinate centre;
+		rect.centre(centre);
+		if (!isInRing(centre, rings[0]))
+			return true;
+
+		// or inside a hole
+		for (size_t r=1; r<=nholes; ++r)
+		{
+			if (locations[r] == RING_OUTSIDE && isInRing(centre, rings[r]))
+				return !touching[r];
+		}
+
+		shells.push_back(vector<Coordinate>());
+		for (int i=0; i<=4; ++i) shells.back().push_back(getCorner(i % 4));
+	}
+	else
+	{
+		// join the pieces along the rectangle boundary
+		multimap<double, size_t> starts;
+		for (size_t i=0, n=pieces.size(); i<n; ++i)
+			starts.insert(make_pair(pieces[i].startPos, i));
+
+		while (!starts.empty())
+		{
+			shells.push_back(vector<Coordinate>());
+			vector<Coordinate>& shell = shells.back();
+
+			size_t first = starts.begin()->second;
+			starts.erase(starts.begin());
+			const double firstPos = pieces[first].startPos;
+
+			size_t current = first;
+			bool severalRings = false;
+			bool joined = false;
+			for (;;)
+			{
+				const Piece& piece = pieces[current];
+				severalRings = severalRings ||
+					piece.ring != pieces[first].ring;
+				shell.insert(shell.end(), piece.pts.begin() + (joined ? 1 : 0),
+						piece.pts.end());
+
+				// an entry at the exit point, left by rings touching
+				// there, is joined directly unless the polygon is on
+				// both sides of that point along the boundary
+				const Coordinate& before = piece.pts[piece.pts.size()-2];
+				multimap<double, size_t>::iterator next =
+					starts.find(piece.endPos);
+				if (next != starts.end() &&
+						CGAlgorithms::orientationIndex(before,
+							piece.pts.back(), pieces[next->second].pts[1]) !=
+						CGAlgorithms::CLOCKWISE)
+				{
+					joined = true;
+					current = next->second;
+					starts.erase(next);
+					continue;
+				}
+				if (piece.endPos == firstPos &&
+						CGAlgorithms::orientationIndex(before,
+							piece.pts.back(), pieces[first].pts[1]) !=
+						CGAlgorithms::CLOCKWISE)
+				{
+					break;
+				}
+				joined = false;
+
+				// closest entry counter clockwise from the exit, the
+				// boundary just after the exit being in the polygon
+				double nextPos = firstPos;
+				next = starts.end();
+				if (!starts.empty())
+				{
+					next = starts.upper_bound(piece.endPos);
+					if (next == starts.end()) next = starts.begin();
+					if (perimeterDistance(piece.endPos, next->first) <
+							perimeterDistance(piece.endPos, firstPos))
+						nextPos = next->first;
+					else
+						next = starts.end();
+				}
+
+				// corners passed on the way
+				double dist = perimeterDistance(piece.endPos, nextPos);
+				for (int c=static_cast<int>(floor(piece.endPos))+1;
+						c - piece.endPos < dist; ++c)
+				{
+					shell.push_back(getCorner(c % 4));
+				}
+
+				if (next == starts.end()) break;
+				current = next->second;
+				starts.erase(next);
+			}
+			if (!shell.back().equals2D(shell.front()))
+				shell.push_back(shell.front());
+
+			// a hole touching the shell or another hole would make
+			// the shell touch itself
+			if (severalRings)
+			{
+				vector<Coordinate> pts(shell.begin(), shell.end()-1);
+				sort(pts.begin(), pts.end(), CoordinateLessThen());
+				if (adjacent_find(pts.begin(), pts.end()) != pts.end())
+					return false;
+			}
+		}
+	}
+
+	const GeometryFactory* factory = poly.getFactory();
+	const CoordinateSequenceFactory* csf =
+		factory->getCoordinateSequenceFactory();
+	size_t dim = poly.getExteriorRing()->getCoordinatesRO()->getDimension();
+
+	// holes of the result, by shell
+	vector< vector<size_t> > shellHoles(shells.size());
+	vector<Envelope> shellEnvs(shells.size());
+	for (size_t s=0, ns=shells.size(); s<ns; ++s)
+	{
+		for (size_t i=0, n=shells[s].size(); i<n; ++i)
+			shellEnvs[s].expandToInclude(shells[s][i]);
+	}
+	for (size_t r=1; r<=nholes; ++r)
+	{
+		if (locations[r] != RING_INSIDE) continue;
+
+		const Coordinate& p = rings[r][0];
+		size_t owner = shells.size();
+		for (size_t s=0, ns=shells.size(); s<ns; ++s)
+		{
+			if (!shellEnvs[s].covers(p.x, p.y)) continue;
+			if (!isInRing(p, shells[s])) continue;
+			// on the boundary of two shells
+			if (owner != shells.size()) return false;
+			owner = s;
+		}
+		if (owner == shells.size()) return false;
+		shellHoles[owner].push_back(r);
+	}
+
+	// Shells clockwise and holes counter clockwise, as built by
+	// the overlay
+	for (size_t s=0, ns=shells.size(); s<ns; ++s)
+	{
+		vector<Coordinate>* shellPts = new vector<Coordinate>(
+				shells[s].rbegin(), shells[s].rend());
+		LinearRing* shell = factory->createLinearRing(
+				csf->create(shellPts, dim));
+
+		vector<Geometry*>* holes = new vector<Geometry*>();
+		for (size_t h=0, nh=shellHoles[s].size(); h<nh; ++h)
+		{
+			const vector<Coordinate>& ring = rings[shellHoles[s][h]];
+			vector<Coordinate>* holePts = new vector<Coordinate>(
+					ring.rbegin(), ring.rend());
+			holes->push_back(factory->createLinearRing(
+					csf->create(holePts, dim)));
+		}
+		parts.push_back(factory->createPolygon(shell, holes));
+	}
+	return true;
+}
+
+/*private*/
+bool
+RectangleIntersection::isOnBoundary(const Coordinate& p) const
+{
+	if (!rect.covers(p)) return false;
+	return p.x == rect.getMinX() || p.x == rect.getMaxX() ||
+		p.y == rect.getMinY() || p.y == rect.getMaxY();
+}
+
+/*
+ * Liang-Barsky clipping. Where the segment enters or leaves the
+ * rectangle, the coordinate across the crossed side is set to the side
+ * exactly, and the other one is kept in the rectangle.
+ */
+bool
+RectangleIntersection::clipSegment(const Coordinate& p0,
+		const Coordinate& p1, Coordinate& a, Coordinate& b) const
+{
+	// most segments are away from the rectangle
+	if ((p0.x < rect.getMinX() && p1.x < rect.getMinX()) ||
+			(p0.x > rect.getMaxX() && p1.x > rect.getMaxX()) ||
+			(p0.y < rect.getMinY() && p1.y < rect.getMinY()) ||
+			(p0.y > rect.getMaxY() && p1.y > rect.getMaxY()))
+		return false;
+
+	const double dx = p1.x - p0.x;
+	const double dy = p1.y - p0.y;
+	const double p[4] = { -dx, dx, -dy, dy };
+	const double q[4] = {
+		p0.x - rect.getMinX(), rect.getMaxX() - p0.x,
+		p0.y - rect.getMinY(), rect.getMaxY() - p0.y
+	};
+
+	double t0 = 0, t1 = 1;
+	int side0 = -1, side1 = -1;
+	for (int k=0; k<4; ++k)
+	{
+		if (p[k] == 0)
+		{
+			if (q[k] < 0) return false;
+			continue;
+		}
+		double t = q[k] / p[k];
+		if (p[k] < 0)
+		{
+			if (t > t1) return false;
+			if (t > t0) { t0 = t; side0 = k; }
+		}
+		else
+		{
+			if (t < t0) return false;
+			if (t < t1) { t1 = t; side1 = k; }
+		}
+	}
+
+	a = p0;
+	b = p1;
+	if (side0 >= 0) a = interpolate(p0, p1, t0, side0);
+	if (side1 >= 0) b = interpolate(p0, p1, t1, side1);
+	return true;
+}
+
+/*private*/
+Coordinate
+RectangleIntersection::interpolate(const Coordinate& p0,
+		const Coordinate& p1, double t, int side) const
+{
+	// a segment end on the boundary
+	if (t <= 0) return p0;
+	if (t >= 1) return p1;
+
+	Coordinate c(p0.x + t * (p1.x - p0.x), p0.y + t * (p1.y - p0.y));
+	switch (side)
+	{
+		case 0: c.x = rect.getMinX(); break;
+		case 1: c.x = rect.getMaxX(); break;
+		case 2: c.y = rect.getMinY(); break;
+		default: c.y = rect.getMaxY(); break;
+	}
+	c.x = max(rect.getMinX(), min(rect.getMaxX(), c.x));
+	c.y = max(rect.getMinY(), min(rect.getMaxY(), c.y));
+
+	double z0 = p0.getZ(), z1 = p1.getZ();
+	if (!ISNAN(z0) && !ISNAN(z1)) c.setZ(z0 + t * (z1 - z0));
+	return c;
+}
+
+/*private*/
+bool
+RectangleIntersection::isOnSameSide(const Coordinate& a,
+		const Coordinate& b) const
+{
+	return (a.x == b.x && (a.x == rect.getMinX() || a.x == rect.getMaxX()))
+		|| (a.y == b.y && (a.y == rect.getMinY() || a.y == rect.getMaxY()));
+}
+
+/*private*/
+double
+RectangleIntersection::getPerimeterPosition(const Coordinate& p) const
+{
+	const double w = rect.getWidth();
+	const double h = rect.getHeight();
+	if (p.y == rect.getMinY() && p.x < rect.getMaxX())
+		return (p.x - rect.getMinX()) / w;
+	if (p.x == rect.getMaxX() && p.y < rect.getMaxY())
+		return 1 + (p.y - rect.getMinY()) / h;
+	if (p.y == rect.getMaxY() && p.x > rect.getMinX())
+		return 2 + (rect.getMaxX() - p.x) / w;
+	return 3 + (rect.getMaxY() - p.y) / h;
+}
+
+/*private*/
+Coordinate
+RectangleIntersection::getCorner(int i) const
+{
+	switch (i)
+	{
+		case 0: return Coordinate(rect.getMinX(), rect.getMinY());
+		case 1: return Coordinate(rect.getMaxX(), rect.getMinY());
+		case 2: return Coordinate(rect.getMaxX(), rect.getMaxY());
+		default: return Coordinate(rect.getMinX(), rect.getMaxY());
+	}
+}
+
+} // namespace geos.operation.intersection
+} // namespace geos.operation
+} // namespace geos
+
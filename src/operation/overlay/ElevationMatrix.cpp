@@ -62,19 +62,19 @@ ElevationMatrixFilter::filter_rw(Coordinate *c) const
 #endif
 
 	// already has a Z value, nothing to do
-	if ( ! ISNAN(c->z) ) return;
+	if ( ! ISNAN(c->getZ()) ) return;
 
 	double avgElevation = em.getAvgElevation();
 
 	try {
 		const ElevationMatrixCell &emc = em.getCell(*c);
-		c->z = emc.getAvg();
-		if ( ISNAN(c->z) ) c->z = avgElevation;
+		c->setZ(emc.getAvg());
+		if ( ISNAN(c->getZ()) ) c->setZ(avgElevation);
 #if GEOS_DEBUG
-		cerr<<"  z set to "<<c->z<<endl;
+		cerr<<"  z set to "<<c->getZ()<<endl;
 #endif
 	} catch (const util::IllegalArgumentException& /* ex */) {
-		c->z = avgElevation;
+		c->setZ(avgElevation);
 	}
 }
 
@@ -138,7 +138,7 @@ ElevationMatrix::add(const CoordinateSequence *cs)
 void
 ElevationMatrix::add(const Coordinate &c)
 {
-	if ( ISNAN(c.z) ) return;
+	if ( ISNAN(c.getZ()) ) return;
 	try {
 		ElevationMatrixCell &emc = getCell(c);
 		emc.add(c);
@@ -44,11 +44,11 @@ ElevationMatrixCell::~ElevationMatrixCell()
 void
 ElevationMatrixCell::add(const Coordinate &c)
 {
-	if ( !ISNAN(c.z) )
+	if ( !ISNAN(c.getZ()) )
 	{
-		if ( zvals.insert(c.z).second )
+		if ( zvals.insert(c.getZ()).second )
 		{
-			ztot+=c.z;
+			ztot+=c.getZ();
 		}
 	}
 }
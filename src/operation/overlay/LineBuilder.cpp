@@ -36,7 +36,11 @@
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
 #endif
+#ifdef GEOS_COORDINATE_2D
+#define COMPUTE_Z 0
+#else
 #define COMPUTE_Z 1
+#endif
 
 using namespace std;
 using namespace geos::algorithm;
@@ -215,7 +219,7 @@ LineBuilder::propagateZ(CoordinateSequence *cs)
 	size_t cssize = cs->getSize();
 	for (i=0; i<cssize; i++)
 	{
-		if ( !ISNAN(cs->getAt(i).z) ) v3d.push_back(i);
+		if ( !ISNAN(cs->getAt(i).getZ()) ) v3d.push_back(i);
 	}
 
 #if GEOS_DEBUG
@@ -235,11 +239,11 @@ LineBuilder::propagateZ(CoordinateSequence *cs)
 	// fill initial part
 	if ( v3d[0] != 0 )
 	{
-		double z = cs->getAt(v3d[0]).z;
+		double z = cs->getAt(v3d[0]).getZ();
 		for (int j=0; j<v3d[0]; j++)
 		{
 			buf = cs->getAt(j);
-			buf.z = z;
+			buf.setZ(z);
 			cs->setAt(buf, j);
 		}
 	}
@@ -254,14 +258,14 @@ LineBuilder::propagateZ(CoordinateSequence *cs)
 		{
 			const Coordinate &cto = cs->getAt(curr);
 			const Coordinate &cfrom = cs->getAt(prev);
-			double gap = cto.z-cfrom.z;
+			double gap = cto.getZ()-cfrom.getZ();
 			double zstep = gap/dist;
-			double z = cfrom.z;
+			double z = cfrom.getZ();
 			for (int j=prev+1; j<curr; j++)
 			{
 				buf = cs->getAt(j);
 				z+=zstep;
-				buf.z = z;
+				buf.setZ(z);
 				cs->setAt(buf, j);
 			}
 		}
@@ -271,11 +275,11 @@ LineBuilder::propagateZ(CoordinateSequence *cs)
 	// fill final part
 	if ( prev < cssize-1 )
 	{
-		double z = cs->getAt(prev).z;
+		double z = cs->getAt(prev).getZ();
 		for (size_t j=prev+1; j<cssize; j++)
 		{
 			buf = cs->getAt(j);
-			buf.z = z;
+			buf.setZ(z);
 			cs->setAt(buf, j);
 		}
 	}
@@ -0,0 +1,111 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlay/OverlayClipper.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+
+#include <algorithm>
+
+using namespace geos::geom;
+using geos::operation::intersection::RectangleIntersection;
+
+namespace geos {
+namespace operation { // geos::operation
+namespace overlay { // geos::operation::overlay
+
+namespace {
+
+/// Margin around the clipping envelope, as a fraction of its size
+const double SAFETY_MARGIN_FACTOR = 0.1;
+
+} // anonymous namespace
+
+const std::size_t OverlayClipper::MIN_POINTS;
+
+/*public static*/
+void
+OverlayClipper::clip(OverlayOp::OpCode opCode,
+		const Geometry& g0, const Geometry& g1, GeomPtrPair& ret)
+{
+	ret.first.reset();
+	ret.second.reset();
+
+	Envelope env;
+	if (!getClipEnvelope(opCode, g0, g1, env)) return;
+
+	if (opCode == OverlayOp::opINTERSECTION)
+		ret.first = clip(g0, env);
+	ret.second = clip(g1, env);
+}
+
+/*public static*/
+bool
+OverlayClipper::getClipEnvelope(OverlayOp::OpCode opCode,
+		const Geometry& g0, const Geometry& g1, Envelope& env)
+{
+	const Envelope* env0 = g0.getEnvelopeInternal();
+	const Envelope* env1 = g1.getEnvelopeInternal();
+
+	switch (opCode)
+	{
+		case OverlayOp::opINTERSECTION:
+			// disjoint operands are not noded against each other
+			if (!env0->intersection(*env1, env)) return false;
+			break;
+		case OverlayOp::opDIFFERENCE:
+			if (env0->isNull()) return false;
+			env = *env0;
+			break;
+		default:
+			return false;
+	}
+
+	// the edges added along a point envelope would meet the other
+	// operand there
+	double margin = SAFETY_MARGIN_FACTOR *
+		std::max(env.getWidth(), env.getHeight());
+	if (margin <= 0) return false;
+
+	env.expandBy(margin);
+	return true;
+}
+
+/*private static*/
+OverlayClipper::GeomPtr
+OverlayClipper::clip(const Geometry& geom, const Envelope& env)
+{
+	if (env.covers(geom.getEnvelopeInternal())) return GeomPtr();
+	if (geom.getNumPoints() < MIN_POINTS) return GeomPtr();
+
+	GeomPtr clipped = RectangleIntersection::clip(geom, env);
+
+	// lower dimension parts, left by the geometry touching the
+	// envelope, would make an invalid overlay operand
+	if (!clipped->isEmpty() &&
+			clipped->getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION &&
+			geom.getGeometryTypeId() != GEOS_GEOMETRYCOLLECTION)
+	{
+		return GeomPtr();
+	}
+	return clipped;
+}
+
+} // namespace geos::operation::overlay
+} // namespace geos::operation
+} // namespace geos
@@ -45,6 +45,7 @@
 #include <geos/geomgraph/Position.h>
 #include <geos/geomgraph/index/SegmentIntersector.h>
 #include <geos/util/TopologyException.h>
+#include <geos/util/Arena.h>
 #include <geos/geomgraph/EdgeNodingValidator.h>
 
 #include <cassert>
@@ -58,8 +59,14 @@
 #define GEOS_DEBUG 0
 #endif
 
+#ifdef GEOS_COORDINATE_2D
+// No Z to compute, skip the elevation matrix too
+#define COMPUTE_Z 0
+#define USE_ELEVATION_MATRIX 0
+#else
 #define COMPUTE_Z 1
 #define USE_ELEVATION_MATRIX 1
+#endif
 #define USE_INPUT_AVGZ 0
 
 // A result validator using FuzzyPointLocator to
@@ -186,6 +193,7 @@ Geometry*
 OverlayOp::getResultGeometry(OverlayOp::OpCode funcCode)
 	//throw(TopologyException *)
 {
+	util::Arena::Scope scope(arena);
 	computeOverlay(funcCode);
 	return resultGeom;
 }
@@ -436,9 +444,9 @@ OverlayOp::getAverageZ(const Polygon *poly)
 	for (size_t i=0; i<npts; ++i)
 	{
 		const Coordinate &c = pts->getAt(i);
-		if ( !ISNAN(c.z) )
+		if ( !ISNAN(c.getZ()) )
 		{
-			totz += c.z;
+			totz += c.getZ();
 			zcount++;
 		}
 	}
@@ -498,11 +506,11 @@ OverlayOp::mergeZ(Node *n, const LineString *line) const
 		{
 			if ( p == p0 )
 			{
-				n->addZ(p0.z);
+				n->addZ(p0.getZ());
 			}
 			else if ( p == p1 )
 			{
-				n->addZ(p1.z);
+				n->addZ(p1.getZ());
 			}
 			else
 			{
@@ -21,6 +21,7 @@
 
 #include <geos/operation/relate/RelateComputer.h>
 #include <geos/operation/relate/RelateOp.h>
+#include <geos/util/Arena.h>
 
 // Forward declarations
 namespace geos {
@@ -72,6 +73,7 @@ RelateOp::~RelateOp()
 IntersectionMatrix*
 RelateOp::getIntersectionMatrix()
 {
+	util::Arena::Scope scope(arena);
 	return relateComp.computeIM();
 }
 
@@ -24,7 +24,9 @@
 #include <geos/geom/Polygon.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/util/GeometryCombiner.h>
-#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/index/strtree/AbstractSTRtree.h> // for ItemsList
+#include <geos/util/TaskRunner.h>
 // std
 #include <cassert>
 #include <cstddef>
@@ -35,6 +37,192 @@ namespace geos {
 namespace operation { // geos.operation
 namespace geounion {  // geos.operation.geounion
 
+/*
+ * The cascaded union as a tree of units of work.
+ *
+ * Subtrees of the item tree holding at most minGrainSize polygons
+ * are unioned sequentially by a single unit, using unionTree.
+ * Above them, the binary unions performed by unionTree and
+ * binaryUnion are represented explicitly, so that the tree of
+ * units mirrors exactly the sequential computation.
+ *
+ * Units are run bottom-up, by height: all the units of a given
+ * height only depend on lower ones, so they are run concurrently.
+ */
+class CascadedPolygonUnion::ParallelUnion: public util::TaskRunner::Task {
+
+public:
+
+    ParallelUnion(CascadedPolygonUnion& u)
+      : cpu(u)
+    {}
+
+    ~ParallelUnion()
+    {
+        for (std::size_t i = 0; i < units.size(); ++i)
+            if (units[i].owned) delete units[i].result;
+    }
+
+    geom::Geometry* Union(index::strtree::ItemsList* tree)
+    {
+        long root = buildTree(tree);
+
+        std::vector< std::vector<long> > byHeight;
+        for (std::size_t i = 0; i < units.size(); ++i) {
+            std::size_t h = units[i].height;
+            if (h == 0) continue; // input polygon
+            if (byHeight.size() < h) byHeight.resize(h);
+            byHeight[h-1].push_back(static_cast<long>(i));
+        }
+
+        util::TaskRunner runner(cpu.numThreads);
+        for (std::size_t h = 0; h < byHeight.size(); ++h) {
+            current = &byHeight[h];
+            runner.run(*this, current->size());
+        }
+
+        Unit& r = units[root];
+        geom::Geometry* ret = r.result;
+        r.result = NULL;
+        return ret;
+    }
+
+    void run(std::size_t i)
+    {
+        Unit& u = units[(*current)[i]];
+
+        if (u.subtree) {
+            u.result = cpu.unionTree(u.subtree);
+            u.owned = true;
+            return;
+        }
+
+        geom::Geometry* g0 = u.child0 < 0 ? NULL : units[u.child0].result;
+        geom::Geometry* g1 = u.child1 < 0 ? NULL : units[u.child1].result;
+
+        if (g1 == NULL && u.child0 >= 0 && units[u.child0].owned) {
+            // a single intermediate result, take it over
+            // rather than cloning it
+            u.result = g0;
+            units[u.child0].result = NULL;
+        }
+        else {
+            u.result = cpu.unionSafe(g0, g1);
+        }
+        u.owned = true;
+
+        release(u.child0);
+        release(u.child1);
+    }
+
+private:
+
+    struct Unit {
+        /// Subtree unioned sequentially, or NULL
+        index::strtree::ItemsList* subtree;
+
+        /// Units whose results are unioned, -1 for none
+        long child0;
+        long child1;
+
+        /// An input polygon, or the result of the unit
+        geom::Geometry* result;
+        bool owned;
+
+        /// 0 for input polygons
+        std::size_t height;
+    };
+
+    CascadedPolygonUnion& cpu;
+
+    std::vector<Unit> units;
+
+    const std::vector<long>* current;
+
+    long addUnit(index::strtree::ItemsList* subtree, long child0,
+        long child1, geom::Geometry* input)
+    {
+        Unit u;
+        u.subtree = subtree;
+        u.child0 = child0;
+        u.child1 = child1;
+        u.result = input;
+        u.owned = false;
+        u.height = 0;
+        if (subtree) u.height = 1;
+        if (child0 >= 0) u.height = units[child0].height + 1;
+        if (child1 >= 0 && units[child1].height + 1 > u.height)
+            u.height = units[child1].height + 1;
+        if (!subtree && !input && u.height == 0) u.height = 1;
+        units.push_back(u);
+        return static_cast<long>(units.size() - 1);
+    }
+
+    void release(long i)
+    {
+        if (i < 0) return;
+        if (units[i].owned) delete units[i].result;
+        units[i].result = NULL;
+        units[i].owned = false;
+    }
+
+    static std::size_t countItems(index::strtree::ItemsList* list)
+    {
+        std::size_t n = 0;
+        typedef index::strtree::ItemsList::iterator iterator_type;
+        for (iterator_type i = list->begin(), e = list->end(); i != e; ++i) {
+            if ((*i).get_type() == index::strtree::ItemsListItem::item_is_list)
+                n += countItems((*i).get_itemslist());
+            else
+                ++n;
+        }
+        return n;
+    }
+
+    /// Mirrors unionTree and reduceToGeometries
+    long buildTree(index::strtree::ItemsList* list)
+    {
+        if (countItems(list) <= cpu.minGrainSize)
+            return addUnit(list, -1, -1, NULL);
+
+        std::vector<long> ids;
+        typedef index::strtree::ItemsList::iterator iterator_type;
+        for (iterator_type i = list->begin(), e = list->end(); i != e; ++i) {
+            if ((*i).get_type() == index::strtree::ItemsListItem::item_is_list) {
+                ids.push_back(buildTree((*i).get_itemslist()));
+            }
+            else {
+                geom::Geometry* g =
+                    reinterpret_cast<geom::Geometry*>((*i).get_geometry());
+                ids.push_back(addUnit(NULL, -1, -1, g));
+            }
+        }
+        return buildBinary(ids, 0, ids.size());
+    }
+
+    /// Mirrors binaryUnion
+    long buildBinary(const std::vector<long>& ids, std::size_t start,
+        std::size_t end)
+    {
+        if (end - start <= 1) {
+            return addUnit(NULL, start < end ? ids[start] : -1, -1, NULL);
+        }
+        else if (end - start == 2) {
+            return addUnit(NULL, ids[start], ids[start + 1], NULL);
+        }
+        else {
+            std::size_t mid = (end + start) / 2;
+            long u0 = buildBinary(ids, start, mid);
+            long u1 = buildBinary(ids, mid, end);
+            return addUnit(NULL, u0, u1, NULL);
+        }
+    }
+
+    // Declare type as noncopyable
+    ParallelUnion(const ParallelUnion& other);
+    ParallelUnion& operator=(const ParallelUnion& rhs);
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 void GeometryListHolder::deleteItem(geom::Geometry* item)
 {
@@ -48,6 +236,14 @@ geom::Geometry* CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys)
     return op.Union();
 }
 
+geom::Geometry* CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys,
+    unsigned int numThreads)
+{
+    CascadedPolygonUnion op (polys);
+    op.setNumThreads(numThreads);
+    return op.Union();
+}
+
 geom::Geometry* CascadedPolygonUnion::Union(const geom::MultiPolygon* multipoly)
 {
     std::vector<geom::Polygon*> polys;
@@ -74,7 +270,7 @@ geom::Geometry* CascadedPolygonUnion::Union()
      * This makes unioning more efficient, since vertices are more likely 
      * to be eliminated on each round.
      */
-    index::strtree::STRtree index(STRTREE_NODE_CAPACITY);
+    index::strtree::PackedSTRtree index(STRTREE_NODE_CAPACITY);
 
     typedef std::vector<geom::Polygon*>::iterator iterator_type;
     iterator_type end = inputPolys->end();
@@ -85,6 +281,11 @@ geom::Geometry* CascadedPolygonUnion::Union()
 
     std::auto_ptr<index::strtree::ItemsList> itemTree (index.itemsTree());
 
+    if (numThreads != 1 && inputPolys->size() > minGrainSize) {
+        ParallelUnion pu(*this);
+        return pu.Union(itemTree.get());
+    }
+
     return unionTree(itemTree.get());
 }
 
@@ -0,0 +1,355 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#include <geos/operation/union/CoverageUnion.h>
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/operation/valid/TopologyValidationError.h>
+#include <geos/algorithm/CGAlgorithms.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TopologyException.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::algorithm::CGAlgorithms;
+using geos::operation::polygonize::Polygonizer;
+using geos::operation::valid::IsValidOp;
+
+namespace geos {
+namespace operation { // geos::operation
+namespace geounion {  // geos::operation::geounion
+
+namespace {
+
+/// Relative difference allowed between the input and result areas
+const double AREA_TOLERANCE = 1e-6;
+
+} // anonymous namespace
+
+const std::size_t CoverageUnion::NONE;
+
+/*public static*/
+std::auto_ptr<Geometry>
+CoverageUnion::Union(const Geometry& geom, bool validate)
+{
+	CoverageUnion op(geom, validate);
+	return op.Union();
+}
+
+/*private*/
+CoverageUnion::CoverageUnion(const Geometry& g, bool v)
+	:
+	geom(g),
+	validate(v)
+{
+}
+
+/*private*/
+std::auto_ptr<Geometry>
+CoverageUnion::Union()
+{
+	const std::size_t npts = geom.getNumPoints();
+	pts.reserve(npts);
+	segments.reserve(npts);
+	vertices.reserve(npts);
+
+	add(geom);
+	ringStarts.push_back(pts.size());
+
+	const GeometryFactory* factory = geom.getFactory();
+	std::vector<Geometry*> lines;
+	std::auto_ptr< std::vector<Polygon*> > faces;
+	try
+	{
+		extractLines(lines);
+
+		Polygonizer polygonizer;
+		for (std::size_t i=0, n=lines.size(); i<n; ++i)
+			polygonizer.add(static_cast<const Geometry*>(lines[i]));
+
+		// before getPolygons(), which hands over the polygons so that
+		// any later getter would polygonize again
+		if (validate && (!polygonizer.getDangles().empty() ||
+				!polygonizer.getCutEdges().empty() ||
+				!polygonizer.getInvalidRingLines().empty()))
+		{
+			throw util::TopologyException(
+				"CoverageUnion: edges not forming rings, "
+				"input is not a coverage");
+		}
+
+		faces.reset(polygonizer.getPolygons());
+	}
+	catch (...)
+	{
+		for (std::size_t i=0, n=lines.size(); i<n; ++i) delete lines[i];
+		if (faces.get())
+		{
+			for (std::size_t i=0, n=faces->size(); i<n; ++i)
+				delete (*faces)[i];
+		}
+		throw;
+	}
+	for (std::size_t i=0, n=lines.size(); i<n; ++i) delete lines[i];
+
+	// faces of the gaps and of the holes of the union are polygonized
+	// too, their shells running against the kept segments
+	std::vector<Geometry*>* polys = new std::vector<Geometry*>();
+	for (std::size_t i=0, n=faces->size(); i<n; ++i)
+	{
+		Polygon* face = (*faces)[i];
+		if (isInUnion(*face)) polys->push_back(face);
+		else delete face;
+	}
+	std::auto_ptr<Geometry> result(factory->buildGeometry(polys));
+
+	if (validate)
+	{
+		// polygons overlapping without a common edge, or edges
+		// not sharing their vertices
+		double area = geom.getArea();
+		if (std::fabs(result->getArea() - area) > AREA_TOLERANCE * area)
+		{
+			throw util::TopologyException(
+				"CoverageUnion: union area differs from input area, "
+				"input is not a coverage");
+		}
+		// crossing edges
+		IsValidOp ivo(result.get());
+		if (!ivo.isValid())
+		{
+			throw util::TopologyException(
+				"CoverageUnion: invalid union, input is not a coverage: " +
+				ivo.getValidationError()->toString(),
+				ivo.getValidationError()->getCoordinate());
+		}
+	}
+	return result;
+}
+
+/*private*/
+void
+CoverageUnion::add(const Geometry& g)
+{
+	if (const Polygon* poly = dynamic_cast<const Polygon*>(&g))
+	{
+		addPolygon(*poly);
+	}
+	else if (const GeometryCollection* coll =
+			dynamic_cast<const GeometryCollection*>(&g))
+	{
+		for (std::size_t i=0, n=coll->getNumGeometries(); i<n; ++i)
+			add(*coll->getGeometryN(i));
+	}
+	else if (!g.isEmpty())
+	{
+		throw util::IllegalArgumentException(
+			"CoverageUnion: input is not polygonal");
+	}
+}
+
+/*private*/
+void
+CoverageUnion::addPolygon(const Polygon& poly)
+{
+	if (poly.isEmpty()) return;
+
+	addRing(*poly.getExteriorRing()->getCoordinatesRO(), true);
+	for (std::size_t i=0, n=poly.getNumInteriorRing(); i<n; ++i)
+		addRing(*poly.getInteriorRingN(i)->getCoordinatesRO(), false);
+}
+
+/*private*/
+void
+CoverageUnion::addRing(const CoordinateSequence& ring, bool ccw)
+{
+	const std::size_t n = ring.getSize();
+	if (n == 0) return;
+
+	const std::size_t start = pts.size();
+	ringStarts.push_back(start);
+
+	// shells counter clockwise and holes clockwise
+	const bool reverse = CGAlgorithms::isCCW(&ring) != ccw;
+	for (std::size_t i=0; i<n; ++i)
+		pts.push_back(ring.getAt(reverse ? n-1-i : i));
+
+	Segment closing;
+	closing.from = closing.to = 0;
+	closing.nextOut = NONE;
+	closing.kept = false;
+	segments.resize(pts.size(), closing);
+
+	for (std::size_t i=start; i+1<pts.size(); ++i) addSegment(i);
+}
+
+/*private*/
+void
+CoverageUnion::addSegment(std::size_t i)
+{
+	Segment& s = segments[i];
+	s.from = getVertex(pts[i]);
+	s.to = getVertex(pts[i+1]);
+	s.kept = s.from != s.to; // repeated point
+
+	if (!s.kept) return;
+
+	// the same segment twice is an edge shared by overlapping
+	// polygons
+	if (validate)
+	{
+		for (std::size_t j=s.from->firstOut; j!=NONE; j=segments[j].nextOut)
+		{
+			if (segments[j].to == s.to)
+			{
+				throw util::TopologyException(
+					"CoverageUnion: overlapping polygons, "
+					"input is not a coverage", pts[i]);
+			}
+		}
+	}
+
+	std::size_t opposite = findKept(s.to, s.from);
+	if (opposite != NONE)
+	{
+		segments[opposite].kept = false;
+		s.kept = false;
+	}
+
+	s.nextOut = s.from->firstOut;
+	s.from->firstOut = i;
+}
+
+/*private*/
+CoverageUnion::Vertex*
+CoverageUnion::getVertex(const Coordinate& p)
+{
+	Vertex* v = vertexIndex.find(p);
+	if (v) return v;
+
+	vertices.push_back(Vertex());
+	v = &vertices.back();
+	v->firstOut = NONE;
+	vertexIndex.insert(p, v);
+	return v;
+}
+
+/*private*/
+std::size_t
+CoverageUnion::findKept(const Vertex* from, const Vertex* to) const
+{
+	if (!from || !to) return NONE;
+	for (std::size_t j=from->firstOut; j!=NONE; j=segments[j].nextOut)
+	{
+		if (segments[j].to == to && segments[j].kept) return j;
+	}
+	return NONE;
+}
+
+/*private*/
+bool
+CoverageUnion::isNode(const Vertex* v) const
+{
+	std::size_t count = 0;
+	for (std::size_t j=v->firstOut; j!=NONE; j=segments[j].nextOut)
+	{
+		if (segments[j].kept && ++count > 1) return true;
+	}
+	return false;
+}
+
+/*private*/
+void
+CoverageUnion::extractLines(std::vector<Geometry*>& lines) const
+{
+	const GeometryFactory* factory = geom.getFactory();
+	const CoordinateSequenceFactory* csf =
+		factory->getCoordinateSequenceFactory();
+
+	for (std::size_t r=0, nr=ringStarts.size()-1; r<nr; ++r)
+	{
+		const std::size_t start = ringStarts[r];
+		const std::size_t last = ringStarts[r+1]-1; // closing point
+		const std::size_t n = last - start;
+		if (n == 0) continue;
+
+		// start after a cancelled segment or at a node, so that a run
+		// is not split at the ring start
+		std::size_t first = start;
+		while (first < last && (segments[first].from == segments[first].to ||
+				(segments[first].kept && !isNode(segments[first].from))))
+		{
+			++first;
+		}
+		if (first == last) first = start;
+
+		std::vector<Coordinate>* run = 0;
+		for (std::size_t k=0; k<=n; ++k)
+		{
+			const std::size_t i = start + (first - start + k) % n;
+			const Segment& s = segments[i];
+			if (k < n && s.from == s.to) continue;
+
+			// the union boundary touching itself at a vertex, the
+			// polygonizer needs the runs noded there
+			if (k == n || !s.kept || (run && isNode(s.from)))
+			{
+				if (run)
+				{
+					lines.push_back(factory->createLineString(
+						csf->create(run)));
+					run = 0;
+				}
+				if (k == n || !s.kept) continue;
+			}
+
+			if (!run)
+			{
+				run = new std::vector<Coordinate>();
+				run->push_back(pts[i]);
+			}
+			run->push_back(pts[i+1]);
+		}
+	}
+}
+
+/*private*/
+bool
+CoverageUnion::isInUnion(const Polygon& poly) const
+{
+	const CoordinateSequence* shell =
+		poly.getExteriorRing()->getCoordinatesRO();
+	const bool ccw = CGAlgorithms::isCCW(shell);
+	const Coordinate p0 = shell->getAt(ccw ? 0 : 1);
+	const Coordinate p1 = shell->getAt(ccw ? 1 : 0);
+	return findKept(vertexIndex.find(p0), vertexIndex.find(p1)) != NONE;
+}
+
+} // namespace geos::operation::geounion
+} // namespace geos::operation
+} // namespace geos
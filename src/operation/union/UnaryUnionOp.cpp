@@ -94,8 +94,11 @@ UnaryUnionOp::Union()
 
   GeomAutoPtr unionPolygons;
   if (!polygons.empty()) {
-      unionPolygons.reset( CascadedPolygonUnion::Union( polygons.begin(),
-                                                        polygons.end()   ) );
+      std::vector<geom::Polygon*> polys;
+      for (std::size_t i = 0; i < polygons.size(); ++i)
+          polys.push_back(const_cast<geom::Polygon*>(polygons[i]));
+      unionPolygons.reset( CascadedPolygonUnion::Union( &polys,
+                                                        numThreads ) );
   }
 
   /**
@@ -48,7 +48,8 @@ NodeMap::getNodeMap()
 Node*
 NodeMap::add(Node *n)
 {
-	nodeMap.insert(pair<geom::Coordinate, Node*>(n->getCoordinate(),n));
+	if ( nodeIndex.insert(n->getCoordinate(), n) == n )
+		nodeMap.insert(pair<geom::Coordinate, Node*>(n->getCoordinate(),n));
 	return n;
 }
 
@@ -59,8 +60,8 @@ NodeMap::add(Node *n)
 Node *
 NodeMap::remove(geom::Coordinate& pt)
 {
-	Node *n=find(pt);
-	nodeMap.erase(pt);
+	Node *n=nodeIndex.remove(pt);
+	if ( n ) nodeMap.erase(pt);
 	return n;
 }
 
@@ -81,11 +82,7 @@ NodeMap::getNodes(vector<Node*>& values)
 Node*
 NodeMap::find(const geom::Coordinate& coord)
 {
-	container::iterator found=nodeMap.find(coord);
-	if (found==nodeMap.end())
-		return NULL;
-	else
-		return found->second;
+	return nodeIndex.find(coord);
 }
 
 } //namespace planargraph 
@@ -0,0 +1,181 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Arena.h>
+#include <geos/platform.h> // for HAVE_PTHREAD, int64
+
+#include <new>
+#include <cstddef>
+
+// Thread local storage for the current arena. Threaded builds on
+// compilers without a thread local storage class get no arenas.
+#if defined(_MSC_VER)
+# define GEOS_ARENA_TLS __declspec(thread)
+#elif defined(__GNUC__)
+# define GEOS_ARENA_TLS __thread
+#elif ! defined(HAVE_PTHREAD) && ! defined(_WIN32)
+# define GEOS_ARENA_TLS
+#else
+# define GEOS_ARENA_NO_TLS 1
+#endif
+
+namespace geos {
+namespace util { // geos.util
+
+namespace {
+
+/// A type with the strictest alignment requirements we need
+union MaxAlign {
+	double d;
+	int64 i;
+	void* p;
+	long l;
+};
+
+const std::size_t ALIGNMENT = sizeof(MaxAlign);
+
+/// ArenaAllocated objects are preceded by the Arena they come from
+const std::size_t HEADER_SIZE = ALIGNMENT;
+
+inline std::size_t
+alignUp(std::size_t n)
+{
+	return (n + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+#ifndef GEOS_ARENA_NO_TLS
+GEOS_ARENA_TLS Arena* currentArena = 0;
+#endif
+
+} // anonymous namespace
+
+/*public*/
+Arena::Scope::Scope(Arena& a)
+{
+#ifndef GEOS_ARENA_NO_TLS
+	previous = currentArena;
+	currentArena = &a;
+#else
+	(void)a;
+	previous = 0;
+#endif
+}
+
+/*public*/
+Arena::Scope::~Scope()
+{
+#ifndef GEOS_ARENA_NO_TLS
+	currentArena = previous;
+#endif
+}
+
+/*public*/
+Arena::Arena(std::size_t bs)
+	:
+	blockSize(alignUp(bs)),
+	next(0),
+	end(0),
+	allocated(0)
+{
+}
+
+/*public*/
+Arena::~Arena()
+{
+	for (std::size_t i=0; i<blocks.size(); ++i)
+		::operator delete(blocks[i]);
+}
+
+/*public*/
+void*
+Arena::allocate(std::size_t n)
+{
+	n = alignUp(n ? n : 1);
+	allocated += n;
+
+	if ( static_cast<std::size_t>(end - next) >= n )
+	{
+		void* ret = next;
+		next += n;
+		return ret;
+	}
+
+	blocks.reserve(blocks.size() + 1); // so that push_back can't throw
+
+	if ( n > blockSize / 4 )
+	{
+		// too large to share a block, give it its own and keep
+		// carving from the current one
+		char* block = static_cast<char*>(::operator new(n));
+		blocks.push_back(block);
+		return block;
+	}
+
+	next = static_cast<char*>(::operator new(blockSize));
+	blocks.push_back(next);
+	end = next + blockSize;
+
+	void* ret = next;
+	next += n;
+	return ret;
+}
+
+/*public static*/
+Arena*
+Arena::getCurrent()
+{
+#ifndef GEOS_ARENA_NO_TLS
+	return currentArena;
+#else
+	return 0;
+#endif
+}
+
+/*public static*/
+bool
+Arena::isSupported()
+{
+#ifndef GEOS_ARENA_NO_TLS
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*public static*/
+void*
+ArenaAllocated::operator new(std::size_t n)
+{
+	Arena* arena = Arena::getCurrent();
+	char* mem;
+	if ( arena )
+		mem = static_cast<char*>(arena->allocate(HEADER_SIZE + n));
+	else
+		mem = static_cast<char*>(::operator new(HEADER_SIZE + n));
+	*reinterpret_cast<Arena**>(mem) = arena;
+	return mem + HEADER_SIZE;
+}
+
+/*public static*/
+void
+ArenaAllocated::operator delete(void* p)
+{
+	if ( ! p ) return;
+	char* mem = static_cast<char*>(p) - HEADER_SIZE;
+	// memory from an arena is released with the arena
+	if ( ! *reinterpret_cast<Arena**>(mem) )
+		::operator delete(mem);
+}
+
+} // namespace geos.util
+} // namespace geos
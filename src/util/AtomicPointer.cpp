@@ -0,0 +1,91 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/AtomicPointer.h>
+#include <geos/platform.h> // for HAVE_PTHREAD
+
+#if defined(_WIN32)
+# include <windows.h>
+#endif
+
+namespace geos {
+namespace util { // geos.util
+
+#if defined(_WIN32)
+
+void*
+loadAcquire(void* const volatile* p)
+{
+	void* v = *p;
+	MemoryBarrier();
+	return v;
+}
+
+void
+storeRelease(void* volatile* p, void* value)
+{
+	MemoryBarrier();
+	*p = value;
+}
+
+#elif defined(HAVE_PTHREAD) && defined(__ATOMIC_ACQUIRE)
+
+void*
+loadAcquire(void* const volatile* p)
+{
+	return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+void
+storeRelease(void* volatile* p, void* value)
+{
+	__atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+#elif defined(HAVE_PTHREAD) && defined(__GNUC__)
+
+// Full barriers, for compilers predating the __atomic builtins
+
+void*
+loadAcquire(void* const volatile* p)
+{
+	void* v = *p;
+	__sync_synchronize();
+	return v;
+}
+
+void
+storeRelease(void* volatile* p, void* value)
+{
+	__sync_synchronize();
+	*p = value;
+}
+
+#else // no thread support
+
+void*
+loadAcquire(void* const volatile* p)
+{
+	return *p;
+}
+
+void
+storeRelease(void* volatile* p, void* value)
+{
+	*p = value;
+}
+
+#endif
+
+} // namespace geos.util
+} // namespace geos
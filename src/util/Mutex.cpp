@@ -0,0 +1,95 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Mutex.h>
+#include <geos/platform.h> // for HAVE_PTHREAD
+
+#if defined(_WIN32)
+# include <windows.h>
+#elif defined(HAVE_PTHREAD)
+# include <pthread.h>
+#endif
+
+namespace geos {
+namespace util { // geos.util
+
+#if defined(_WIN32)
+
+Mutex::Mutex()
+{
+	CRITICAL_SECTION* cs = new CRITICAL_SECTION;
+	InitializeCriticalSection(cs);
+	impl = cs;
+}
+
+Mutex::~Mutex()
+{
+	CRITICAL_SECTION* cs = static_cast<CRITICAL_SECTION*>(impl);
+	DeleteCriticalSection(cs);
+	delete cs;
+}
+
+void
+Mutex::lock()
+{
+	EnterCriticalSection(static_cast<CRITICAL_SECTION*>(impl));
+}
+
+void
+Mutex::unlock()
+{
+	LeaveCriticalSection(static_cast<CRITICAL_SECTION*>(impl));
+}
+
+#elif defined(HAVE_PTHREAD)
+
+Mutex::Mutex()
+{
+	pthread_mutex_t* m = new pthread_mutex_t;
+	pthread_mutex_init(m, NULL);
+	impl = m;
+}
+
+Mutex::~Mutex()
+{
+	pthread_mutex_t* m = static_cast<pthread_mutex_t*>(impl);
+	pthread_mutex_destroy(m);
+	delete m;
+}
+
+void
+Mutex::lock()
+{
+	pthread_mutex_lock(static_cast<pthread_mutex_t*>(impl));
+}
+
+void
+Mutex::unlock()
+{
+	pthread_mutex_unlock(static_cast<pthread_mutex_t*>(impl));
+}
+
+#else // no thread support
+
+Mutex::Mutex() : impl(0) {}
+
+Mutex::~Mutex() {}
+
+void Mutex::lock() {}
+
+void Mutex::unlock() {}
+
+#endif
+
+} // namespace geos.util
+} // namespace geos
@@ -0,0 +1,227 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/TaskRunner.h>
+#include <geos/util/Mutex.h>
+#include <geos/util/GEOSException.h>
+#include <geos/platform.h> // for HAVE_PTHREAD
+
+#if defined(_WIN32)
+# include <windows.h>
+# include <process.h>
+#elif defined(HAVE_PTHREAD)
+# include <pthread.h>
+# include <unistd.h>
+#endif
+
+#include <exception>
+#include <memory>
+#include <new> // for std::bad_alloc
+#include <vector>
+
+namespace geos {
+namespace util { // geos.util
+
+namespace { // anonymous
+
+/// State shared by the threads of a TaskRunner::run call
+class WorkQueue {
+
+public:
+
+	WorkQueue(TaskRunner::Task& t, std::size_t n)
+		:
+		task(t),
+		count(n),
+		next(0),
+		failed(false)
+	{}
+
+	/// Runs units until none is left or one failed
+	void work()
+	{
+		std::size_t i;
+		while ( take(i) )
+		{
+			try {
+				task.run(i);
+			}
+			catch (const GEOSException& e) {
+				fail(&e);
+			}
+			catch (const std::bad_alloc&) {
+				fail(0);
+			}
+			catch (const std::exception& e) {
+				const GEOSException err(e.what());
+				fail(&err);
+			}
+			catch (...) {
+				const GEOSException err("Unknown exception thrown");
+				fail(&err);
+			}
+		}
+	}
+
+	/// Throws the first error, if any, with its original type
+	void raiseError() const
+	{
+		if ( ! failed ) return;
+		if ( ! error.get() ) throw std::bad_alloc();
+		error->raise();
+	}
+
+private:
+
+	TaskRunner::Task& task;
+	std::size_t count;
+	std::size_t next;
+	bool failed;
+	/// NULL when out of memory
+	std::auto_ptr<GEOSException> error;
+	Mutex mutex;
+
+	bool take(std::size_t& i)
+	{
+		Mutex::Lock lock(mutex);
+		if ( failed || next >= count ) return false;
+		i = next++;
+		return true;
+	}
+
+	/// Records the first error, NULL standing for std::bad_alloc
+	void fail(const GEOSException* e)
+	{
+		std::auto_ptr<GEOSException> copy;
+		try {
+			if ( e ) copy.reset(e->clone());
+		}
+		catch (...) {
+			// reported as std::bad_alloc
+		}
+		Mutex::Lock lock(mutex);
+		if ( failed ) return;
+		failed = true;
+		error = copy;
+	}
+};
+
+#if defined(_WIN32)
+
+unsigned __stdcall
+workerMain(void* arg)
+{
+	static_cast<WorkQueue*>(arg)->work();
+	return 0;
+}
+
+#elif defined(HAVE_PTHREAD)
+
+extern "C" void*
+workerMain(void* arg)
+{
+	static_cast<WorkQueue*>(arg)->work();
+	return 0;
+}
+
+#endif
+
+} // anonymous namespace
+
+/*public*/
+TaskRunner::TaskRunner(unsigned int nThreads)
+	:
+	numThreads(nThreads ? nThreads : getNumProcessors())
+{
+	if ( ! isThreadingSupported() ) numThreads = 1;
+}
+
+/*public static*/
+unsigned int
+TaskRunner::getNumProcessors()
+{
+	long n = 1;
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	n = info.dwNumberOfProcessors;
+#elif defined(HAVE_PTHREAD) && defined(_SC_NPROCESSORS_ONLN)
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	return n > 0 ? static_cast<unsigned int>(n) : 1;
+}
+
+/*public static*/
+bool
+TaskRunner::isThreadingSupported()
+{
+#if defined(_WIN32) || defined(HAVE_PTHREAD)
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*public*/
+void
+TaskRunner::run(Task& task, std::size_t count)
+{
+	std::size_t nWorkers = numThreads < count ? numThreads : count;
+
+	// errors go through the queue even on the calling thread alone,
+	// so that they are reported the same whatever the number of threads
+	WorkQueue queue(task, count);
+	if ( nWorkers <= 1 )
+	{
+		queue.work();
+		queue.raiseError();
+		return;
+	}
+
+#if defined(_WIN32)
+	std::vector<HANDLE> threads;
+	for (std::size_t i=1; i<nWorkers; ++i)
+	{
+		uintptr_t h = _beginthreadex(NULL, 0, workerMain, &queue, 0, NULL);
+		if ( h ) threads.push_back(reinterpret_cast<HANDLE>(h));
+	}
+	queue.work();
+	for (std::size_t i=0; i<threads.size(); ++i)
+	{
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+	}
+#elif defined(HAVE_PTHREAD)
+	std::vector<pthread_t> threads;
+	for (std::size_t i=1; i<nWorkers; ++i)
+	{
+		pthread_t t;
+		// If a thread can't be started the others,
+		// or the calling one, take over its share
+		if ( pthread_create(&t, NULL, workerMain, &queue) == 0 )
+			threads.push_back(t);
+	}
+	queue.work();
+	for (std::size_t i=0; i<threads.size(); ++i)
+	{
+		pthread_join(threads[i], NULL);
+	}
+#else
+	queue.work();
+#endif
+
+	queue.raiseError();
+}
+
+} // namespace geos.util
+} // namespace geos
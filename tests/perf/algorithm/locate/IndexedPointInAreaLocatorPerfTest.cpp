@@ -0,0 +1,165 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Measures the memory allocated by building an IndexedPointInAreaLocator
+ * over a large polygon, and the build and query times, compared with
+ * a GridPointInAreaLocator.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Location.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <new>
+#include <cmath>
+#include <cstdlib>
+
+using namespace geos::geom;
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::algorithm::locate::GridPointInAreaLocator;
+using namespace std;
+
+// Bytes requested from operator new, by everyone
+static size_t allocatedBytes = 0;
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+  allocatedBytes += size;
+  void* p = std::malloc(size ? size : 1);
+  if ( ! p ) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) throw()
+{
+  std::free(p);
+}
+
+class IndexedPointInAreaLocatorPerfTest
+{
+public:
+
+  void test(int numVertices, int numQueries)
+  {
+    auto_ptr<Geometry> g(jaggedDisc(numVertices));
+    cout << g->getNumPoints() << " points, "
+         << numQueries << " queries" << endl;
+
+    geos::util::Profile build("build");
+    size_t before = allocatedBytes;
+    build.start();
+    IndexedPointInAreaLocator locator(*g);
+    build.stop();
+    size_t used = allocatedBytes - before;
+
+    cout << "  build: " << build.getTot() << " usecs, "
+         << used / 1024 << " KiB allocated ("
+         << double(used) / g->getNumPoints() << " bytes per point)" << endl;
+
+    vector<double> x, y;
+    for (int i=0; i<numQueries; ++i)
+    {
+      x.push_back(std::rand() * 2.2 / RAND_MAX - 1.1);
+      y.push_back(std::rand() * 2.2 / RAND_MAX - 1.1);
+    }
+
+    geos::util::Profile query("locate");
+    before = allocatedBytes;
+    query.start();
+    int interior = 0;
+    for (int i=0; i<numQueries; ++i)
+    {
+      Coordinate c(x[i], y[i]);
+      if ( locator.locate(&c) == Location::INTERIOR ) ++interior;
+    }
+    query.stop();
+
+    cout << "  locate: " << query.getTot() / numQueries << " usecs/point, "
+         << allocatedBytes - before << " bytes allocated"
+         << " (" << interior << " interior)" << endl;
+
+    geos::util::Profile batch("batch");
+    vector<int> locations(numQueries);
+    batch.start();
+    locator.locate(&x[0], &y[0], x.size(), &locations[0]);
+    batch.stop();
+
+    cout << "  batch locate: " << batch.getTot() / numQueries
+         << " usecs/point" << endl;
+
+    geos::util::Profile gridBuild("grid build");
+    before = allocatedBytes;
+    gridBuild.start();
+    GridPointInAreaLocator grid(*g);
+    gridBuild.stop();
+    used = allocatedBytes - before;
+
+    cout << "  grid build: " << gridBuild.getTot() << " usecs, "
+         << used / 1024 << " KiB allocated, "
+         << grid.getNumBoundaryCells() << " of "
+         << grid.getNumColumns() * grid.getNumRows()
+         << " cells on the boundary" << endl;
+
+    geos::util::Profile gridQuery("grid locate");
+    gridQuery.start();
+    interior = 0;
+    for (int i=0; i<numQueries; ++i)
+    {
+      Coordinate c(x[i], y[i]);
+      if ( grid.locate(&c) == Location::INTERIOR ) ++interior;
+    }
+    gridQuery.stop();
+
+    cout << "  grid locate: " << gridQuery.getTot() / numQueries
+         << " usecs/point (" << interior << " interior)" << endl;
+  }
+
+private:
+
+  GeometryFactory factory;
+
+  // A unit disc with a boundary of n vertices jagged on the scale
+  // of its segments, as found along coastlines
+  Polygon* jaggedDisc(int n)
+  {
+    CoordinateArraySequence* cs = new CoordinateArraySequence();
+    for (int i=0; i<n; ++i)
+    {
+      double a = 2 * M_PI * i / n;
+      double r = 1.0 - 4 * M_PI / n * (std::rand() / double(RAND_MAX));
+      cs->add(Coordinate(r * std::cos(a), r * std::sin(a)));
+    }
+    cs->add(Coordinate(cs->getAt(0)));
+    LinearRing* shell = factory.createLinearRing(cs);
+    return factory.createPolygon(shell, 0);
+  }
+
+};
+
+int
+main()
+{
+  IndexedPointInAreaLocatorPerfTest tester;
+
+  tester.test(10000, 100000);
+  tester.test(1000000, 100000);
+}
@@ -0,0 +1,117 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Overlay and buffer workload reporting time and peak memory, to
+ * compare a default build against one configured with 2D-only
+ * coordinates (--enable-coordinate-2d, -DGEOS_COORDINATE_2D=ON).
+ *
+ **********************************************************************/
+
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/profiler.h>
+#include <geos/platform.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#ifndef _WIN32
+# include <sys/resource.h>
+#endif
+
+using namespace geos::geom;
+using namespace std;
+
+class CoordinateDimensionPerfTest
+{
+public:
+
+  CoordinateDimensionPerfTest()
+    : factory(&pm)
+  {}
+
+  void test(int nStars, int nPts)
+  {
+    vector<Geometry*> stars;
+    for (int i=0; i<nStars; ++i)
+    {
+      geos::geom::util::SineStarFactory gsf(&factory);
+      gsf.setCentre(Coordinate(i * 7.0, (i % 5) * 11.0));
+      gsf.setSize(100.0);
+      gsf.setNumPoints(nPts);
+      gsf.setNumArms(5 + i % 7);
+      stars.push_back(gsf.createSineStar().release());
+    }
+
+    cout << nStars << " stars of " << nPts << " points" << endl;
+
+    geos::util::Profile overlay("overlay");
+    overlay.start();
+    size_t nOverlayPts = 0;
+    auto_ptr<Geometry> acc ( stars[0]->clone() );
+    for (size_t i=1; i<stars.size(); ++i)
+    {
+      auto_ptr<Geometry> isect ( acc->intersection(stars[i]) );
+      nOverlayPts += isect->getNumPoints();
+      acc.reset( acc->Union(stars[i]) );
+    }
+    overlay.stop();
+
+    geos::util::Profile buffer("buffer");
+    buffer.start();
+    size_t nBufferPts = 0;
+    for (size_t i=0; i<stars.size(); ++i)
+    {
+      auto_ptr<Geometry> buf ( stars[i]->buffer(5.0) );
+      nBufferPts += buf->getNumPoints();
+    }
+    buffer.stop();
+
+    cout << "  overlay " << overlay.getTot() << " usecs ("
+         << nOverlayPts + acc->getNumPoints() << " points), "
+         << "buffer " << buffer.getTot() << " usecs ("
+         << nBufferPts << " points)" << endl;
+
+    for (size_t i=0; i<stars.size(); ++i) delete stars[i];
+  }
+
+private:
+
+  PrecisionModel pm;
+  GeometryFactory factory;
+
+};
+
+int
+main()
+{
+#ifdef GEOS_COORDINATE_2D
+  cout << "2D-only coordinates";
+#else
+  cout << "3D coordinates";
+#endif
+  cout << ", sizeof(Coordinate) = " << sizeof(Coordinate) << endl;
+
+  CoordinateDimensionPerfTest tester;
+  tester.test(50, 2000);
+  tester.test(20, 20000);
+
+#ifndef _WIN32
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  cout << "peak RSS " << usage.ru_maxrss << " KB" << endl;
+#endif
+}
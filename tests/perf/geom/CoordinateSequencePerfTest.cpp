@@ -0,0 +1,112 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Compares ring area, line length, envelope and point in ring
+ * timings on CoordinateArraySequence (interleaved coordinates)
+ * and OrdinateArraySequence (separate ordinate arrays).
+ *
+ **********************************************************************/
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/OrdinateArraySequence.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/algorithm/CGAlgorithms.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+using namespace geos::geom;
+using geos::algorithm::CGAlgorithms;
+using namespace std;
+
+class CoordinateSequencePerfTest
+{
+public:
+
+  void test(size_t nPts, int nIter)
+  {
+    vector<Coordinate> ring;
+    createRing(nPts, ring);
+
+    cout << nPts << " points, " << nIter << " iterations" << endl;
+
+    CoordinateArraySequence aos(new vector<Coordinate>(ring));
+    run("CoordinateArraySequence", aos, nIter);
+
+    OrdinateArraySequence soa(ring);
+    run("OrdinateArraySequence", soa, nIter);
+  }
+
+private:
+
+  void run(const char* name, const CoordinateSequence& seq, int nIter)
+  {
+    double check = 0.0;
+
+    geos::util::Profile area("area");
+    area.start();
+    for (int i=0; i<nIter; ++i) check += CGAlgorithms::signedArea(&seq);
+    area.stop();
+
+    geos::util::Profile length("length");
+    length.start();
+    for (int i=0; i<nIter; ++i) check += CGAlgorithms::length(&seq);
+    length.stop();
+
+    geos::util::Profile env("envelope");
+    env.start();
+    for (int i=0; i<nIter; ++i) {
+      Envelope e;
+      seq.expandEnvelope(e);
+      check += e.getWidth();
+    }
+    env.stop();
+
+    geos::util::Profile pip("pointInRing");
+    Coordinate p(0.1, 0.2);
+    pip.start();
+    for (int i=0; i<nIter; ++i)
+      check += CGAlgorithms::isPointInRing(p, &seq);
+    pip.stop();
+
+    cout << "  " << name << ": "
+         << "area " << area.getTot() << " usecs, "
+         << "length " << length.getTot() << " usecs, "
+         << "envelope " << env.getTot() << " usecs, "
+         << "pointInRing " << pip.getTot() << " usecs "
+         << "(" << check << ")" << endl;
+  }
+
+  void createRing(size_t n, vector<Coordinate>& pts)
+  {
+    pts.reserve(n+1);
+    for (size_t i=0; i<n; ++i)
+    {
+      double a = 2 * 3.14159265358979 * i / n;
+      double r = 100 + 10 * std::sin(a * 50);
+      pts.push_back(Coordinate(r * std::cos(a), r * std::sin(a)));
+    }
+    pts.push_back(pts[0]);
+  }
+
+};
+
+int
+main()
+{
+  CoordinateSequencePerfTest tester;
+
+  tester.test(100, 100000);
+  tester.test(1000000, 20);
+}
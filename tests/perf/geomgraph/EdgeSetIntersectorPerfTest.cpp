@@ -0,0 +1,121 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Times relate and overlay with each EdgeSetIntersector of the
+ * geometry graphs, on combs with short vertical teeth, which the
+ * sweep line handles well, and on combs with long horizontal teeth,
+ * whose edges all overlap in x.
+ *
+ **********************************************************************/
+
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geomgraph/index/EdgeSetIntersector.h>
+#include <geos/operation/relate/RelateOp.h>
+#include <geos/operation/overlay/OverlayOp.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace geos::geom;
+using geos::geomgraph::index::EdgeSetIntersector;
+using geos::operation::relate::RelateOp;
+using geos::operation::overlay::OverlayOp;
+using namespace std;
+
+class EdgeSetIntersectorPerfTest
+{
+public:
+
+  void test(const string& name, int numTeeth, bool horizontal)
+  {
+    auto_ptr<Geometry> a(comb(numTeeth, 0.0, horizontal));
+    auto_ptr<Geometry> b(comb(numTeeth, 0.5, horizontal));
+
+    cout << name << ": " << a->getNumPoints() << " + "
+         << b->getNumPoints() << " points" << endl;
+
+    run(*a, *b, EdgeSetIntersector::SWEEPLINE, "sweepline");
+    run(*a, *b, EdgeSetIntersector::STRTREE, "strtree");
+    run(*a, *b, EdgeSetIntersector::AUTO, "auto");
+  }
+
+private:
+
+  GeometryFactory factory;
+
+  void run(const Geometry& a, const Geometry& b,
+           EdgeSetIntersector::Type type, const string& name)
+  {
+    geos::util::Profile relateProf("relate");
+    relateProf.start();
+    RelateOp relate(&a, &b);
+    relate.setEdgeSetIntersectorType(type);
+    string im = relate.getIntersectionMatrix()->toString();
+    relateProf.stop();
+
+    geos::util::Profile overlayProf("intersection");
+    overlayProf.start();
+    OverlayOp overlay(&a, &b);
+    overlay.setEdgeSetIntersectorType(type);
+    auto_ptr<Geometry> r(overlay.getResultGeometry(OverlayOp::opINTERSECTION));
+    overlayProf.stop();
+
+    cout << "  " << name << ": relate " << relateProf.getTot() << " usecs ("
+         << im << "), intersection " << overlayProf.getTot() << " usecs ("
+         << r->getNumPoints() << ")" << endl;
+  }
+
+  // A comb with n teeth, shifted by d; two combs shifted by half
+  // a tooth cross at every tooth. Horizontal teeth are 10 times longer.
+  Polygon* comb(int n, double d, bool horizontal)
+  {
+    double len = horizontal ? 10.0 * n : 10.0;
+    CoordinateArraySequence* cs = new CoordinateArraySequence();
+    add(cs, d, -1, horizontal);
+    for (int i=0; i<n; ++i)
+    {
+      add(cs, d + i, len, horizontal);
+      add(cs, d + i + 0.7, len, horizontal);
+      add(cs, d + i + 0.7, 0, horizontal);
+      add(cs, d + i + 1, 0, horizontal);
+    }
+    add(cs, d + n, -1, horizontal);
+    add(cs, d, -1, horizontal);
+    LinearRing* shell = factory.createLinearRing(cs);
+    return factory.createPolygon(shell, 0);
+  }
+
+  void add(CoordinateArraySequence* cs, double x, double y, bool swap)
+  {
+    cs->add(swap ? Coordinate(y, x) : Coordinate(x, y));
+  }
+
+};
+
+int
+main()
+{
+  EdgeSetIntersectorPerfTest tester;
+
+  tester.test("vertical teeth", 1000, false);
+  tester.test("vertical teeth", 10000, false);
+  tester.test("horizontal teeth", 100, true);
+  tester.test("horizontal teeth", 1000, true);
+  tester.test("horizontal teeth", 5000, true);
+}
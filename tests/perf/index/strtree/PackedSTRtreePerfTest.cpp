@@ -0,0 +1,125 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Compares build and query time of the node-based STRtree
+ * against the flat PackedSTRtree.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/geom/Envelope.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+using namespace geos::geom;
+using namespace geos::index::strtree;
+using namespace std;
+
+class PackedSTRtreePerfTest
+{
+public:
+
+  void test(int nItems, int nQueries)
+  {
+    vector<Envelope> items;
+    vector<Envelope> queries;
+    createEnvelopes(nItems, 1.0, items);
+    createEnvelopes(nQueries, 10.0, queries);
+
+    cout << nItems << " items, " << nQueries << " queries" << endl;
+
+    {
+      STRtree tree;
+      run("STRtree", tree, items, queries);
+    }
+    {
+      PackedSTRtree tree;
+      run("PackedSTRtree", tree, items, queries);
+      runBatch(tree, queries, 1);
+      runBatch(tree, queries, 0);
+    }
+  }
+
+private:
+
+  static const int EXTENT = 10000;
+
+  template <class Tree>
+  void run(const char* name, Tree& tree,
+           vector<Envelope>& items, vector<Envelope>& queries)
+  {
+    geos::util::Profile build("build");
+    build.start();
+    for (size_t i=0; i<items.size(); ++i)
+      tree.insert(&items[i], &items[i]);
+    tree.build();
+    build.stop();
+
+    geos::util::Profile query("query");
+    size_t nMatches = 0;
+    vector<void*> matches;
+    query.start();
+    for (size_t i=0; i<queries.size(); ++i)
+    {
+      matches.clear();
+      tree.query(&queries[i], matches);
+      nMatches += matches.size();
+    }
+    query.stop();
+
+    cout << "  " << name << ": build " << build.getTot() << " usecs, "
+         << "query " << query.getTot() << " usecs "
+         << "(" << nMatches << " matches)" << endl;
+  }
+
+  void runBatch(PackedSTRtree& tree, vector<Envelope>& queries,
+                unsigned int numThreads)
+  {
+    geos::util::Profile query("queryBatch");
+    vector<size_t> offsets;
+    vector<void*> matches;
+    query.start();
+    tree.queryBatch(queries, offsets, matches, numThreads);
+    query.stop();
+
+    cout << "  PackedSTRtree::queryBatch (" << numThreads << " threads): "
+         << query.getTot() << " usecs "
+         << "(" << matches.size() << " matches)" << endl;
+  }
+
+  void createEnvelopes(int n, double size, vector<Envelope>& envs)
+  {
+    envs.reserve(n);
+    for (int i=0; i<n; ++i)
+    {
+      double x = EXTENT * (double)rand() / RAND_MAX;
+      double y = EXTENT * (double)rand() / RAND_MAX;
+      envs.push_back(Envelope(x, x+size, y, y+size));
+    }
+  }
+
+};
+
+int
+main()
+{
+  srand(1);
+
+  PackedSTRtreePerfTest tester;
+
+  tester.test(10000, 100000);
+  tester.test(1000000, 100000);
+}
+
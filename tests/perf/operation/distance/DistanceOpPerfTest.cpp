@@ -0,0 +1,112 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation. 
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Compares the brute-force and the indexed facet distance of
+ * DistanceOp on pairs of "coastlines" of increasing size.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+
+using namespace geos::geom;
+using geos::operation::distance::DistanceOp;
+using namespace std;
+
+class DistanceOpPerfTest
+{
+public:
+  DistanceOpPerfTest()
+    :
+    pm(),
+    fact(&pm, 0)
+  {}
+
+  void test(int nPts)
+  {
+    // two wavy rings facing each other across a narrow strait
+    auto_ptr<Geometry> coast0 ( createCoastline(Coordinate(0, 0), nPts) );
+    auto_ptr<Geometry> coast1 ( createCoastline(Coordinate(205, 0), nPts) );
+
+    double bruteDist = 0, indexedDist = 0;
+    long bruteTime = testDistance(*coast0, *coast1, false, bruteDist);
+    long indexedTime = testDistance(*coast0, *coast1, true, indexedDist);
+
+    cout << coast0->getNumPoints() << " points:"
+         << " brute-force " << bruteTime << " usecs,"
+         << " indexed " << indexedTime << " usecs";
+    if ( bruteDist != indexedDist )
+      cout << " DISTANCES DIFFER: " << bruteDist << " != " << indexedDist;
+    cout << endl;
+  }
+
+private:
+
+  PrecisionModel pm;
+  GeometryFactory fact;
+
+  long testDistance(const Geometry& g0, const Geometry& g1,
+                    bool indexed, double& dist)
+  {
+    int iter = 0;
+    geos::util::Profile sw("");
+    // repeat small cases to get a measurable time
+    do {
+      sw.start();
+      DistanceOp op(g0, g1);
+      op.setIndexed(indexed);
+      dist = op.distance();
+      auto_ptr<CoordinateSequence> pts ( op.nearestPoints() );
+      sw.stop();
+      ++iter;
+    } while ( sw.getTot() < 100000 && iter < 1000 );
+    return long(sw.getTot() / iter);
+  }
+
+  Geometry* createCoastline(const Coordinate& origin, int nPts)
+  {
+      using geos::geom::util::SineStarFactory;
+
+      SineStarFactory gsf(&fact);
+      gsf.setCentre(origin);
+      gsf.setSize(200);
+      gsf.setNumPoints(nPts);
+      gsf.setArmLengthRatio(0.1);
+      gsf.setNumArms(50);
+      auto_ptr<Polygon> poly = gsf.createSineStar();
+      return poly->getBoundary();
+  }
+
+};
+
+int
+main()
+{
+  DistanceOpPerfTest tester;
+
+  tester.test(5);
+  tester.test(10);
+  tester.test(30);
+  tester.test(100);
+  tester.test(1000);
+  // the brute-force distance takes minutes beyond this
+  tester.test(10000);
+}
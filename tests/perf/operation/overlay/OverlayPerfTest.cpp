@@ -0,0 +1,105 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Times overlay operations between two finely crenellated polygons,
+ * which produce graphs with many nodes.
+ *
+ **********************************************************************/
+
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace geos::geom;
+using namespace std;
+
+class OverlayPerfTest
+{
+public:
+
+  void test(int numTeeth)
+  {
+    auto_ptr<Geometry> a(comb(numTeeth, 0.0));
+    auto_ptr<Geometry> b(comb(numTeeth, 0.5));
+
+    cout << a->getNumPoints() << " + " << b->getNumPoints()
+         << " points" << endl;
+
+    run("intersection", *a, *b);
+    run("union", *a, *b);
+    run("difference", *a, *b);
+    run("relate", *a, *b);
+  }
+
+private:
+
+  GeometryFactory factory;
+
+  void run(const string& name, const Geometry& a, const Geometry& b)
+  {
+    geos::util::Profile prof(name);
+    prof.start();
+    size_t n;
+    if ( name == "intersection" ) {
+      auto_ptr<Geometry> r(a.intersection(&b));
+      n = r->getNumPoints();
+    } else if ( name == "union" ) {
+      auto_ptr<Geometry> r(a.Union(&b));
+      n = r->getNumPoints();
+    } else if ( name == "difference" ) {
+      auto_ptr<Geometry> r(a.difference(&b));
+      n = r->getNumPoints();
+    } else {
+      n = a.intersects(&b) ? 1 : 0;
+    }
+    prof.stop();
+
+    cout << "  " << name << ": " << prof.getTot() << " usecs"
+         << " (" << n << ")" << endl;
+  }
+
+  // A comb with n teeth, shifted by dx; two combs shifted by half
+  // a tooth cross at every tooth
+  Polygon* comb(int n, double dx)
+  {
+    CoordinateArraySequence* cs = new CoordinateArraySequence();
+    cs->add(Coordinate(dx, -1));
+    for (int i=0; i<n; ++i)
+    {
+      cs->add(Coordinate(dx + i, 10));
+      cs->add(Coordinate(dx + i + 0.7, 10));
+      cs->add(Coordinate(dx + i + 0.7, 0));
+      cs->add(Coordinate(dx + i + 1, 0));
+    }
+    cs->add(Coordinate(dx + n, -1));
+    cs->add(Coordinate(dx, -1));
+    LinearRing* shell = factory.createLinearRing(cs);
+    return factory.createPolygon(shell, 0);
+  }
+
+};
+
+int
+main()
+{
+  OverlayPerfTest tester;
+
+  tester.test(1000);
+  tester.test(10000);
+}
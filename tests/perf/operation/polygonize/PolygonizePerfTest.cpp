@@ -0,0 +1,93 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Times Polygonizer on a fully noded grid of segments, which
+ * stresses node lookup in the planar graph.
+ *
+ **********************************************************************/
+
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::polygonize::Polygonizer;
+using namespace std;
+
+class PolygonizePerfTest
+{
+public:
+
+  void test(int gridSize)
+  {
+    vector<Geometry*> lines;
+    createGrid(gridSize, lines);
+
+    geos::util::Profile prof("polygonize");
+    prof.start();
+    Polygonizer polygonizer;
+    polygonizer.add(&lines);
+    vector<Polygon*>* polys = polygonizer.getPolygons();
+    prof.stop();
+
+    cout << lines.size() << " segments: " << polys->size()
+         << " polygons in " << prof.getTot() << " usecs" << endl;
+
+    for (size_t i=0; i<polys->size(); ++i) delete (*polys)[i];
+    delete polys;
+    for (size_t i=0; i<lines.size(); ++i) delete lines[i];
+  }
+
+private:
+
+  GeometryFactory factory;
+
+  LineString* segment(double x0, double y0, double x1, double y1)
+  {
+    CoordinateArraySequence* cs = new CoordinateArraySequence();
+    cs->add(Coordinate(x0, y0));
+    cs->add(Coordinate(x1, y1));
+    return factory.createLineString(cs);
+  }
+
+  // One segment per grid cell side, so that every vertex is a node
+  void createGrid(int n, vector<Geometry*>& lines)
+  {
+    for (int i=0; i<=n; ++i)
+    {
+      for (int j=0; j<n; ++j)
+      {
+        lines.push_back(segment(i, j, i, j+1));
+        lines.push_back(segment(j, i, j+1, i));
+      }
+    }
+  }
+
+};
+
+int
+main()
+{
+  PolygonizePerfTest tester;
+
+  tester.test(50);
+  tester.test(100);
+  tester.test(200);
+}
@@ -0,0 +1,130 @@
+/**********************************************************************
+ * $Id$
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Compares clipping a polygon and its boundary to a grid of tiles with
+ * RectangleIntersection and with Geometry::intersection.
+ *
+ **********************************************************************/
+
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <memory>
+
+using namespace geos::geom;
+using geos::operation::intersection::RectangleIntersection;
+using namespace std;
+
+class RectangleIntersectionPerfTest
+{
+public:
+  RectangleIntersectionPerfTest()
+    :
+    pm(),
+    fact(&pm, 0)
+  {}
+
+  void test(int nPts, int nSide)
+  {
+    auto_ptr<Polygon> sinePoly ( createSineStar(Coordinate(0, 0), 100, nPts) );
+    auto_ptr<Geometry> sineLine ( sinePoly->getBoundary() );
+
+    vector<Envelope> tiles;
+    createTiles(*sinePoly->getEnvelopeInternal(), nSide, tiles);
+
+    cout << sinePoly->getNumPoints() << " points, "
+         << tiles.size() << " tiles" << endl;
+    test(*sinePoly, tiles);
+    test(*sineLine, tiles);
+  }
+
+private:
+
+  PrecisionModel pm;
+  GeometryFactory fact;
+
+  void test(const Geometry& g, const vector<Envelope>& tiles)
+  {
+    double clipped = 0, overlaid = 0;
+
+    geos::util::Profile swClip("clip");
+    swClip.start();
+    for (size_t i = 0; i < tiles.size(); i++) {
+      auto_ptr<Geometry> r = RectangleIntersection::clip(g, tiles[i]);
+      clipped += g.getDimension() == 2 ? r->getArea() : r->getLength();
+    }
+    swClip.stop();
+
+    geos::util::Profile swOverlay("intersection");
+    swOverlay.start();
+    for (size_t i = 0; i < tiles.size(); i++) {
+      auto_ptr<Geometry> rect ( fact.toGeometry(&tiles[i]) );
+      auto_ptr<Geometry> r ( g.intersection(rect.get()) );
+      overlaid += g.getDimension() == 2 ? r->getArea() : r->getLength();
+    }
+    swOverlay.stop();
+
+    cout << "  " << g.getGeometryType()
+         << ": clip " << swClip.getTot() << " usecs"
+         << ", intersection " << swOverlay.getTot() << " usecs"
+         << ", difference " << fabs(clipped - overlaid) << endl;
+  }
+
+  void createTiles(const Envelope& env, int nSide, vector<Envelope>& tiles)
+  {
+    double dx = env.getWidth() / nSide;
+    double dy = env.getHeight() / nSide;
+
+    for (int i = 0; i < nSide; i++) {
+      for (int j = 0; j < nSide; j++) {
+        double baseX = env.getMinX() + i * dx;
+        double baseY = env.getMinY() + j * dy;
+        tiles.push_back(Envelope(baseX, baseX + dx, baseY, baseY + dy));
+      }
+    }
+  }
+
+  auto_ptr<Polygon> createSineStar(const Coordinate& origin,
+                                    double size, int nPts)
+  {
+      using geos::geom::util::SineStarFactory;
+
+      SineStarFactory gsf(&fact);
+      gsf.setCentre(origin);
+      gsf.setSize(size);
+      gsf.setNumPoints(nPts);
+      gsf.setArmLengthRatio(2);
+      gsf.setNumArms(20);
+      auto_ptr<Polygon> poly = gsf.createSineStar();
+      return poly;
+  }
+
+};
+
+int
+main()
+{
+
+  RectangleIntersectionPerfTest tester;
+
+  tester.test(500, 6);
+  tester.test(100000, 6);
+  tester.test(100000, 20);
+}
@@ -0,0 +1,91 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.refractions.net
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Times CascadedPolygonUnion of a grid of overlapping discs
+ * with an increasing number of threads.
+ *
+ **********************************************************************/
+
+#include <geos/operation/union/CascadedPolygonUnion.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/util/TaskRunner.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::geounion::CascadedPolygonUnion;
+using namespace std;
+
+class CascadedPolygonUnionPerfTest
+{
+public:
+
+  void test(int gridSize)
+  {
+    vector<Polygon*> polys;
+    createDiscs(gridSize, polys);
+
+    cout << polys.size() << " discs" << endl;
+
+    unsigned int maxThreads = geos::util::TaskRunner::getNumProcessors();
+    for (unsigned int n=1; n<=maxThreads; n*=2)
+    {
+      run(polys, n);
+    }
+
+    for (size_t i=0; i<polys.size(); ++i) delete polys[i];
+  }
+
+private:
+
+  GeometryFactory factory;
+
+  void run(vector<Polygon*>& polys, unsigned int numThreads)
+  {
+    geos::util::Profile prof("union");
+    prof.start();
+    auto_ptr<Geometry> u(CascadedPolygonUnion::Union(&polys, numThreads));
+    prof.stop();
+
+    cout << "  " << numThreads << " thread(s): "
+         << prof.getTot() << " usecs "
+         << "(" << u->getNumPoints() << " points)" << endl;
+  }
+
+  void createDiscs(int n, vector<Polygon*>& polys)
+  {
+    for (int i=0; i<n; ++i)
+    {
+      for (int j=0; j<n; ++j)
+      {
+        auto_ptr<Point> pt(factory.createPoint(Coordinate(i, j)));
+        polys.push_back(dynamic_cast<Polygon*>(pt->buffer(0.7)));
+      }
+    }
+  }
+
+};
+
+int
+main()
+{
+  CascadedPolygonUnionPerfTest tester;
+
+  tester.test(30);
+  tester.test(60);
+}
@@ -0,0 +1,214 @@
+/************************************************************************
+ *
+ * $Id$
+ *
+ * Multithreaded test sharing one prepared geometry between threads
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ * Every round prepares the same polygon again, and starts all threads
+ * at once on it, so that they race to build its lazily built indexes
+ * and then query them concurrently. Results are compared with those of
+ * a prepared geometry used by a single thread.
+ *
+ ***********************************************************************/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
+
+#include "geos_c.h"
+
+#define NUM_THREADS 8
+#define NUM_ROUNDS 20
+#define GRID_SIZE 40
+
+/* Predicates evaluated on each test geometry */
+#define NUM_PREDICATES 5
+
+typedef struct
+{
+	const GEOSPreparedGeometry* prep;
+	GEOSGeometry** geoms;
+	char* expected;
+	int ngeoms;
+	int first;
+	int failures;
+} ThreadData;
+
+static pthread_barrier_t barrier;
+
+void
+notice(const char *fmt, ...) {
+	va_list ap;
+
+        fprintf( stdout, "NOTICE: ");
+
+	va_start (ap, fmt);
+        vfprintf( stdout, fmt, ap);
+        va_end(ap);
+        fprintf( stdout, "\n" );
+}
+
+void
+log_and_exit(const char *fmt, ...) {
+	va_list ap;
+
+        fprintf( stdout, "ERROR: ");
+
+	va_start (ap, fmt);
+        vfprintf( stdout, fmt, ap);
+        va_end(ap);
+        fprintf( stdout, "\n" );
+	exit(1);
+}
+
+static void
+evaluate(GEOSContextHandle_t handle, const GEOSPreparedGeometry* prep,
+         const GEOSGeometry* g, char* results)
+{
+	results[0] = GEOSPreparedContains_r(handle, prep, g);
+	results[1] = GEOSPreparedContainsProperly_r(handle, prep, g);
+	results[2] = GEOSPreparedCovers_r(handle, prep, g);
+	results[3] = GEOSPreparedIntersects_r(handle, prep, g);
+	results[4] = GEOSPreparedDistanceWithin_r(handle, prep, g, 5);
+}
+
+static void *
+worker(void *arg)
+{
+	ThreadData* data = (ThreadData*)arg;
+	GEOSContextHandle_t handle = initGEOS_r(notice, log_and_exit);
+	char results[NUM_PREDICATES];
+	int i, j, k;
+
+	pthread_barrier_wait(&barrier);
+
+	/* each thread starts at a different geometry */
+	for (k=0; k<data->ngeoms; k++)
+	{
+		i = (data->first + k) % data->ngeoms;
+		evaluate(handle, data->prep, data->geoms[i], results);
+		for (j=0; j<NUM_PREDICATES; j++)
+		{
+			if ( results[j] != data->expected[i*NUM_PREDICATES+j] )
+				data->failures++;
+		}
+	}
+
+	finishGEOS_r(handle);
+	return NULL;
+}
+
+static GEOSGeometry*
+createLine(GEOSContextHandle_t handle, double x0, double y0,
+           double x1, double y1)
+{
+	GEOSCoordSequence* cs = GEOSCoordSeq_create_r(handle, 2, 2);
+	GEOSCoordSeq_setX_r(handle, cs, 0, x0);
+	GEOSCoordSeq_setY_r(handle, cs, 0, y0);
+	GEOSCoordSeq_setX_r(handle, cs, 1, x1);
+	GEOSCoordSeq_setY_r(handle, cs, 1, y1);
+	return GEOSGeom_createLineString_r(handle, cs);
+}
+
+static GEOSGeometry*
+createPoint(GEOSContextHandle_t handle, double x, double y)
+{
+	GEOSCoordSequence* cs = GEOSCoordSeq_create_r(handle, 1, 2);
+	GEOSCoordSeq_setX_r(handle, cs, 0, x);
+	GEOSCoordSeq_setY_r(handle, cs, 0, y);
+	return GEOSGeom_createPoint_r(handle, cs);
+}
+
+int
+main()
+{
+	GEOSContextHandle_t handle = initGEOS_r(notice, log_and_exit);
+	GEOSGeometry *center, *shell, *hole, *area;
+	const GEOSPreparedGeometry* single;
+	GEOSGeometry** geoms;
+	char* expected;
+	ThreadData data[NUM_THREADS];
+	pthread_t threads[NUM_THREADS];
+	int ngeoms = 0, failures = 0;
+	int i, j, round;
+
+	/* a ring of many segments, with a hole */
+	center = createPoint(handle, 0, 0);
+	shell = GEOSBuffer_r(handle, center, 100, 256);
+	hole = GEOSBuffer_r(handle, center, 40, 256);
+	area = GEOSDifference_r(handle, shell, hole);
+
+	/* points and short lines across the polygon and its boundary */
+	geoms = malloc(2 * GRID_SIZE * GRID_SIZE * sizeof(GEOSGeometry*));
+	for (i=0; i<GRID_SIZE; i++)
+	{
+		for (j=0; j<GRID_SIZE; j++)
+		{
+			double x = -110 + i * 220.0 / GRID_SIZE;
+			double y = -110 + j * 220.0 / GRID_SIZE;
+			geoms[ngeoms++] = createPoint(handle, x, y);
+			geoms[ngeoms++] = createLine(handle, x, y, x + 9, y + 4);
+		}
+	}
+
+	/* expected results, also computes the test geometry envelopes */
+	expected = malloc(ngeoms * NUM_PREDICATES);
+	single = GEOSPrepare_r(handle, area);
+	for (i=0; i<ngeoms; i++)
+		evaluate(handle, single, geoms[i], &expected[i*NUM_PREDICATES]);
+	GEOSPreparedGeom_destroy_r(handle, single);
+
+	for (round=0; round<NUM_ROUNDS; round++)
+	{
+		/* a fresh copy, with nothing computed yet */
+		GEOSGeometry* copy = GEOSGeom_clone_r(handle, area);
+		const GEOSPreparedGeometry* shared = GEOSPrepare_r(handle, copy);
+
+		pthread_barrier_init(&barrier, NULL, NUM_THREADS);
+		for (i=0; i<NUM_THREADS; i++)
+		{
+			data[i].prep = shared;
+			data[i].geoms = geoms;
+			data[i].expected = expected;
+			data[i].ngeoms = ngeoms;
+			data[i].first = i * ngeoms / NUM_THREADS;
+			data[i].failures = 0;
+			if ( pthread_create(&threads[i], NULL, worker, &data[i]) )
+				log_and_exit("Could not create thread %d", i);
+		}
+		for (i=0; i<NUM_THREADS; i++)
+		{
+			pthread_join(threads[i], NULL);
+			failures += data[i].failures;
+		}
+		pthread_barrier_destroy(&barrier);
+
+		GEOSPreparedGeom_destroy_r(handle, shared);
+		GEOSGeom_destroy_r(handle, copy);
+	}
+
+	for (i=0; i<ngeoms; i++)
+		GEOSGeom_destroy_r(handle, geoms[i]);
+	free(geoms);
+	free(expected);
+	GEOSGeom_destroy_r(handle, area);
+	GEOSGeom_destroy_r(handle, hole);
+	GEOSGeom_destroy_r(handle, shell);
+	GEOSGeom_destroy_r(handle, center);
+	finishGEOS_r(handle);
+
+	if ( failures )
+	{
+		fprintf(stdout, "%d unexpected predicate results\n", failures);
+		return 1;
+	}
+	return 0;
+}
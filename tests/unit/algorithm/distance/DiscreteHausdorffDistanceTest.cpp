@@ -13,11 +13,13 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in auto_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/algorithm/distance/PointPairDistance.h>
 // std
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace geos {
 	namespace geom {
@@ -129,5 +131,90 @@ runTest("LINESTRING (130 0, 0 0, 0 150)", "LINESTRING (10 10, 10 150, 130 10)",
 runTest("LINESTRING (130 0, 0 0, 0 150)", "LINESTRING (10 10, 10 150, 130 10)", 0.5, 70.0);
 	}
 
+	// 5 - Same distance and points with any number of threads as
+	//     with the unindexed filters, on larger geometries
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		GeomPtr center ( reader.read("POINT (0 0)") );
+		GeomPtr g1 ( center->buffer(100, 64) );
+		std::ostringstream wkt;
+		wkt << "GEOMETRYCOLLECTION (LINESTRING (";
+		for (int i=0; i<600; ++i)
+		{
+			if ( i ) wkt << ", ";
+			wkt << -120 + i * 0.4 << " " << (i % 9) * 3 - 12;
+		}
+		wkt << "), POINT (150 150), MULTIPOINT (10 10, 20 -30))";
+		GeomPtr g2 ( reader.read(wkt.str()) );
+
+		double fractions[] = { 0.0, 0.5, 0.05 };
+		for (int f=0; f<3; ++f)
+		{
+			// expected, from the filters using DistanceToPoint
+			PointPairDistance expected;
+			const Geometry* geoms[] = { g1.get(), g2.get() };
+			for (int k=0; k<2; ++k)
+			{
+				const Geometry& discrete = *geoms[k];
+				const Geometry& other = *geoms[1-k];
+				DiscreteHausdorffDistance::MaxPointDistanceFilter
+					ptFilter(other);
+				discrete.apply_ro(&ptFilter);
+				expected.setMaximum(ptFilter.getMaxPointDistance());
+				if ( fractions[f] > 0 )
+				{
+					DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter
+						fracFilter(other, fractions[f]);
+					discrete.apply_ro(fracFilter);
+					expected.setMaximum(fracFilter.getMaxPointDistance());
+				}
+			}
+
+			unsigned int threads[] = { 1, 4 };
+			for (int t=0; t<2; ++t)
+			{
+				DiscreteHausdorffDistance dist(*g1, *g2);
+				if ( fractions[f] > 0 )
+					dist.setDensifyFraction(fractions[f]);
+				dist.setNumThreads(threads[t]);
+				ensure_equals(dist.distance(), expected.getDistance());
+				std::vector<Coordinate> pts = dist.getCoordinates();
+				ensure_equals(pts[0].distance(pts[1]),
+				              expected.getDistance());
+			}
+		}
+	}
+
+	// 6 - Bounded mode
+	template<>
+	template<>
+	void object::test<6>()
+	{
+		GeomPtr g1 ( reader.read("LINESTRING (130 0, 0 0, 0 150)") );
+		GeomPtr g2 ( reader.read("LINESTRING (10 10, 10 150, 130 10)") );
+
+		ensure(DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 14.2));
+		ensure(!DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 14.1));
+		ensure(DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 70.0, 0.5));
+		ensure(!DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 69.9, 0.5));
+
+		GeomPtr center ( reader.read("POINT (0 0)") );
+		GeomPtr circle ( center->buffer(100, 256) );
+		GeomPtr smaller ( center->buffer(98, 256) );
+		for (unsigned int t=1; t<=4; t+=3)
+		{
+			DiscreteHausdorffDistance within(*circle, *smaller);
+			within.setNumThreads(t);
+			ensure(within.isWithinDistance(2.01));
+
+			DiscreteHausdorffDistance beyond(*circle, *smaller);
+			beyond.setDensifyFraction(0.1);
+			beyond.setNumThreads(t);
+			ensure(!beyond.isWithinDistance(1.99));
+		}
+	}
+
 } // namespace tut
 
@@ -0,0 +1,180 @@
+// $Id$
+//
+// Test Suite for geos::algorithm::locate::GridPointInAreaLocator
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedPolygon.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <vector>
+
+using geos::algorithm::locate::GridPointInAreaLocator;
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::Location;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_gridpointinarealocator_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+
+		geos::io::WKTReader reader;
+
+		// Checks the locations of a lattice of points, of the
+		// vertices and of the middle of the segments against the
+		// interval indexed locator
+		void checkLocations(const geos::geom::Geometry& g,
+		                    std::size_t numCells, double step)
+		{
+			GridPointInAreaLocator locator(g, numCells);
+			IndexedPointInAreaLocator expected(g);
+
+			const geos::geom::Envelope& env = *g.getEnvelopeInternal();
+			std::vector<Coordinate> pts;
+			for (double x=env.getMinX()-step; x<=env.getMaxX()+step; x+=step)
+				for (double y=env.getMinY()-step; y<=env.getMaxY()+step; y+=step)
+					pts.push_back(Coordinate(x, y));
+
+			std::auto_ptr<geos::geom::CoordinateSequence> cs(g.getCoordinates());
+			for (std::size_t i=0; i<cs->size(); ++i)
+			{
+				pts.push_back(cs->getAt(i));
+				if (i+1 < cs->size())
+					pts.push_back(Coordinate(
+						(cs->getAt(i).x + cs->getAt(i+1).x) / 2,
+						(cs->getAt(i).y + cs->getAt(i+1).y) / 2));
+			}
+
+			for (std::size_t i=0; i<pts.size(); ++i)
+			{
+				ensure_equals(locator.locate(&pts[i]),
+					expected.locate(&pts[i]));
+			}
+		}
+	};
+
+	typedef test_group<test_gridpointinarealocator_data> group;
+	typedef group::object object;
+
+	group test_gridpointinarealocator_group("geos::algorithm::locate::GridPointInAreaLocator");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Polygons with holes, on grids of several sizes, including
+	//     points on cell edges
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		GeomPtr g(reader.read(
+			"MULTIPOLYGON(((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 15 5, 10 15, 5 5)),"
+			"((30 0, 40 10, 30 20, 25 10, 30 0)))"));
+
+		std::size_t cells[] = { 1, 8, 40, 200, 0, 5000 };
+		for (int i=0; i<6; ++i)
+			checkLocations(*g, cells[i], 0.5);
+	}
+
+	// 2 - A many-sided ring with a hole, most of the grid off the
+	//     boundary
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		GeomPtr center(reader.read("POINT(0 0)"));
+		GeomPtr ring(center->buffer(100, 64));
+		GeomPtr hole(center->buffer(40, 64));
+		GeomPtr area(ring->difference(hole.get()));
+
+		GridPointInAreaLocator locator(*area);
+		ensure(locator.getNumBoundaryCells() > 0);
+		ensure(locator.getNumBoundaryCells() <
+		       locator.getNumColumns() * locator.getNumRows() / 2);
+
+		checkLocations(*area, 0, 3);
+		checkLocations(*area, 64, 3);
+	}
+
+	// 3 - Degenerate envelopes and long thin polygons
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		GeomPtr flat(reader.read("POLYGON((0 0, 10 0, 20 0, 0 0))"));
+		checkLocations(*flat, 0, 1);
+
+		GeomPtr thin(reader.read("POLYGON((0 0, 1000 0, 1000 1, 0 1, 0 0))"));
+		GridPointInAreaLocator locator(*thin, 100);
+		ensure(locator.getNumColumns() > locator.getNumRows());
+		checkLocations(*thin, 100, 0.25);
+
+		GeomPtr empty(reader.read("POLYGON EMPTY"));
+		GridPointInAreaLocator emptyLocator(*empty);
+		Coordinate c(0, 0);
+		ensure_equals(emptyLocator.locate(&c), (int)Location::EXTERIOR);
+	}
+
+	// 4 - Batch location, and PreparedPolygon using the grid locator
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		GeomPtr g(reader.read(
+			"POLYGON((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 15 5, 10 15, 5 5))"));
+
+		std::vector<double> x, y;
+		for (int i=-4; i<=44; ++i)
+		{
+			for (int j=-4; j<=44; ++j)
+			{
+				x.push_back(i * 0.5);
+				y.push_back(j * 0.5);
+			}
+		}
+
+		geos::geom::prep::PreparedGeometryFactory pgf;
+		pgf.setGridPointLocator(true, 100);
+		std::auto_ptr<const geos::geom::prep::PreparedGeometry> pg(pgf.create(g.get()));
+		const geos::geom::prep::PreparedPolygon& pp =
+			dynamic_cast<const geos::geom::prep::PreparedPolygon&>(*pg);
+		ensure(dynamic_cast<GridPointInAreaLocator*>(pp.getPointLocator()) != 0);
+
+		IndexedPointInAreaLocator expected(*g);
+		unsigned int threads[] = { 1, 3 };
+		for (int t=0; t<2; ++t)
+		{
+			std::vector<int> locations(x.size(), -1);
+			pp.locate(&x[0], &y[0], x.size(), &locations[0], threads[t]);
+			for (std::size_t i=0; i<x.size(); ++i)
+			{
+				Coordinate c(x[i], y[i]);
+				ensure_equals(locations[i], expected.locate(&c));
+			}
+		}
+
+		GeomPtr inside(reader.read("POINT(2 2)"));
+		GeomPtr inHole(reader.read("POINT(10 7)"));
+		ensure(pg->contains(inside.get()));
+		ensure(!pg->intersects(inHole.get()));
+	}
+
+} // namespace tut
+
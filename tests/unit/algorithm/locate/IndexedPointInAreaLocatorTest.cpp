@@ -0,0 +1,180 @@
+// $Id$
+//
+// Test Suite for geos::algorithm::locate::IndexedPointInAreaLocator
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/SimplePointInAreaLocator.h>
+#include <geos/algorithm/RayCrossingCounter.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/OrdinateArraySequenceFactory.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <vector>
+
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::Location;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_indexedpointinarealocator_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+
+		geos::io::WKTReader reader;
+
+		// Checks the batch locations against the single point ones
+		void checkBatch(const geos::geom::Geometry& g,
+		                const std::vector<double>& x,
+		                const std::vector<double>& y)
+		{
+			IndexedPointInAreaLocator single(g);
+			std::vector<int> expected(x.size());
+			for (std::size_t i=0; i<x.size(); ++i)
+			{
+				Coordinate c(x[i], y[i]);
+				expected[i] = single.locate(&c);
+			}
+
+			unsigned int threads[] = { 1, 3, 0 };
+			for (int t=0; t<3; ++t)
+			{
+				IndexedPointInAreaLocator batch(g);
+				std::vector<int> locations(x.size(), -1);
+				batch.locate(&x[0], &y[0], x.size(), &locations[0], threads[t]);
+				ensure(locations == expected);
+			}
+		}
+	};
+
+	typedef test_group<test_indexedpointinarealocator_data> group;
+	typedef group::object object;
+
+	group test_indexedpointinarealocator_group("geos::algorithm::locate::IndexedPointInAreaLocator");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Batch location of a grid of points, including vertices
+	//     and points on edges, matches single point location
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		GeomPtr g(reader.read(
+			"MULTIPOLYGON(((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 15 5, 10 15, 5 5)),"
+			"((30 0, 40 10, 30 20, 25 10, 30 0)))"));
+
+		std::vector<double> x, y;
+		for (int i=-4; i<=90; ++i)
+		{
+			for (int j=-4; j<=50; ++j)
+			{
+				x.push_back(i * 0.5);
+				y.push_back(j * 0.5);
+			}
+		}
+		ensure(x.size() > 2048);
+		checkBatch(*g, x, y);
+	}
+
+	// 2 - Nearly collinear points go through the exact fallback
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		GeomPtr g(reader.read(
+			"POLYGON((0 0, 1 0.1, 0.3 1, 0 0))"));
+
+		std::vector<double> x, y;
+		for (int i=0; i<=1000; ++i)
+		{
+			// on the first edge, give or take rounding
+			x.push_back(i * 0.001);
+			y.push_back(i * 0.0001);
+		}
+		checkBatch(*g, x, y);
+	}
+
+	// 3 - The crossing kernel on bare segments
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		// unit square
+		const double x0[] = { 0, 1, 1, 0 };
+		const double y0[] = { 0, 0, 1, 1 };
+		const double x1[] = { 1, 1, 0, 0 };
+		const double y1[] = { 0, 1, 1, 0 };
+		using geos::algorithm::RayCrossingCounter;
+
+		ensure_equals(RayCrossingCounter::locatePointInSegments(
+			Coordinate(0.5, 0.5), x0, y0, x1, y1, 4), (int)Location::INTERIOR);
+		ensure_equals(RayCrossingCounter::locatePointInSegments(
+			Coordinate(1.5, 0.5), x0, y0, x1, y1, 4), (int)Location::EXTERIOR);
+		ensure_equals(RayCrossingCounter::locatePointInSegments(
+			Coordinate(1, 0.5), x0, y0, x1, y1, 4), (int)Location::BOUNDARY);
+		ensure_equals(RayCrossingCounter::locatePointInSegments(
+			Coordinate(0.5, 1), x0, y0, x1, y1, 4), (int)Location::BOUNDARY);
+		ensure_equals(RayCrossingCounter::locatePointInSegments(
+			Coordinate(0, 0), x0, y0, x1, y1, 4), (int)Location::BOUNDARY);
+	}
+
+	// 4 - Single point location on a many-level index matches the
+	//     unindexed locator, for sequences of either layout
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		geos::geom::PrecisionModel pm;
+		geos::geom::GeometryFactory ordinateFactory(&pm, 0,
+			const_cast<geos::geom::CoordinateSequenceFactory*>(
+				geos::geom::OrdinateArraySequenceFactory::instance()));
+		geos::io::WKTReader ordinateReader(&ordinateFactory);
+
+		GeomPtr center(reader.read("POINT(0 0)"));
+		GeomPtr ring(center->buffer(100, 64));
+		GeomPtr hole(center->buffer(40, 64));
+		GeomPtr area(ring->difference(hole.get()));
+		GeomPtr geoms[] = {
+			GeomPtr(area->clone()),
+			GeomPtr(ordinateReader.read(area->toString()))
+		};
+
+		for (int k=0; k<2; ++k)
+		{
+			const geos::geom::Geometry& g = *geoms[k];
+			IndexedPointInAreaLocator locator(g);
+			for (int i=-110; i<=110; i+=3)
+			{
+				for (int j=-110; j<=110; j+=3)
+				{
+					Coordinate c(i, j);
+					ensure_equals(locator.locate(&c),
+						geos::algorithm::locate::SimplePointInAreaLocator::locate(c, &g));
+				}
+			}
+
+			// vertices are on the boundary
+			std::auto_ptr<geos::geom::CoordinateSequence> cs(g.getCoordinates());
+			Coordinate v(cs->getAt(7));
+			ensure_equals(locator.locate(&v), (int)Location::BOUNDARY);
+		}
+	}
+
+} // namespace tut
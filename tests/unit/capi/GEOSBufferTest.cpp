@@ -548,5 +548,27 @@ namespace tut
 
     }
 
+    // Buffer noded by several threads
+    template<>
+    template<>
+    void object::test<21>()
+    {
+        geom1_ = GEOSGeomFromWKT("LINESTRING(0 0, 100 30, 0 31, 100 1, 0 2, 100 32, 0 33)");
+
+        ensure( 0 != geom1_ );
+
+        bp_ = GEOSBufferParams_create();
+        ensure_equals(GEOSBufferParams_setNumThreads(bp_, 4), 1);
+        geom2_ = GEOSBufferWithParams(geom1_, bp_, 2);
+
+        ensure( 0 != geom2_ );
+
+        GEOSGeometry* expected = GEOSBuffer(geom1_, 2, 8);
+        ensure( 0 != expected );
+        char eq = GEOSEqualsExact(geom2_, expected, 0);
+        GEOSGeom_destroy(expected);
+        ensure_equals(int(eq), 1);
+    }
+
 } // namespace tut
 
@@ -0,0 +1,104 @@
+//
+// Test Suite for C-API GEOSClipByRect
+
+#include <tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used in test cases.
+    struct test_capigeosclipbyrect_data
+    {
+        GEOSGeometry* geom1_;
+        GEOSGeometry* geom2_;
+        GEOSGeometry* geom3_;
+
+        static void notice(const char *fmt, ...)
+        {
+            std::fprintf( stdout, "NOTICE: ");
+
+            va_list ap;
+            va_start(ap, fmt);
+            std::vfprintf(stdout, fmt, ap);
+            va_end(ap);
+
+            std::fprintf(stdout, "\n");
+        }
+
+        test_capigeosclipbyrect_data()
+            : geom1_(0), geom2_(0), geom3_(0)
+        {
+            initGEOS(notice, notice);
+        }
+
+        ~test_capigeosclipbyrect_data()
+        {
+            GEOSGeom_destroy(geom1_);
+            GEOSGeom_destroy(geom2_);
+            GEOSGeom_destroy(geom3_);
+            geom1_ = 0;
+            geom2_ = 0;
+            geom3_ = 0;
+            finishGEOS();
+        }
+
+    };
+
+    typedef test_group<test_capigeosclipbyrect_data> group;
+    typedef group::object object;
+
+    group test_capigeosclipbyrect_group("capi::GEOSClipByRect");
+
+    //
+    // Test Cases
+    //
+
+    // Polygon crossing the rectangle
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        geom1_ = GEOSGeomFromWKT("POLYGON((-5 -5, 5 -5, 5 5, -5 5, -5 -5))");
+        geom2_ = GEOSGeomFromWKT("POLYGON((0 0, 5 0, 5 5, 0 5, 0 0))");
+        geom3_ = GEOSClipByRect(geom1_, 0, 0, 10, 10);
+
+        ensure(0 != geom3_);
+        ensure_equals(GEOSEquals(geom3_, geom2_), 1);
+    }
+
+    // Line crossing the rectangle twice
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        geom1_ = GEOSGeomFromWKT("LINESTRING(-5 2, 5 2, 5 20, 6 20, 6 2, 20 2)");
+        geom2_ = GEOSGeomFromWKT("MULTILINESTRING((0 2, 5 2, 5 10), (6 10, 6 2, 10 2))");
+        geom3_ = GEOSClipByRect(geom1_, 0, 0, 10, 10);
+
+        ensure(0 != geom3_);
+        ensure_equals(GEOSEquals(geom3_, geom2_), 1);
+    }
+
+    // Disjoint from the rectangle
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        geom1_ = GEOSGeomFromWKT("POINT(20 20)");
+        geom3_ = GEOSClipByRect(geom1_, 0, 0, 10, 10);
+
+        ensure(0 != geom3_);
+        ensure_equals(GEOSisEmpty(geom3_), 1);
+    }
+
+} // namespace tut
+
@@ -0,0 +1,103 @@
+//
+// Test Suite for C-API GEOSCoverageUnion
+
+#include <tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used in test cases.
+    struct test_capigeoscoverageunion_data
+    {
+        GEOSGeometry* geom1_;
+        GEOSGeometry* geom2_;
+        GEOSGeometry* geom3_;
+
+        static void notice(const char *fmt, ...)
+        {
+            std::fprintf( stdout, "NOTICE: ");
+
+            va_list ap;
+            va_start(ap, fmt);
+            std::vfprintf(stdout, fmt, ap);
+            va_end(ap);
+
+            std::fprintf(stdout, "\n");
+        }
+
+        test_capigeoscoverageunion_data()
+            : geom1_(0), geom2_(0), geom3_(0)
+        {
+            initGEOS(notice, notice);
+        }
+
+        ~test_capigeoscoverageunion_data()
+        {
+            GEOSGeom_destroy(geom1_);
+            GEOSGeom_destroy(geom2_);
+            GEOSGeom_destroy(geom3_);
+            geom1_ = 0;
+            geom2_ = 0;
+            geom3_ = 0;
+            finishGEOS();
+        }
+
+    };
+
+    typedef test_group<test_capigeoscoverageunion_data> group;
+    typedef group::object object;
+
+    group test_capigeoscoverageunion_group("capi::GEOSCoverageUnion");
+
+    //
+    // Test Cases
+    //
+
+    // Adjacent squares
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        geom1_ = GEOSGeomFromWKT("MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)),"
+                                 "((1 0, 2 0, 2 1, 1 1, 1 0)))");
+        geom2_ = GEOSGeomFromWKT("POLYGON((0 0, 2 0, 2 1, 0 1, 0 0))");
+        geom3_ = GEOSCoverageUnion(geom1_, 0);
+
+        ensure(0 != geom3_);
+        ensure_equals(GEOSEquals(geom3_, geom2_), 1);
+    }
+
+    // Overlapping squares are rejected when validating
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        geom1_ = GEOSGeomFromWKT("MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)),"
+                                 "((1 1, 3 1, 3 3, 1 3, 1 1)))");
+        geom3_ = GEOSCoverageUnion(geom1_, 1);
+
+        ensure(0 == geom3_);
+    }
+
+    // Non polygonal input
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        geom1_ = GEOSGeomFromWKT("LINESTRING(0 0, 1 1)");
+        geom3_ = GEOSCoverageUnion(geom1_, 0);
+
+        ensure(0 == geom3_);
+    }
+
+} // namespace tut
+
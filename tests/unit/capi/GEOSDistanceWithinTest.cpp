@@ -0,0 +1,159 @@
+// $Id$
+// 
+// Test Suite for C-API GEOSDistanceWithin
+
+#include <tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used in test cases.
+    struct test_capigeosdistancewithin_data
+    {
+        GEOSGeometry* geom1_;
+        GEOSGeometry* geom2_;
+
+        static void notice(const char *fmt, ...)
+        {
+            std::fprintf( stdout, "NOTICE: ");
+
+            va_list ap;
+            va_start(ap, fmt);
+            std::vfprintf(stdout, fmt, ap);
+            va_end(ap);
+        
+            std::fprintf(stdout, "\n");
+        }
+
+        test_capigeosdistancewithin_data()
+            : geom1_(0), geom2_(0)
+        {
+            initGEOS(notice, notice);
+        }       
+
+        ~test_capigeosdistancewithin_data()
+        {
+            GEOSGeom_destroy(geom1_);
+            GEOSGeom_destroy(geom2_);
+            geom1_ = 0;
+            geom2_ = 0;
+            finishGEOS();
+        }
+
+        // Checks GEOSDistanceWithin against GEOSDistance, both ways
+        void checkAgainstDistance(double dist)
+        {
+            double d;
+            ensure_equals(GEOSDistance(geom1_, geom2_, &d), 1);
+
+            char const expected = d <= dist;
+            ensure_equals(GEOSDistanceWithin(geom1_, geom2_, dist), expected);
+            ensure_equals(GEOSDistanceWithin(geom2_, geom1_, dist), expected);
+        }
+
+    };
+
+    typedef test_group<test_capigeosdistancewithin_data> group;
+    typedef group::object object;
+
+    group test_capigeosdistancewithin_group("capi::GEOSDistanceWithin");
+
+    //
+    // Test Cases
+    //
+
+    // 1 - Points and lines, on both sides of the distance
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        geom1_ = GEOSGeomFromWKT("LINESTRING(0 0, 10 0, 10 10)");
+        geom2_ = GEOSGeomFromWKT("POINT(5 3)");
+
+        ensure( 0 != geom1_ );
+        ensure( 0 != geom2_ );
+
+        ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 3), 1);
+        ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 2.9), 0);
+        ensure_equals(GEOSDistanceWithin(geom2_, geom1_, 3), 1);
+        ensure_equals(GEOSDistanceWithin(geom2_, geom1_, 2.9), 0);
+    }
+
+    // 2 - Envelopes intersecting but geometries apart, and a point
+    //     inside a polygon
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        geom1_ = GEOSGeomFromWKT(
+            "POLYGON((0 0, 20 0, 20 20, 0 20, 0 0), (2 2, 18 2, 18 18, 2 18, 2 2))");
+        geom2_ = GEOSGeomFromWKT("LINESTRING(5 5, 15 10)");
+
+        ensure( 0 != geom1_ );
+        ensure( 0 != geom2_ );
+
+        checkAgainstDistance(2);
+        checkAgainstDistance(3);
+        checkAgainstDistance(0);
+
+        GEOSGeom_destroy(geom2_);
+        geom2_ = GEOSGeomFromWKT("POINT(1 1)");
+        ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 0), 1);
+    }
+
+    // 3 - Empty geometries are at distance 0
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        geom1_ = GEOSGeomFromWKT("POINT EMPTY");
+        geom2_ = GEOSGeomFromWKT("POINT(100 100)");
+
+        ensure( 0 != geom1_ );
+        ensure( 0 != geom2_ );
+
+        ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 0), 1);
+        ensure_equals(GEOSDistanceWithin(geom2_, geom1_, 1), 1);
+        checkAgainstDistance(0);
+    }
+
+    // 4 - Larger lines, using the indexed facet distance
+    template<>
+    template<>
+    void object::test<4>()
+    {
+        GEOSGeometry* center = GEOSGeomFromWKT("POINT(0 0)");
+        ensure( 0 != center );
+        geom1_ = GEOSBuffer(center, 100, 64);
+        geom2_ = GEOSBuffer(center, 90, 32);
+        GEOSGeom_destroy(center);
+
+        GEOSGeometry* ring = GEOSBoundary(geom2_);
+        GEOSGeom_destroy(geom2_);
+        geom2_ = ring;
+
+        ensure( 0 != geom1_ );
+        ensure( 0 != geom2_ );
+
+        // the ring is inside the polygon
+        ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 0), 1);
+
+        GEOSGeometry* outer = GEOSBoundary(geom1_);
+        GEOSGeom_destroy(geom1_);
+        geom1_ = outer;
+
+        checkAgainstDistance(9.9);
+        checkAgainstDistance(10.1);
+    }
+
+} // namespace tut
+
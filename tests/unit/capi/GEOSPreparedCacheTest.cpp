@@ -0,0 +1,177 @@
+// $Id$
+//
+// Test Suite for C-API GEOSPreparedCache_*
+
+#include <tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used in test cases.
+    struct test_capipreparedcache_data
+    {
+        GEOSContextHandle_t handle_;
+
+        static void notice(const char *fmt, ...)
+        {
+            std::fprintf( stdout, "NOTICE: ");
+
+            va_list ap;
+            va_start(ap, fmt);
+            std::vfprintf(stdout, fmt, ap);
+            va_end(ap);
+
+            std::fprintf(stdout, "\n");
+        }
+
+        test_capipreparedcache_data()
+        {
+            handle_ = initGEOS_r(notice, notice);
+        }
+
+        ~test_capipreparedcache_data()
+        {
+            finishGEOS_r(handle_);
+        }
+
+        GEOSGeometry* read(const char* wkt)
+        {
+            GEOSWKTReader* reader = GEOSWKTReader_create_r(handle_);
+            GEOSGeometry* g = GEOSWKTReader_read_r(handle_, reader, wkt);
+            GEOSWKTReader_destroy_r(handle_, reader);
+            return g;
+        }
+    };
+
+    typedef test_group<test_capipreparedcache_data> group;
+    typedef group::object object;
+
+    group test_capipreparedcache_group("capi::GEOSPreparedCache");
+
+    //
+    // Test Cases
+    //
+
+    // Predicates give the same results with the cache, which
+    // prepares the repeated left hand geometry
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        ensure_equals(GEOSPreparedCache_setLimits_r(handle_, 8, 0), 1);
+
+        GEOSGeometry* poly = read("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))");
+        GEOSGeometry* in = read("POINT(5 5)");
+        GEOSGeometry* out = read("POINT(15 5)");
+        GEOSGeometry* edge = read("POINT(10 5)");
+
+        for (int i=0; i<3; ++i)
+        {
+            ensure_equals(GEOSIntersects_r(handle_, poly, in), 1);
+            ensure_equals(GEOSIntersects_r(handle_, poly, out), 0);
+            ensure_equals(GEOSDisjoint_r(handle_, poly, out), 1);
+            ensure_equals(GEOSContains_r(handle_, poly, in), 1);
+            ensure_equals(GEOSContains_r(handle_, poly, edge), 0);
+            ensure_equals(GEOSCovers_r(handle_, poly, edge), 1);
+        }
+
+        size_t hits, misses, entries;
+        ensure_equals(GEOSPreparedCache_getStats_r(handle_, &hits, &misses,
+                                                   &entries), 1);
+        ensure_equals(hits, 16u);
+        ensure_equals(misses, 2u);
+        ensure_equals(entries, 1u);
+
+        // destroyed geometries leave the cache
+        GEOSGeom_destroy_r(handle_, poly);
+        GEOSPreparedCache_getStats_r(handle_, 0, 0, &entries);
+        ensure_equals(entries, 0u);
+
+        GEOSGeom_destroy_r(handle_, in);
+        GEOSGeom_destroy_r(handle_, out);
+        GEOSGeom_destroy_r(handle_, edge);
+    }
+
+    // Invalidation and disabling
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        size_t hits = 1, entries = 1;
+        GEOSPreparedCache_getStats_r(handle_, &hits, 0, &entries);
+        ensure_equals(hits, 0u);
+        ensure_equals(entries, 0u);
+
+        GEOSPreparedCache_setLimits_r(handle_, 8, 0);
+        GEOSGeometry* a = read("LINESTRING(0 0, 10 10)");
+        GEOSGeometry* b = read("LINESTRING(0 10, 10 0)");
+        ensure_equals(GEOSIntersects_r(handle_, a, b), 1);
+        ensure_equals(GEOSIntersects_r(handle_, b, a), 1);
+        GEOSPreparedCache_getStats_r(handle_, 0, 0, &entries);
+        ensure_equals(entries, 2u);
+
+        GEOSPreparedCache_invalidate_r(handle_, a);
+        GEOSPreparedCache_getStats_r(handle_, 0, 0, &entries);
+        ensure_equals(entries, 1u);
+
+        GEOSPreparedCache_invalidate_r(handle_, 0);
+        GEOSPreparedCache_getStats_r(handle_, 0, 0, &entries);
+        ensure_equals(entries, 0u);
+
+        ensure_equals(GEOSPreparedCache_setLimits_r(handle_, 0, 0), 1);
+        ensure_equals(GEOSIntersects_r(handle_, a, b), 1);
+
+        GEOSGeom_destroy_r(handle_, a);
+        GEOSGeom_destroy_r(handle_, b);
+    }
+
+    // Geometries modified in place are not mistaken for their
+    // cached form
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        GEOSPreparedCache_setLimits_r(handle_, 8, 0);
+        GEOSGeometry* poly = read("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))");
+        GEOSGeometry* in = read("POINT(5 5)");
+        ensure_equals(GEOSContains_r(handle_, poly, in), 1);
+        ensure_equals(GEOSContains_r(handle_, poly, in), 1);
+
+        // normalized geometries leave the cache
+        size_t entries;
+        ensure_equals(GEOSNormalize_r(handle_, poly), 0);
+        GEOSPreparedCache_getStats_r(handle_, 0, 0, &entries);
+        ensure_equals(entries, 0u);
+        ensure_equals(GEOSContains_r(handle_, poly, in), 1);
+        ensure_equals(GEOSContains_r(handle_, poly, in), 1);
+
+        // moving the vertices at x=10 to x=4, same type, number of
+        // points and (stale) envelope
+        GEOSCoordSequence* cs = const_cast<GEOSCoordSequence*>(
+            GEOSGeom_getCoordSeq_r(handle_,
+                GEOSGetExteriorRing_r(handle_, poly)));
+        unsigned int size;
+        GEOSCoordSeq_getSize_r(handle_, cs, &size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            double x;
+            GEOSCoordSeq_getX_r(handle_, cs, i, &x);
+            if ( x == 10 ) GEOSCoordSeq_setX_r(handle_, cs, i, 4);
+        }
+        ensure_equals(GEOSContains_r(handle_, poly, in), 0);
+        ensure_equals(GEOSContains_r(handle_, poly, in), 0);
+
+        GEOSGeom_destroy_r(handle_, poly);
+        GEOSGeom_destroy_r(handle_, in);
+    }
+
+} // namespace tut
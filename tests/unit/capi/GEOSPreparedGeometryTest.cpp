@@ -171,6 +171,67 @@ namespace tut
 
     }
 
+    // Test PreparedContainsXY_array, polygonal and not
+    template<>
+    template<>
+    void object::test<7>()
+    {
+    geom1_ = GEOSGeomFromWKT("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING(0 0, 10 0)");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    prepGeom2_ = GEOSPrepare(geom2_);
+
+    const double x[] = { 1, 5, 10, 20, 3, 0 };
+    const double y[] = { 1, 5, 5, 5, 0, 0 };
+    const char expected1[] = { 1, 0, 0, 0, 0, 0 };
+    const char expected2[] = { 0, 0, 0, 0, 1, 0 };
+
+    char result[6];
+    for (unsigned int threads = 0; threads < 3; ++threads)
+    {
+        ensure_equals(GEOSPreparedContainsXY_array(prepGeom1_, x, y, 6,
+                                                   result, threads), 1);
+        for (int i = 0; i < 6; ++i)
+            ensure_equals(result[i], expected1[i]);
+    }
+
+    ensure_equals(GEOSPreparedContainsXY_array(prepGeom2_, x, y, 6,
+                                               result, 1), 1);
+    for (int i = 0; i < 6; ++i)
+        ensure_equals(result[i], expected2[i]);
+    }
+
+    // Test PreparedDistance and PreparedDistanceWithin
+    template<>
+    template<>
+    void object::test<8>()
+    {
+    geom1_ = GEOSGeomFromWKT("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING(13 0, 13 10)");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    double dist = -1;
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, geom2_, &dist), 1);
+    ensure_equals(dist, 3.0);
+
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 3.0), 1);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 2.9), 0);
+
+    GEOSGeometry* inside = GEOSGeomFromWKT("POINT(2 3)");
+    GEOSGeometry* inHole = GEOSGeomFromWKT("POINT(5 5.5)");
+
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, inside, &dist), 1);
+    ensure_equals(dist, 0.0);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, inside, 0.0), 1);
+
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, inHole, &dist), 1);
+    ensure_equals(dist, 0.5);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, inHole, 0.4), 0);
+
+    GEOSGeom_destroy(inside);
+    GEOSGeom_destroy(inHole);
+    }
+
     // TODO: add lots of more tests
     
 } // namespace tut
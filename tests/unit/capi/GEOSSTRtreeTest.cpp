@@ -0,0 +1,184 @@
+// $Id$
+//
+// Test Suite for C-API GEOSSTRtree_*
+
+#include <tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used in test cases.
+    struct test_capistrtree_data
+    {
+        GEOSSTRtree* tree_;
+        std::vector<GEOSGeometry*> geoms_;
+
+        static void notice(const char *fmt, ...)
+        {
+            std::fprintf( stdout, "NOTICE: ");
+
+            va_list ap;
+            va_start(ap, fmt);
+            std::vfprintf(stdout, fmt, ap);
+            va_end(ap);
+
+            std::fprintf(stdout, "\n");
+        }
+
+        test_capistrtree_data()
+            : tree_(0)
+        {
+            initGEOS(notice, notice);
+            tree_ = GEOSSTRtree_create(4);
+        }
+
+        // Inserts a point at x,y, using the point itself as item
+        GEOSGeometry* addPoint(double x, double y)
+        {
+            GEOSCoordSequence* cs = GEOSCoordSeq_create(1, 2);
+            GEOSCoordSeq_setX(cs, 0, x);
+            GEOSCoordSeq_setY(cs, 0, y);
+            GEOSGeometry* g = GEOSGeom_createPoint(cs);
+            geoms_.push_back(g);
+            GEOSSTRtree_insert(tree_, g, g);
+            return g;
+        }
+
+        ~test_capistrtree_data()
+        {
+            GEOSSTRtree_destroy(tree_);
+            for (std::size_t i=0; i<geoms_.size(); ++i)
+                GEOSGeom_destroy(geoms_[i]);
+            finishGEOS();
+        }
+
+    };
+
+    typedef test_group<test_capistrtree_data> group;
+    typedef group::object object;
+
+    group test_capistrtree_group("capi::GEOSSTRtree");
+
+    // Distance along x only, counting invocations in userdata
+    static int xDistance(const void* item1, const void* item2,
+                         double* distance, void* userdata)
+    {
+        double x1, x2;
+        GEOSGeomGetX(static_cast<const GEOSGeometry*>(item1), &x1);
+        GEOSGeomGetX(static_cast<const GEOSGeometry*>(item2), &x2);
+        *distance = x1 > x2 ? x1 - x2 : x2 - x1;
+        ++*static_cast<int*>(userdata);
+        return 1;
+    }
+
+    static int failingDistance(const void*, const void*, double*, void*)
+    {
+        return 0;
+    }
+
+    //
+    // Test Cases
+    //
+
+    // Nearest neighbour using geometry distance
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        for (int i=0; i<10; ++i)
+            for (int j=0; j<10; ++j)
+                addPoint(i*10, j*10);
+
+        GEOSGeometry* expected = geoms_[3*10+4];
+
+        GEOSGeometry* q = GEOSGeomFromWKT("POINT(31 42)");
+        const void* found = GEOSSTRtree_nearest(tree_, q, q, 0, 0);
+        ensure(found == expected);
+
+        const void* k[3];
+        int n = GEOSSTRtree_nearestK(tree_, q, q, 0, 0, 3, -1, k);
+        ensure_equals(n, 3);
+        ensure(k[0] == expected);
+
+        n = GEOSSTRtree_nearestK(tree_, q, q, 0, 0, 3, 5.0, k);
+        ensure_equals(n, 1);
+
+        GEOSGeom_destroy(q);
+    }
+
+    // Nearest neighbour using a callback
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        for (int i=0; i<100; ++i)
+            addPoint(i, 0);
+
+        GEOSGeometry* q = GEOSGeomFromWKT("POINT(57.2 0)");
+        int calls = 0;
+        const void* found = GEOSSTRtree_nearest(tree_, q, q, xDistance, &calls);
+        ensure(found == geoms_[57]);
+        ensure(calls < 20);
+
+        // errors in the callback are reported
+        found = GEOSSTRtree_nearest(tree_, q, q, failingDistance, 0);
+        ensure(found == 0);
+        const void* k[1];
+        ensure_equals(GEOSSTRtree_nearestK(tree_, q, q, failingDistance, 0,
+                                           1, -1, k), -1);
+
+        GEOSGeom_destroy(q);
+    }
+
+    // Empty tree
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        GEOSGeometry* q = GEOSGeomFromWKT("POINT(0 0)");
+        ensure(GEOSSTRtree_nearest(tree_, q, q, 0, 0) == 0);
+        GEOSGeom_destroy(q);
+    }
+
+    // Batch query
+    template<>
+    template<>
+    void object::test<4>()
+    {
+        for (int i=0; i<10; ++i)
+            for (int j=0; j<10; ++j)
+                addPoint(i, j);
+
+        GEOSGeometry* q[3];
+        q[0] = GEOSGeomFromWKT("POLYGON((-0.5 -0.5, 1.5 -0.5, 1.5 0.5, -0.5 0.5, -0.5 -0.5))");
+        q[1] = GEOSGeomFromWKT("POINT(20 20)");
+        q[2] = GEOSGeomFromWKT("POINT(4 5)");
+
+        size_t* offsets = 0;
+        void** items = 0;
+        int ret = GEOSSTRtree_queryBatch(tree_, q, 3, 2, &offsets, &items);
+        ensure_equals(ret, 1);
+        ensure_equals(offsets[0], 0u);
+        ensure_equals(offsets[1], 2u);
+        ensure_equals(offsets[2], 2u);
+        ensure_equals(offsets[3], 3u);
+        ensure(items[2] == geoms_[4*10+5]);
+
+        GEOSFree(offsets);
+        GEOSFree(items);
+        for (int i=0; i<3; ++i)
+            GEOSGeom_destroy(q[i]);
+    }
+
+} // namespace tut
+
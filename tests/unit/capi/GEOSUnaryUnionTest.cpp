@@ -193,5 +193,22 @@ namespace tut
 ));
     }
 
+    // Parallel union of overlapping polygons
+    template<>
+    template<>
+    void object::test<9>()
+    {
+        geom1_ = GEOSGeomFromWKT("MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((1 1, 3 1, 3 3, 1 3, 1 1)), ((10 10, 11 10, 11 11, 10 11, 10 10)))");
+        ensure( 0 != geom1_ );
+
+        geom2_ = GEOSUnaryUnionParallel(geom1_, 4);
+        ensure( 0 != geom2_ );
+
+        GEOSGeometry* sequential = GEOSUnaryUnion(geom1_);
+        ensure( 0 != sequential );
+        ensure( GEOSEqualsExact(geom2_, sequential, 0) );
+        GEOSGeom_destroy(sequential);
+    }
+
 } // namespace tut
 
@@ -0,0 +1,96 @@
+// $Id$
+//
+// Test Suite for geos::geom::CoordinateHashMap class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/geom/CoordinateHashMap.h>
+#include <geos/geom/Coordinate.h>
+// std
+#include <vector>
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_coordinatehashmap_data
+	{
+		typedef geos::geom::CoordinateHashMap<int*> Map;
+		typedef geos::geom::Coordinate Coordinate;
+
+		std::vector<int> values;
+
+		test_coordinatehashmap_data() : values(1000) {}
+	};
+
+	typedef test_group<test_coordinatehashmap_data> group;
+	typedef group::object object;
+
+	group test_coordinatehashmap_group("geos::geom::CoordinateHashMap");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Insert and find, the first value at a location is kept
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		Map m;
+		ensure(m.find(Coordinate(0, 0)) == 0);
+
+		for (int i=0; i<1000; ++i)
+			ensure(m.insert(Coordinate(i % 40, i / 40), &values[i]) == &values[i]);
+		ensure_equals(m.size(), 1000u);
+
+		for (int i=0; i<1000; ++i)
+			ensure(m.find(Coordinate(i % 40, i / 40, 5)) == &values[i]);
+		ensure(m.find(Coordinate(0.5, 0)) == 0);
+
+		ensure(m.insert(Coordinate(3, 0), &values[0]) == &values[3]);
+		ensure_equals(m.size(), 1000u);
+	}
+
+	// 2 - Negative zero is the same location as zero
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		Map m;
+		m.insert(Coordinate(-0.0, 1), &values[0]);
+		ensure(m.find(Coordinate(0.0, 1)) == &values[0]);
+		ensure(m.find(Coordinate(-0.0, 1)) == &values[0]);
+	}
+
+	// 3 - Removal keeps the other entries reachable
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		Map m;
+		for (int i=0; i<1000; ++i)
+			m.insert(Coordinate(i * 0.1, -i), &values[i]);
+
+		for (int i=0; i<1000; i+=3)
+			ensure(m.remove(Coordinate(i * 0.1, -i)) == &values[i]);
+		ensure(m.remove(Coordinate(0, 0)) == 0);
+
+		for (int i=0; i<1000; ++i)
+		{
+			int* expected = (i % 3) ? &values[i] : 0;
+			ensure(m.find(Coordinate(i * 0.1, -i)) == expected);
+		}
+		ensure_equals(m.size(), 666u);
+
+		m.clear();
+		ensure(m.empty());
+		ensure(m.find(Coordinate(0.1, -1)) == 0);
+	}
+
+} // namespace tut
+
@@ -191,5 +191,23 @@ namespace tut
         ensure( 0 != ISNAN( null_coord.z ) );
     }
 
+    // Test of getZ/setZ
+    template<>
+    template<>
+    void object::test<10>()
+    {
+        geos::geom::Coordinate coord(x, y);
+        ensure( 0 != ISNAN( coord.getZ() ) );
+
+        coord.setZ(z);
+#ifdef GEOS_COORDINATE_2D
+        ensure( 0 != ISNAN( coord.getZ() ) );
+        ensure_equals( sizeof(geos::geom::Coordinate), 2*sizeof(double) );
+#else
+        ensure_equals( coord.getZ(), z );
+        ensure_equals( coord.z, z );
+#endif
+    }
+
 } // namespace tut
 
@@ -0,0 +1,243 @@
+// $Id$
+// 
+// Test Suite for geos::geom::OrdinateArraySequence class.
+
+#include <tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/OrdinateArraySequence.h>
+#include <geos/geom/OrdinateArraySequenceFactory.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/io/WKTReader.h>
+#include <geos/algorithm/CGAlgorithms.h>
+#include <geos/platform.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TaskRunner.h>
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateSequence;
+using geos::geom::OrdinateArraySequence;
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used by tests
+    struct test_ordinatearraysequence_data
+    {
+        std::vector<Coordinate> coords;
+
+        test_ordinatearraysequence_data()
+        {
+            // a 10x10 square ring, counter-clockwise
+            coords.push_back(Coordinate(0, 0));
+            coords.push_back(Coordinate(10, 0));
+            coords.push_back(Coordinate(10, 10));
+            coords.push_back(Coordinate(0, 10));
+            coords.push_back(Coordinate(0, 0));
+        }
+    };
+
+    typedef test_group<test_ordinatearraysequence_data> group;
+    typedef group::object object;
+
+    group test_ordinatearraysequence_group("geos::geom::OrdinateArraySequence");
+
+    //
+    // Test Cases
+    //
+
+    // 1 - Empty sequence
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        OrdinateArraySequence sequence;
+        ensure( sequence.isEmpty() );
+        ensure_equals( sequence.size(), 0u );
+        ensure_equals( sequence.toString(), std::string("()") );
+        ensure_equals( sequence.getDimension(), 2u );
+
+        CoordinateSequence::OrdinateSpan span;
+        ensure( sequence.getOrdinateSpan(span) );
+        ensure_equals( span.size, 0u );
+    }
+
+    // 2 - Z is only stored when present
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        OrdinateArraySequence sequence(coords);
+        ensure_equals( sequence.size(), coords.size() );
+        ensure_equals( sequence.getDimension(), 2u );
+        ensure( sequence.getZArray() == 0 );
+        ensure( ISNAN(sequence.getAt(1).z) );
+
+        sequence.setOrdinate(1, CoordinateSequence::Z, 5.0);
+        ensure_equals( sequence.getDimension(), 3u );
+        ensure( sequence.getZArray() != 0 );
+        ensure_equals( sequence.getAt(1).z, 5.0 );
+        ensure( ISNAN(sequence.getOrdinate(2, CoordinateSequence::Z)) );
+
+        sequence.add(Coordinate(1, 2, 3));
+        ensure_equals( sequence.getOrdinate(5, CoordinateSequence::Z), 3.0 );
+    }
+
+    // 3 - References stay in sync with the arrays
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        OrdinateArraySequence sequence(coords);
+        const Coordinate& c = sequence.getAt(2);
+        ensure_equals( c.x, 10.0 );
+
+        sequence.setAt(Coordinate(7, 8), 2);
+        ensure_equals( c.x, 7.0 );
+        ensure_equals( sequence.getX(2), 7.0 );
+
+        sequence.setOrdinate(2, CoordinateSequence::Y, 9.0);
+        ensure_equals( c.y, 9.0 );
+
+        const std::vector<Coordinate>* v = sequence.toVector();
+        ensure_equals( v->size(), coords.size() );
+        ensure( (*v)[2] == Coordinate(7, 9) );
+    }
+
+    // 4 - Insert, delete, remove repeated points
+    template<>
+    template<>
+    void object::test<4>()
+    {
+        OrdinateArraySequence sequence(coords);
+
+        sequence.add(1, Coordinate(0, 0), false); // repeated, skipped
+        ensure_equals( sequence.size(), 5u );
+        sequence.add(1, Coordinate(5, 0), false);
+        ensure_equals( sequence.size(), 6u );
+        ensure_equals( sequence.getX(1), 5.0 );
+
+        sequence.deleteAt(1);
+        ensure_equals( sequence.size(), 5u );
+
+        sequence.add(Coordinate(0, 0), true);
+        sequence.add(Coordinate(0, 0), false);
+        ensure_equals( sequence.size(), 6u );
+        sequence.removeRepeatedPoints();
+        ensure_equals( sequence.size(), 5u );
+
+        geos::geom::CoordinateArraySequence expected(
+                new std::vector<Coordinate>(coords));
+        ensure( CoordinateSequence::equals(&sequence, &expected) );
+    }
+
+    // 5 - Algorithms see the same values through ordinate filters
+    template<>
+    template<>
+    void object::test<5>()
+    {
+        using geos::algorithm::CGAlgorithms;
+
+        OrdinateArraySequence soa(coords);
+        geos::geom::CoordinateArraySequence aos(
+                new std::vector<Coordinate>(coords));
+
+        ensure_equals( CGAlgorithms::signedArea(&soa), -100.0 );
+        ensure_equals( CGAlgorithms::signedArea(&aos), -100.0 );
+        ensure_equals( CGAlgorithms::length(&soa), 40.0 );
+        ensure_equals( CGAlgorithms::length(&aos), 40.0 );
+
+        ensure( CGAlgorithms::isPointInRing(Coordinate(5, 5), &soa) );
+        ensure( ! CGAlgorithms::isPointInRing(Coordinate(15, 5), &soa) );
+
+        geos::geom::Envelope env;
+        soa.expandEnvelope(env);
+        ensure( env == geos::geom::Envelope(0, 10, 0, 10) );
+    }
+
+    // 6 - Geometries built by a factory using the sequence
+    template<>
+    template<>
+    void object::test<6>()
+    {
+        geos::geom::PrecisionModel pm;
+        geos::geom::GeometryFactory factory(&pm, 0,
+            const_cast<geos::geom::CoordinateSequenceFactory*>(
+                geos::geom::OrdinateArraySequenceFactory::instance()));
+        geos::io::WKTReader reader(&factory);
+
+        std::auto_ptr<geos::geom::Geometry> g1( reader.read(
+            "POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))") );
+        std::auto_ptr<geos::geom::Geometry> g2( reader.read(
+            "POLYGON((5 5, 15 5, 15 15, 5 15, 5 5))") );
+        std::auto_ptr<geos::geom::Geometry> pt( reader.read(
+            "POINT(2 3)") );
+
+        ensure_equals( g1->getArea(), 100.0 );
+        ensure( g1->contains(pt.get()) );
+
+        std::auto_ptr<geos::geom::Geometry> i( g1->intersection(g2.get()) );
+        ensure_equals( i->getArea(), 25.0 );
+    }
+
+    // Reads the sequence through the reference-returning interface
+    struct ReadTask: public geos::util::TaskRunner::Task
+    {
+        const OrdinateArraySequence& seq;
+        std::vector<double> sums;
+
+        ReadTask(const OrdinateArraySequence& s, std::size_t n)
+            : seq(s), sums(n, 0.0)
+        {}
+
+        void run(std::size_t index)
+        {
+            for (std::size_t i = 0, n = seq.size(); i < n; ++i)
+                sums[index] += seq.getAt(i).x;
+        }
+    };
+
+    // 7 - Concurrent readers, and ordinate index errors
+    template<>
+    template<>
+    void object::test<7>()
+    {
+        std::vector<Coordinate> many;
+        for (int i = 0; i < 10000; ++i)
+            many.push_back(Coordinate(i, 0));
+
+        for (int round = 0; round < 10; ++round)
+        {
+            OrdinateArraySequence sequence(many);
+            ReadTask task(sequence, 8);
+            geos::util::TaskRunner(4).run(task, task.sums.size());
+            for (std::size_t i = 0; i < task.sums.size(); ++i)
+                ensure_equals( task.sums[i], 49995000.0 );
+        }
+
+        OrdinateArraySequence sequence(coords);
+        try {
+            sequence.setOrdinate(1, 7, 0.0);
+            fail("IllegalArgumentException expected");
+        }
+        catch (const geos::util::IllegalArgumentException& e)
+        {
+            ensure_equals( std::string(e.what()),
+                           "IllegalArgumentException: "
+                           "Unknown ordinate index 7" );
+        }
+    }
+
+} // namespace tut
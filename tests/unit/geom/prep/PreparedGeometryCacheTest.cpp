@@ -0,0 +1,164 @@
+// $Id$
+//
+// Test Suite for geos::geom::prep::PreparedGeometryCache class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/geom/prep/PreparedGeometryCache.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <sstream>
+
+using geos::geom::prep::PreparedGeometryCache;
+using geos::geom::prep::PreparedGeometry;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_preparedgeometrycache_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+
+		geos::io::WKTReader reader;
+
+		GeomPtr square(int x)
+		{
+			std::ostringstream s;
+			s << "POLYGON((" << x << " 0, " << x+1 << " 0, " << x+1 << " 1, "
+			  << x << " 1, " << x << " 0))";
+			return GeomPtr(reader.read(s.str()));
+		}
+	};
+
+	// Moves coordinates by one unit along X
+	struct ShiftFilter: public geos::geom::CoordinateFilter
+	{
+		void filter_rw(geos::geom::Coordinate* c) const { c->x += 1; }
+	};
+
+	typedef test_group<test_preparedgeometrycache_data> group;
+	typedef group::object object;
+
+	group test_preparedgeometrycache_group("geos::geom::prep::PreparedGeometryCache");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Geometries are prepared the second time they are seen
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		PreparedGeometryCache cache(10);
+		GeomPtr g = square(0);
+
+		ensure(cache.get(*g) == 0);
+		const PreparedGeometry* p = cache.get(*g);
+		ensure(p != 0);
+		ensure(p->getGeometry().equalsExact(g.get()));
+		ensure(cache.get(*g) == p);
+
+		ensure_equals(cache.getHits(), 1u);
+		ensure_equals(cache.getMisses(), 2u);
+		ensure_equals(cache.getNumPoints(), 5u);
+
+		cache.invalidate(g.get());
+		ensure_equals(cache.size(), 0u);
+		ensure_equals(cache.getNumPoints(), 0u);
+		ensure(cache.get(*g) == 0);
+	}
+
+	// 2 - Least recently used entries are evicted first
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		PreparedGeometryCache cache(2);
+		GeomPtr a = square(0), b = square(2), c = square(4);
+
+		cache.get(*a);
+		cache.get(*b);
+		cache.get(*a); // a is now the most recently used
+		cache.get(*c); // evicts b
+		ensure_equals(cache.size(), 2u);
+		ensure(cache.get(*a) != 0);
+		ensure(cache.get(*b) == 0);
+
+		// point budget
+		cache.setLimits(10, 5);
+		ensure(cache.getNumPoints() <= 5u);
+		cache.get(*b);
+		ensure(cache.get(*b) != 0);
+		ensure_equals(cache.getNumPoints(), 5u);
+	}
+
+	// 3 - A geometry changed at the same address is not mistaken
+	//     for the cached one
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		PreparedGeometryCache cache(10);
+		GeomPtr g = square(0);
+		cache.get(*g);
+		ensure(cache.get(*g) != 0);
+
+		ShiftFilter shift;
+		g->apply_rw(&shift);
+		g->geometryChanged();
+		ensure(cache.get(*g) == 0);
+		ensure_equals(cache.size(), 1u);
+	}
+
+	// 4 - Invalidating a collection drops its components
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		PreparedGeometryCache cache(10);
+		GeomPtr g(reader.read(
+			"GEOMETRYCOLLECTION(POINT(0 0), POLYGON((0 0, 1 0, 1 1, 0 0)))"));
+		const geos::geom::Geometry* poly = g->getGeometryN(1);
+		cache.get(*poly);
+		cache.get(*poly);
+		ensure_equals(cache.size(), 1u);
+
+		cache.invalidate(g.get());
+		ensure_equals(cache.size(), 0u);
+	}
+
+	// 5 - Geometries modified in place keeping their envelope, or
+	//     destroyed, do not affect the prepared copies
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		PreparedGeometryCache cache(10);
+		GeomPtr g(reader.read("POLYGON((1 1, 1 0, 0 0, 0 1, 1 1))"));
+		cache.get(*g);
+		const PreparedGeometry* p = cache.get(*g);
+		ensure(p != 0);
+
+		g->normalize();
+		ensure(cache.get(*g) == 0);
+		ensure_equals(cache.size(), 1u);
+
+		p = cache.get(*g);
+		ensure(p != 0);
+		GeomPtr other = square(0);
+		g.reset();
+		ensure(p->contains(other.get()));
+	}
+
+} // namespace tut
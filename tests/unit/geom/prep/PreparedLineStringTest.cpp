@@ -0,0 +1,200 @@
+// $Id$
+//
+// Test Suite for the predicates of geos::geom::prep::PreparedLineString
+// and geos::geom::prep::PreparedPoint
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedLineString.h>
+#include <geos/geom/prep/PreparedPoint.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::prep::PreparedGeometry;
+using geos::geom::prep::PreparedGeometryFactory;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_preparedlinestring_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+		typedef std::auto_ptr<const PreparedGeometry> PrepGeomPtr;
+
+		geos::io::WKTReader reader;
+
+		// Checks the prepared predicates of target against the
+		// ones of the plain geometry, for each test geometry
+		void checkPredicates(const std::string& target,
+		                     const char* const* tests, std::size_t n)
+		{
+			GeomPtr g(reader.read(target));
+			PrepGeomPtr pg(PreparedGeometryFactory::prepare(g.get()));
+
+			for (std::size_t i=0; i<n; ++i)
+			{
+				GeomPtr t(reader.read(tests[i]));
+				std::string msg = target + " / " + tests[i];
+				ensure_equals(msg + " covers",
+				              pg->covers(t.get()), g->covers(t.get()));
+				ensure_equals(msg + " crosses",
+				              pg->crosses(t.get()), g->crosses(t.get()));
+				ensure_equals(msg + " touches",
+				              pg->touches(t.get()), g->touches(t.get()));
+				ensure_equals(msg + " disjoint",
+				              pg->disjoint(t.get()), g->disjoint(t.get()));
+				ensure_equals(msg + " intersects",
+				              pg->intersects(t.get()), g->intersects(t.get()));
+			}
+		}
+	};
+
+	typedef test_group<test_preparedlinestring_data> group;
+	typedef group::object object;
+
+	group test_preparedlinestring_group("geos::geom::prep::PreparedLineString");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Lines against points
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		const char* const tests[] = {
+			"POINT(0 0)", "POINT(5 0)", "POINT(10 0)", "POINT(10 5)",
+			"POINT(3 1)", "POINT(10 10)",
+			"MULTIPOINT(0 0, 5 0)", "MULTIPOINT(0 0, 3 3)",
+			"MULTIPOINT(5 0, 3 3)", "MULTIPOINT(0 0, 10 10)",
+			"MULTIPOINT(2 0, 10 2)", "MULTIPOINT(20 20, 30 30)"
+		};
+		const std::size_t n = sizeof(tests) / sizeof(tests[0]);
+
+		checkPredicates("LINESTRING(0 0, 10 0, 10 10)", tests, n);
+		checkPredicates("MULTILINESTRING((0 0, 10 0), (10 0, 10 10), (10 10, 5 5))", tests, n);
+		checkPredicates("LINEARRING(0 0, 10 0, 10 10, 0 0)", tests, n);
+	}
+
+	// 2 - Lines against lines: overlaps, crossings, touching at
+	//     boundaries and interiors
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		const char* const tests[] = {
+			"LINESTRING(0 0, 10 0)", "LINESTRING(2 0, 8 0)",
+			"LINESTRING(-5 0, 5 0)", "LINESTRING(0 0, 10 0, 10 10)",
+			"LINESTRING(10 10, 10 0, 0 0)", "LINESTRING(2 0, 10 0, 10 4)",
+			"LINESTRING(5 -5, 5 5)", "LINESTRING(5 0, 5 5)",
+			"LINESTRING(0 0, -5 -5)", "LINESTRING(10 10, 15 15)",
+			"LINESTRING(-5 5, 0 0, 5 5)", "LINESTRING(0 5, 10 5)",
+			"LINESTRING(20 0, 30 0)", "LINESTRING(0 0, 10 10)",
+			"LINESTRING(10 0, 20 0)", "LINESTRING(4 0, 4 0, 6 0)",
+			"LINESTRING(0 0, 5 0, 5 1, 6 1, 6 0, 10 0)",
+			"MULTILINESTRING((0 0, 5 0), (5 0, 10 0))",
+			"MULTILINESTRING((0 0, 5 0), (6 0, 10 0))",
+			"MULTILINESTRING((0 0, -1 -1), (10 10, 11 11))",
+			"MULTILINESTRING((0 0, -1 -1), (5 -1, 5 1))",
+			"LINEARRING(0 0, 5 -5, 10 0, 0 0)",
+			"LINEARRING(-1 -1, 11 -1, 11 11, -1 -1)"
+		};
+		const std::size_t n = sizeof(tests) / sizeof(tests[0]);
+
+		checkPredicates("LINESTRING(0 0, 10 0, 10 10)", tests, n);
+		checkPredicates("LINESTRING(0 0, 4 0, 7 0, 10 0)", tests, n);
+		checkPredicates("MULTILINESTRING((0 0, 5 0), (5 0, 10 0), (5 0, 5 5))", tests, n);
+		checkPredicates("MULTILINESTRING((0 0, 10 0), (0 0, 0 -5))", tests, n);
+		checkPredicates("LINEARRING(0 0, 10 0, 10 10, 0 10, 0 0)", tests, n);
+	}
+
+	// 3 - Areas and collections, left to relate
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		const char* const tests[] = {
+			"POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))",
+			"POLYGON((-1 -1, 11 -1, 11 11, -1 11, -1 -1))",
+			"POLYGON((2 -1, 4 -1, 4 1, 2 1, 2 -1))",
+			"GEOMETRYCOLLECTION(POINT(5 0), LINESTRING(10 0, 10 5))",
+			"LINESTRING EMPTY", "POINT EMPTY"
+		};
+		const std::size_t n = sizeof(tests) / sizeof(tests[0]);
+
+		checkPredicates("LINESTRING(0 0, 10 0, 10 10)", tests, n);
+	}
+
+	// 4 - Points against points, lines and areas
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		const char* const tests[] = {
+			"POINT(0 0)", "POINT(5 0)", "MULTIPOINT(0 0, 5 0)",
+			"MULTIPOINT(0 0, 5 5)", "POINT(1 1)",
+			"LINESTRING(0 0, 10 0)", "LINESTRING(-5 0, 5 0)",
+			"LINESTRING(5 0, 5 10)", "LINEARRING(0 0, 5 0, 5 5, 0 0)",
+			"MULTILINESTRING((0 0, 1 1), (1 1, 2 2))",
+			"POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))",
+			"POLYGON((-5 -5, 10 -5, 10 10, -5 10, -5 -5))",
+			"MULTIPOLYGON(((4 -1, 6 -1, 6 1, 4 1, 4 -1)), ((20 20, 21 20, 21 21, 20 20)))",
+			"GEOMETRYCOLLECTION(POINT(0 0), LINESTRING(0 0, 5 0))",
+			"POINT EMPTY"
+		};
+		const std::size_t n = sizeof(tests) / sizeof(tests[0]);
+
+		checkPredicates("POINT(0 0)", tests, n);
+		checkPredicates("POINT(5 0)", tests, n);
+		checkPredicates("MULTIPOINT(0 0, 5 0)", tests, n);
+		checkPredicates("MULTIPOINT(0 0, 20 20)", tests, n);
+	}
+
+	// 5 - A long wiggly line against many short lines and points
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		std::string target = "LINESTRING(";
+		for (int i=0; i<=100; ++i)
+		{
+			char buf[64];
+			std::sprintf(buf, "%s%d %d", i ? ", " : "", i, (i % 7) - 3);
+			target += buf;
+		}
+		target += ")";
+
+		std::vector<std::string> wkts;
+		for (int i=-2; i<=102; i+=3)
+		{
+			for (int j=-4; j<=4; j+=2)
+			{
+				char buf[128];
+				std::sprintf(buf, "LINESTRING(%d %d, %d %d)", i, j, i + 1, j + 1);
+				wkts.push_back(buf);
+				std::sprintf(buf, "POINT(%d %d)", i, j);
+				wkts.push_back(buf);
+			}
+		}
+
+		std::vector<const char*> tests;
+		for (std::size_t i=0; i<wkts.size(); ++i)
+			tests.push_back(wkts[i].c_str());
+		checkPredicates(target, &tests[0], tests.size());
+	}
+
+} // namespace tut
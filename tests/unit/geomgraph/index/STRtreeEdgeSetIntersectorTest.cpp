@@ -0,0 +1,153 @@
+// $Id$
+//
+// Test Suite for geos::geomgraph::index::STRtreeEdgeSetIntersector
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/geomgraph/index/STRtreeEdgeSetIntersector.h>
+#include <geos/geomgraph/index/EdgeSetIntersector.h>
+#include <geos/geomgraph/index/SegmentIntersector.h>
+#include <geos/geomgraph/GeometryGraph.h>
+#include <geos/geomgraph/NodeMap.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/overlay/OverlayOp.h>
+#include <geos/operation/relate/RelateOp.h>
+// std
+#include <memory>
+#include <sstream>
+#include <string>
+
+using geos::geomgraph::index::EdgeSetIntersector;
+using geos::operation::overlay::OverlayOp;
+using geos::operation::relate::RelateOp;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_strtreeedgesetintersector_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+
+		geos::io::WKTReader reader;
+
+		// A closed zig-zag line, whose segments all overlap in x
+		std::string zigzag(int n, double dy)
+		{
+			std::ostringstream os;
+			os << "LINESTRING(0 " << dy;
+			for (int i=1; i<n; ++i)
+				os << ", " << (i % 2) * 100 << " " << i + dy;
+			os << ", 0 " << dy << ")";
+			return os.str();
+		}
+
+		// Checks the sweep line and the tree give the same relate
+		// matrix and overlay
+		void checkSame(const std::string& wkt0, const std::string& wkt1)
+		{
+			GeomPtr g0(reader.read(wkt0));
+			GeomPtr g1(reader.read(wkt1));
+
+			RelateOp relateSweep(g0.get(), g1.get());
+			relateSweep.setEdgeSetIntersectorType(EdgeSetIntersector::SWEEPLINE);
+			RelateOp relateTree(g0.get(), g1.get());
+			relateTree.setEdgeSetIntersectorType(EdgeSetIntersector::STRTREE);
+			ensure_equals(relateTree.getIntersectionMatrix()->toString(),
+			              relateSweep.getIntersectionMatrix()->toString());
+
+			int ops[] = { OverlayOp::opINTERSECTION, OverlayOp::opUNION,
+			              OverlayOp::opDIFFERENCE };
+			for (int i=0; i<3; ++i)
+			{
+				OverlayOp overlaySweep(g0.get(), g1.get());
+				overlaySweep.setEdgeSetIntersectorType(EdgeSetIntersector::SWEEPLINE);
+				GeomPtr rSweep(overlaySweep.getResultGeometry(
+					OverlayOp::OpCode(ops[i])));
+				OverlayOp overlayTree(g0.get(), g1.get());
+				overlayTree.setEdgeSetIntersectorType(EdgeSetIntersector::STRTREE);
+				GeomPtr rTree(overlayTree.getResultGeometry(
+					OverlayOp::OpCode(ops[i])));
+				ensure(rTree->equalsExact(rSweep.get()));
+			}
+		}
+
+		// Number of nodes of the self-noded graph of g
+		std::size_t countSelfNodes(const geos::geom::Geometry& g,
+		                           EdgeSetIntersector::Type type)
+		{
+			geos::geomgraph::GeometryGraph graph(0, &g);
+			graph.setEdgeSetIntersectorType(type);
+			geos::algorithm::LineIntersector li;
+			std::auto_ptr<geos::geomgraph::index::SegmentIntersector> si(
+				graph.computeSelfNodes(li, true));
+			return graph.getNodeMap()->nodeMap.size();
+		}
+	};
+
+	typedef test_group<test_strtreeedgesetintersector_data> group;
+	typedef group::object object;
+
+	group test_strtreeedgesetintersector_group("geos::geomgraph::index::STRtreeEdgeSetIntersector");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Polygons and lines, the same as with the sweep line
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		checkSame("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2))",
+		          "POLYGON((5 -5, 15 5, 5 15, -5 5, 5 -5))");
+		checkSame("MULTIPOLYGON(((0 0, 4 0, 4 4, 0 4, 0 0)), ((6 0, 10 0, 10 4, 6 4, 6 0)))",
+		          "LINESTRING(-1 2, 11 2, 11 3, -1 3)");
+		checkSame("LINESTRING(0 0, 10 10, 20 0, 30 10)",
+		          "LINESTRING(0 10, 10 0, 20 10, 30 0)");
+		checkSame("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))",
+		          "POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))");
+	}
+
+	// 2 - Long edges, all overlapping in x
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		GeomPtr line0(reader.read(zigzag(200, 0)));
+		GeomPtr line1(reader.read(zigzag(200, 0.5)));
+		GeomPtr area0(line0->buffer(0.1));
+		GeomPtr area1(line1->buffer(0.1));
+		checkSame(line0->toString(), line1->toString());
+		checkSame(area0->toString(), area1->toString());
+	}
+
+	// 3 - Self nodes, with and without the default selection
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		GeomPtr line(reader.read(
+			"MULTILINESTRING((0 0, 100 1, 0 2, 100 3, 0 4, 50 -1),"
+			"(10 -1, 10 5), (20 5, 20 -1, 30 5))"));
+
+		std::size_t nodes = countSelfNodes(*line, EdgeSetIntersector::SWEEPLINE);
+		ensure(nodes > 10);
+		ensure_equals(countSelfNodes(*line, EdgeSetIntersector::STRTREE), nodes);
+		ensure_equals(countSelfNodes(*line, EdgeSetIntersector::AUTO), nodes);
+
+		GeomPtr many(reader.read(zigzag(600, 0)));
+		nodes = countSelfNodes(*many, EdgeSetIntersector::SWEEPLINE);
+		ensure_equals(countSelfNodes(*many, EdgeSetIntersector::STRTREE), nodes);
+		ensure_equals(countSelfNodes(*many, EdgeSetIntersector::AUTO), nodes);
+	}
+
+} // namespace tut
+
@@ -0,0 +1,308 @@
+// $Id$
+//
+// Test Suite for geos::index::strtree::PackedSTRtree class.
+
+#include <tut.hpp>
+// geos
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/AbstractSTRtree.h> // for ItemsList
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/index/ItemVisitor.h>
+#include <geos/geom/Envelope.h>
+// std
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace geos::index::strtree;
+using geos::geom::Envelope;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	struct test_packedstrtree_data
+	{
+		std::vector<Envelope> envs;
+		std::vector<int> ids;
+
+		test_packedstrtree_data()
+		{
+			// A 30x30 grid of unit squares
+			for (int i=0; i<30; ++i) {
+				for (int j=0; j<30; ++j) {
+					envs.push_back(Envelope(i, i+1, j, j+1));
+				}
+			}
+			ids.resize(envs.size());
+			for (std::size_t i=0; i<ids.size(); ++i) ids[i] = (int)i;
+		}
+
+		template <class Tree>
+		void fill(Tree& tree)
+		{
+			for (std::size_t i=0; i<envs.size(); ++i)
+				tree.insert(&envs[i], &ids[i]);
+		}
+
+		static std::vector<void*> sorted(std::vector<void*> v)
+		{
+			std::sort(v.begin(), v.end());
+			return v;
+		}
+	};
+
+	typedef test_group<test_packedstrtree_data> group;
+	typedef group::object object;
+
+	group test_packedstrtree_group("geos::index::strtree::PackedSTRtree");
+
+	struct CountingVisitor: public geos::index::ItemVisitor
+	{
+		std::size_t count;
+		CountingVisitor() : count(0) {}
+		void visitItem(void*) { ++count; }
+	};
+
+	// Distance between the centres of the squares of two ids
+	struct CentreDistance: public ItemDistance
+	{
+		std::vector<Envelope>& envs;
+		std::size_t calls;
+		CentreDistance(std::vector<Envelope>& e) : envs(e), calls(0) {}
+		double distance(const void* a, const void* b)
+		{
+			++calls;
+			const Envelope& ea = envs[*static_cast<const int*>(a)];
+			const Envelope& eb = envs[*static_cast<const int*>(b)];
+			geos::geom::Coordinate ca, cb;
+			ea.centre(ca);
+			eb.centre(cb);
+			return ca.distance(cb);
+		}
+	};
+
+	static std::size_t countItems(ItemsList* l)
+	{
+		std::size_t n = 0;
+		for (ItemsList::iterator i=l->begin(), e=l->end(); i!=e; ++i)
+		{
+			if ( i->get_type() == ItemsListItem::item_is_list )
+				n += countItems(i->get_itemslist());
+			else
+				++n;
+		}
+		return n;
+	}
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Empty tree
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		PackedSTRtree tree;
+		std::vector<void*> matches;
+		Envelope env(0, 10, 0, 10);
+		tree.query(&env, matches);
+		ensure(matches.empty());
+		ensure(!tree.remove(&env, &ids[0]));
+
+		std::auto_ptr<ItemsList> itree ( tree.itemsTree() );
+		ensure(itree->empty());
+	}
+
+	// 2 - Query results match STRtree
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		PackedSTRtree ptree(4);
+		STRtree tree(4);
+		fill(ptree);
+		fill(tree);
+
+		Envelope queries[] = {
+			Envelope(0.5, 3.5, 0.5, 3.5),
+			Envelope(-10, -5, -10, -5),
+			Envelope(10, 10, 10, 10),
+			Envelope(-1, 40, 12.2, 12.4),
+			Envelope(29.5, 40, 29.5, 40)
+		};
+
+		for (std::size_t i=0; i<sizeof(queries)/sizeof(Envelope); ++i)
+		{
+			std::vector<void*> pm, m;
+			ptree.query(&queries[i], pm);
+			tree.query(&queries[i], m);
+			ensure_equals(pm.size(), m.size());
+			ensure(sorted(pm) == sorted(m));
+		}
+	}
+
+	// 3 - Visitor query and iterate
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		PackedSTRtree tree;
+		fill(tree);
+
+		CountingVisitor v1;
+		Envelope env(0.5, 1.5, 0.5, 1.5);
+		tree.query(&env, v1);
+		ensure_equals(v1.count, 4u);
+
+		CountingVisitor v2;
+		tree.iterate(v2);
+		ensure_equals(v2.count, envs.size());
+	}
+
+	// 4 - Remove, then insert after build
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		PackedSTRtree tree;
+		fill(tree);
+
+		Envelope env(5.2, 5.8, 5.2, 5.8);
+		std::vector<void*> m;
+		tree.query(&env, m);
+		ensure_equals(m.size(), 1u);
+
+		ensure(tree.remove(&envs[5*30+5], m[0]));
+		ensure(!tree.remove(&envs[5*30+5], m[0]));
+
+		m.clear();
+		tree.query(&env, m);
+		ensure(m.empty());
+
+		CountingVisitor v;
+		tree.iterate(v);
+		ensure_equals(v.count, envs.size()-1);
+
+		// insert after query, triggers a rebuild
+		int extra = -1;
+		tree.insert(&envs[5*30+5], &extra);
+		tree.query(&env, m);
+		ensure_equals(m.size(), 1u);
+		ensure(m[0] == &extra);
+	}
+
+	// 5 - itemsTree holds every item once
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		PackedSTRtree tree(4);
+		fill(tree);
+		std::auto_ptr<ItemsList> itree ( tree.itemsTree() );
+		ensure_equals(countItems(itree.get()), envs.size());
+	}
+
+	// 6 - Nearest neighbour
+	template<>
+	template<>
+	void object::test<6>()
+	{
+		PackedSTRtree tree(4);
+		fill(tree);
+		CentreDistance dist(envs);
+
+		// query with the square at (10,20), it is in the tree too
+		int query = 10*30+20;
+		void* found = tree.nearestNeighbour(&envs[query], &query, dist);
+		ensure(found != NULL);
+		ensure_equals(*static_cast<int*>(found), query);
+
+		// pruning must avoid computing most distances
+		ensure(dist.calls < envs.size() / 10);
+
+		PackedSTRtree empty;
+		ensure(empty.nearestNeighbour(&envs[query], &query, dist) == NULL);
+	}
+
+	// 7 - k nearest neighbours, with and without max distance
+	template<>
+	template<>
+	void object::test<7>()
+	{
+		PackedSTRtree tree(4);
+		fill(tree);
+		CentreDistance dist(envs);
+
+		int query = 10*30+20;
+		std::vector<void*> result;
+		tree.nearestNeighbours(&envs[query], &query, dist, 5, result);
+		ensure_equals(result.size(), 5u);
+		ensure_equals(*static_cast<int*>(result[0]), query);
+		// the next four are the edge neighbours, at distance 1
+		for (std::size_t i=1; i<5; ++i)
+		{
+			ensure_equals(dist.distance(&query, result[i]), 1.0);
+		}
+
+		// only the square itself is within 0.5
+		result.clear();
+		tree.nearestNeighbours(&envs[query], &query, dist, 5, result, 0.5);
+		ensure_equals(result.size(), 1u);
+
+		// corner neighbours are at sqrt(2)
+		result.clear();
+		tree.nearestNeighbours(&envs[query], &query, dist, 100, result, 1.5);
+		ensure_equals(result.size(), 9u);
+	}
+
+	// 8 - Batch query matches single queries, with and without threads
+	template<>
+	template<>
+	void object::test<8>()
+	{
+		PackedSTRtree tree(4);
+		fill(tree);
+
+		std::vector<Envelope> queries;
+		for (int i=0; i<1000; ++i)
+		{
+			double x = (i * 37) % 35 - 2.5;
+			double y = (i * 11) % 33 - 1.5;
+			queries.push_back(Envelope(x, x + (i % 4), y, y + (i % 3)));
+		}
+		queries.push_back(Envelope()); // null envelope, no matches
+
+		unsigned int threads[] = { 1, 4, 0 };
+		for (std::size_t t=0; t<3; ++t)
+		{
+			std::vector<std::size_t> offsets;
+			std::vector<void*> matches;
+			tree.queryBatch(queries, offsets, matches, threads[t]);
+			ensure_equals(offsets.size(), queries.size()+1);
+			ensure_equals(offsets.back(), matches.size());
+
+			for (std::size_t i=0; i<queries.size(); ++i)
+			{
+				std::vector<void*> single;
+				tree.query(&queries[i], single);
+				std::vector<void*> batch(matches.begin() + offsets[i],
+				                         matches.begin() + offsets[i+1]);
+				ensure(batch == single);
+			}
+		}
+
+		std::vector<std::size_t> offsets;
+		std::vector<void*> matches;
+		PackedSTRtree empty;
+		empty.queryBatch(queries, offsets, matches, 2);
+		ensure_equals(offsets.size(), queries.size()+1);
+		ensure(matches.empty());
+	}
+
+} // namespace tut
+
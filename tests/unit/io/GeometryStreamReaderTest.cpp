@@ -0,0 +1,256 @@
+// $Id$
+//
+// Test Suite for geos::io::GeometryStreamReader
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/io/GeometryStreamReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/GEOSException.h>
+// std
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using geos::io::GeometryStreamReader;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	struct test_geometrystreamreader_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+
+		geos::geom::GeometryFactory gf;
+		geos::io::WKTReader wktreader;
+		std::vector<std::string> wkts;
+
+		// toString() of the geometries in wkts
+		std::vector<std::string> expected;
+
+		// Collects the WKT of the geometries handed out
+		struct Collector: public GeometryStreamReader::Handler
+		{
+			std::vector<std::string> wkts;
+			std::vector<std::size_t> numPoints;
+			std::size_t limit;
+			Collector(std::size_t l=(std::size_t)-1) : limit(l) {}
+			bool handle(std::auto_ptr<geos::geom::Geometry> g)
+			{
+				wkts.push_back(g->toString());
+				numPoints.push_back(g->getNumPoints());
+				return wkts.size() < limit;
+			}
+		};
+
+		test_geometrystreamreader_data()
+			:
+			wktreader(&gf)
+		{
+			for (int i=0; i<200; ++i)
+			{
+				std::ostringstream s;
+				s << "LINESTRING (" << i << " 0, " << i << " " << i+1 << ")";
+				wkts.push_back(s.str());
+				GeomPtr g(wktreader.read(s.str()));
+				expected.push_back(g->toString());
+			}
+		}
+
+		std::string wktLines() const
+		{
+			std::string s;
+			for (std::size_t i=0; i<wkts.size(); ++i)
+				s += wkts[i] + "\n";
+			return s;
+		}
+
+		// Records as 4 byte little endian size followed by WKB
+		std::string sizedWKB(int byteOrder)
+		{
+			geos::io::WKBWriter w(2, byteOrder);
+			std::string s;
+			for (std::size_t i=0; i<wkts.size(); ++i)
+			{
+				GeomPtr g(wktreader.read(wkts[i]));
+				std::ostringstream os;
+				w.write(*g, os);
+				std::string wkb = os.str();
+				unsigned int n = wkb.size();
+				for (int b=0; b<4; ++b)
+					s += static_cast<char>((n >> (8*b)) & 0xff);
+				s += wkb;
+			}
+			return s;
+		}
+	};
+
+	typedef test_group<test_geometrystreamreader_data> group;
+	typedef group::object object;
+
+	group test_geometrystreamreader_group("geos::io::GeometryStreamReader");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Pull WKT lines from memory, skipping empty ones
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		std::string input = "\n" + wkts[0] + "\r\n\n  " + wkts[1] + "  \n" + wkts[2];
+		GeometryStreamReader reader(gf, GeometryStreamReader::WKT);
+		reader.setInput(input.data(), input.size());
+
+		for (std::size_t i=0; i<3; ++i)
+		{
+			GeomPtr g = reader.next();
+			ensure(g.get() != 0);
+			ensure_equals(g->toString(), expected[i]);
+		}
+		ensure(reader.next().get() == 0);
+		ensure_equals(reader.getRecordCount(), 3u);
+	}
+
+	// 2 - Length prefixed and hex WKB, sequential and parallel
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		int orders[] = { geos::io::WKBConstants::wkbNDR,
+		                 geos::io::WKBConstants::wkbXDR };
+		for (int o=0; o<2; ++o)
+		{
+			std::string input = sizedWKB(orders[o]);
+			unsigned int threads[] = { 1, 3 };
+			for (int t=0; t<2; ++t)
+			{
+				GeometryStreamReader reader(gf, GeometryStreamReader::WKB);
+				reader.setChunkSize(7);
+				reader.setInput(input.data(), input.size());
+				Collector c;
+				ensure_equals(reader.readAll(c, threads[t]), wkts.size());
+				ensure(c.wkts == expected);
+			}
+		}
+
+		geos::io::WKBWriter w;
+		std::string hex;
+		for (std::size_t i=0; i<wkts.size(); ++i)
+		{
+			GeomPtr g(wktreader.read(wkts[i]));
+			std::ostringstream os;
+			w.writeHEX(*g, os);
+			hex += os.str() + "\n";
+		}
+		GeometryStreamReader reader(gf, GeometryStreamReader::HEXWKB);
+		reader.setInput(hex.data(), hex.size());
+		Collector c;
+		reader.readAll(c, 2);
+		ensure(c.wkts == expected);
+	}
+
+	// 3 - Read from a file descriptor, with records larger than a block
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		std::ostringstream big;
+		big << "LINESTRING (0 0";
+		for (int i=1; i<20000; ++i) big << ", " << i << " " << i;
+		big << ")";
+
+		std::string input = wktLines() + big.str() + "\n" + wkts[0];
+
+		std::FILE* f = std::tmpfile();
+		ensure(f != 0);
+		std::fwrite(input.data(), 1, input.size(), f);
+		std::fflush(f);
+
+		unsigned int threads[] = { 1, 4 };
+		for (int t=0; t<2; ++t)
+		{
+			std::rewind(f);
+			GeometryStreamReader reader(gf, GeometryStreamReader::WKT);
+			reader.setChunkSize(16);
+			reader.setInput(fileno(f));
+			Collector c;
+			ensure_equals(reader.readAll(c, threads[t]), wkts.size() + 2);
+			ensure_equals(c.numPoints[wkts.size()], 20000u);
+			ensure_equals(c.wkts.back(), expected[0]);
+		}
+		std::fclose(f);
+	}
+
+	// 4 - Records preceding a bad one are handed out before the error
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		std::string input;
+		for (std::size_t i=0; i<50; ++i) input += wkts[i] + "\n";
+		input += "LINESTRING (0 0, 1)\n";
+		input += wkts[0] + "\n";
+		// a valid WKT, but an invalid geometry
+		std::string unclosed(input);
+		unclosed.replace(unclosed.find("LINESTRING (0 0, 1)"), 19,
+		                 "POLYGON ((0 0, 1 0, 1 1))");
+
+		unsigned int threads[] = { 1, 3 };
+		std::string messages[2][2];
+		for (int t=0; t<2; ++t)
+		{
+			for (int u=0; u<2; ++u)
+			{
+				const std::string& in = u ? unclosed : input;
+				GeometryStreamReader reader(gf, GeometryStreamReader::WKT);
+				reader.setChunkSize(8);
+				reader.setInput(in.data(), in.size());
+				Collector c;
+				try {
+					reader.readAll(c, threads[t]);
+					fail("Bad record was accepted");
+				} catch (const geos::io::ParseException& e) {
+					messages[t][u] = e.what();
+				}
+				ensure_equals(c.wkts.size(), 50u);
+				ensure_equals(reader.getRecordCount(), 51u);
+			}
+		}
+		// same error whatever the number of threads
+		ensure_equals(messages[1][0], messages[0][0]);
+		ensure_equals(messages[1][1], messages[0][1]);
+	}
+
+	// 5 - The handler can stop reading
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		std::string input = wktLines();
+		unsigned int threads[] = { 1, 2 };
+		for (int t=0; t<2; ++t)
+		{
+			GeometryStreamReader reader(gf, GeometryStreamReader::WKT);
+			reader.setChunkSize(16);
+			reader.setInput(input.data(), input.size());
+			Collector c(20);
+			ensure_equals(reader.readAll(c, threads[t]), 20u);
+			ensure_equals(c.wkts.size(), 20u);
+		}
+	}
+
+} // namespace tut
+
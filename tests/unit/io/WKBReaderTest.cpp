@@ -13,6 +13,7 @@
 #include <geos/io/WKBConstants.h>
 #include <geos/io/WKBWriter.h>
 #include <geos/io/WKTReader.h>
+#include <geos/io/ParseException.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
@@ -72,6 +73,21 @@ namespace tut
 			// Compare geoms read from NDR and XDR
 			ensure( gWKB_xdr->equalsExact(gWKB_ndr.get()) );
 
+			// NDR and XDR input from memory buffers
+			std::string ndr_bin = fromHEX(ndrWKB);
+			GeomPtr gBuf_ndr(wkbreader.read(
+				reinterpret_cast<const unsigned char*>(ndr_bin.data()),
+				ndr_bin.size()));
+			ensure("NDR buffer input",
+				gBuf_ndr->equalsExact(gWKT.get()) );
+
+			std::string xdr_bin = fromHEX(xdrWKB);
+			GeomPtr gBuf_xdr(wkbreader.read(
+				reinterpret_cast<const unsigned char*>(xdr_bin.data()),
+				xdr_bin.size()));
+			ensure("XDR buffer input",
+				gBuf_xdr->equalsExact(gWKT.get()) );
+
 			// NDR output
 			std::stringstream ndr_out;
 			ndrwkbwriter.writeHEX(*gWKT, ndr_out);
@@ -86,6 +102,18 @@ namespace tut
 
 		}
 
+		static std::string fromHEX(const std::string& hex)
+		{
+			std::string bin;
+			for (std::size_t i=0; i+1<hex.size(); i+=2)
+			{
+				int byte;
+				std::istringstream(hex.substr(i, 2)) >> std::hex >> byte;
+				bin += static_cast<char>(byte);
+			}
+			return bin;
+		}
+
 	};
 
 	typedef test_group<test_wkbreader_data> group;
@@ -242,6 +270,131 @@ namespace tut
 
 	}
 
+	// 8 - Read 3D coordinates from a buffer, in both byte orders
+	template<>
+	template<>
+	void object::test<8>()
+	{
+		geos::geom::PrecisionModel fpm;
+		geos::geom::GeometryFactory fgf(&fpm);
+		geos::io::WKBReader reader(fgf);
+		geos::io::WKTReader wktreader3d(&fgf);
+
+		GeomPtr g(wktreader3d.read(
+			"POLYGON((0.5 0 1, 10 0 2, 10 10.25 3, 0.5 0 1))"));
+
+		int orders[] = { geos::io::WKBConstants::wkbNDR,
+		                 geos::io::WKBConstants::wkbXDR };
+		for (int i=0; i<2; ++i)
+		{
+			geos::io::WKBWriter writer(3, orders[i]);
+			std::stringstream wkb;
+			writer.write(*g, wkb);
+			std::string bin = wkb.str();
+
+			GeomPtr gBuf(reader.read(
+				reinterpret_cast<const unsigned char*>(bin.data()),
+				bin.size()));
+			GeomPtr gStream(reader.read(wkb));
+
+			ensure( gBuf->equalsExact(g.get()) );
+			ensure( gStream->equalsExact(g.get()) );
+			ensure_equals( gBuf->getCoordinateDimension(), 3 );
+			ensure_equals( gBuf->getCoordinates()->getAt(2).getZ(), 3.0 );
+		}
+	}
+
+	// 9 - Truncated buffers are rejected
+	template<>
+	template<>
+	void object::test<9>()
+	{
+		std::string bin = fromHEX(
+			"0102000000020000000000000000000000000000000000000000000000000024400000000000002440");
+
+		// drop the last byte, then the whole second coordinate
+		std::size_t sizes[] = { bin.size()-1, bin.size()-16, 4 };
+		for (int i=0; i<3; ++i)
+		{
+			try {
+				GeomPtr g(wkbreader.read(
+					reinterpret_cast<const unsigned char*>(bin.data()),
+					sizes[i]));
+				fail("Truncated WKB was accepted");
+			} catch (const geos::io::ParseException&) {
+				// expected
+			}
+		}
+	}
+
+	// 10 - Counts larger than the input are rejected before allocating
+	template<>
+	template<>
+	void object::test<10>()
+	{
+		const char* hex[] = {
+			// LINESTRING of 2^31-1 points
+			"0102000000FFFFFF7F00000000000000000000000000000000",
+			// POLYGON of 2^31-1 rings, and of -1 rings
+			"0103000000FFFFFF7F00000000",
+			"0103000000FFFFFFFF00000000",
+			// MULTIPOINT of 2^31-1 points, GEOMETRYCOLLECTION of
+			// 2^28 geometries
+			"0104000000FFFFFF7F0101000000",
+			"01070000000000001000000000"
+		};
+		for (std::size_t i=0; i<sizeof(hex)/sizeof(hex[0]); ++i)
+		{
+			std::string bin = fromHEX(hex[i]);
+			try {
+				GeomPtr g(wkbreader.read(
+					reinterpret_cast<const unsigned char*>(bin.data()),
+					bin.size()));
+				fail(std::string("Bad count accepted: ") + hex[i]);
+			} catch (const geos::io::ParseException&) {
+				// expected
+			}
+			try {
+				std::istringstream is(bin);
+				GeomPtr g(wkbreader.read(is));
+				fail(std::string("Bad count accepted: ") + hex[i]);
+			} catch (const geos::io::ParseException&) {
+				// expected
+			}
+		}
+	}
+
+	// 11 - Coordinates are rounded by a FLOATING_SINGLE precision model
+	template<>
+	template<>
+	void object::test<11>()
+	{
+		geos::geom::PrecisionModel spm(geos::geom::PrecisionModel::FLOATING_SINGLE);
+		geos::geom::GeometryFactory sgf(&spm);
+		geos::io::WKBReader reader(sgf);
+
+		// LINESTRING(0.1 0.2, 1 1) and POINT(0.1 0.2), doubles
+		std::string hex[] = {
+			"010200000002000000"
+			"9A9999999999B93F9A9999999999C93F"
+			"000000000000F03F000000000000F03F",
+			"01010000009A9999999999B93F9A9999999999C93F"
+		};
+		for (int i=0; i<2; ++i)
+		{
+			std::string bin = fromHEX(hex[i]);
+			GeomPtr gBuf(reader.read(
+				reinterpret_cast<const unsigned char*>(bin.data()),
+				bin.size()));
+			std::istringstream is(bin);
+			GeomPtr gStream(reader.read(is));
+
+			const geos::geom::Coordinate* c = gBuf->getCoordinate();
+			ensure_equals( c->x, double(float(0.1)) );
+			ensure_equals( c->y, double(float(0.2)) );
+			ensure( gStream->equalsExact(gBuf.get()) );
+		}
+	}
 
 } // namespace tut
 
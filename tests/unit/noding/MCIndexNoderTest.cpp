@@ -0,0 +1,155 @@
+// $Id$
+//
+// Test Suite for geos::noding::MCIndexNoder class.
+
+#include <tut.hpp>
+// geos
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/IntersectionAdder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/PrecisionModel.h>
+// std
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateSequence;
+using geos::noding::SegmentString;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used by tests
+	struct test_mcindexnoder_data
+	{
+		// Zig-zag lines crossing each other, with many
+		// monotone chains
+		void makeLines(std::vector<SegmentString*>& lines,
+		               std::size_t numLines, std::size_t numPoints)
+		{
+			for (std::size_t i=0; i<numLines; ++i)
+			{
+				CoordinateSequence* cs =
+					new geos::geom::CoordinateArraySequence();
+				double angle = i * 3.1 / numLines;
+				double dx = std::cos(angle), dy = std::sin(angle);
+				for (std::size_t j=0; j<numPoints; ++j)
+				{
+					double t = j * 200.0 / numPoints - 100;
+					double off = (j % 2) ? 3.0 : -3.0;
+					cs->add(Coordinate(t * dx - off * dy + i % 7,
+					                   t * dy + off * dx - i % 5));
+				}
+				lines.push_back(
+					new geos::noding::NodedSegmentString(cs, 0));
+			}
+		}
+
+		// The noded substrings are owned by the lines
+		void deleteAll(std::vector<SegmentString*>& v)
+		{
+			for (std::size_t i=0; i<v.size(); ++i)
+			{
+				CoordinateSequence* cs = v[i]->getCoordinates();
+				delete v[i];
+				delete cs;
+			}
+			v.clear();
+		}
+
+		// Nodes the lines, returns the noded substrings
+		std::vector<SegmentString*>*
+		node(std::vector<SegmentString*>& lines, unsigned int numThreads,
+		     const geos::geom::PrecisionModel* pm, int& numIntersections)
+		{
+			geos::algorithm::LineIntersector li(pm);
+			geos::noding::IntersectionAdder adder(li);
+			geos::noding::MCIndexNoder noder(&adder);
+			noder.setNumThreads(numThreads);
+			noder.computeNodes(&lines);
+			numIntersections = adder.numIntersections;
+			return noder.getNodedSubstrings();
+		}
+
+		void checkThreads(const geos::geom::PrecisionModel* pm)
+		{
+			std::vector<SegmentString*> lines1, lines4;
+			makeLines(lines1, 60, 400);
+			makeLines(lines4, 60, 400);
+
+			int num1, num4;
+			std::auto_ptr< std::vector<SegmentString*> > noded1(
+				node(lines1, 1, pm, num1));
+			std::auto_ptr< std::vector<SegmentString*> > noded4(
+				node(lines4, 4, pm, num4));
+
+			ensure(num1 > 0);
+			ensure_equals(num4, num1);
+			ensure(noded1->size() > lines1.size());
+			ensure_equals(noded4->size(), noded1->size());
+			for (std::size_t i=0; i<noded1->size(); ++i)
+			{
+				const CoordinateSequence* cs1 = (*noded1)[i]->getCoordinates();
+				const CoordinateSequence* cs4 = (*noded4)[i]->getCoordinates();
+				ensure_equals(cs4->size(), cs1->size());
+				for (std::size_t j=0; j<cs1->size(); ++j)
+					ensure(cs4->getAt(j).equals2D(cs1->getAt(j)));
+			}
+
+			deleteAll(lines1);
+			deleteAll(lines4);
+		}
+	};
+
+	typedef test_group<test_mcindexnoder_data> group;
+	typedef group::object object;
+
+	group test_mcindexnoder_group("geos::noding::MCIndexNoder");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Noding with several threads gives the same nodes, in the
+	//     same order, as with one
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		checkThreads(0);
+	}
+
+	// 2 - Same with a fixed precision model
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		geos::geom::PrecisionModel pm(10.0);
+		checkThreads(&pm);
+	}
+
+	// 3 - Few chains, searched by the calling thread
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		std::vector<SegmentString*> lines;
+		makeLines(lines, 3, 10);
+		int num;
+		std::auto_ptr< std::vector<SegmentString*> > noded(
+			node(lines, 4, 0, num));
+		ensure(num > 0);
+		ensure(noded->size() > lines.size());
+		deleteAll(lines);
+	}
+
+} // namespace tut
+
@@ -16,6 +16,7 @@
 #include <geos/geom/CoordinateSequence.h>
 // std
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -270,5 +271,36 @@ namespace tut
         ensure(gBuffer->getNumPoints() >= std::size_t(5));
     }
 
+    // Buffer noded by several threads
+    template<>
+    template<>
+    void object::test<10>()
+    {
+        using geos::operation::buffer::BufferOp;
+        using geos::operation::buffer::BufferParameters;
+
+        // a zig-zag line, crossing itself back and forth
+        std::string wkt("LINESTRING(");
+        for (int i=0; i<400; ++i)
+        {
+            std::ostringstream os;
+            os << (i ? ", " : "") << (i % 40) * 5 << " " << (i % 2) * 30 + i / 40;
+            wkt += os.str();
+        }
+        wkt += ")";
+        GeomPtr g0(wktreader.read(wkt));
+
+        BufferParameters params;
+        BufferOp op1(g0.get(), params);
+        GeomPtr gBuffer1(op1.getResultGeometry(2));
+
+        params.setNumThreads(4);
+        BufferOp op4(g0.get(), params);
+        GeomPtr gBuffer4(op4.getResultGeometry(2));
+
+        ensure(gBuffer1->isValid());
+        ensure(gBuffer4->equalsExact(gBuffer1.get()));
+    }
+
 } // namespace tut
 
@@ -10,6 +10,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/Point.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/io/WKTReader.h>
@@ -17,6 +18,7 @@
 #include <geos/geom/CoordinateSequence.h>
 // std
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -479,6 +481,98 @@ namespace tut
         ensure_equals(g1->distance(g2.get()), 0);
     }
 
+	// 20 - Large inputs, using the indexed facet distance, give the
+	//      same distance as the brute-force one, and nearest points
+	//      lying on the geometries, in input order
+	template<>
+	template<>
+	void object::test<20>()
+	{
+		using geos::operation::distance::DistanceOp;
+
+		// two wavy lines of 400 vertices, and points around them
+		std::ostringstream wkt0, wkt1, wkt2;
+		wkt0 << "LINESTRING(";
+		wkt1 << "MULTILINESTRING((";
+		wkt2 << "MULTIPOINT(";
+		for (int i=0; i<400; ++i)
+		{
+			if ( i ) { wkt0 << ", "; wkt1 << ", "; wkt2 << ", "; }
+			wkt0 << i << " " << (i % 7) * 0.5;
+			wkt1 << i + 0.25 << " " << 7 + (i % 5) * 0.7;
+			wkt2 << i * 0.5 << " " << -2 - (i % 11);
+		}
+		wkt0 << ")";
+		wkt1 << "), (100 20, 150 20))";
+		wkt2 << ")";
+
+		GeomPtr geoms[4];
+		geoms[0].reset(wktreader.read(wkt0.str()));
+		geoms[1].reset(wktreader.read(wkt1.str()));
+		geoms[2].reset(wktreader.read(wkt2.str()));
+		geoms[3].reset(wktreader.read(
+			"POLYGON((-50 -50, 500 -50, 500 60, -50 60, -50 -50),"
+			" (-10 -20, 450 -20, 450 30, -10 30, -10 -20))"));
+
+		for (int i=0; i<4; ++i)
+		{
+			for (int j=0; j<4; ++j)
+			{
+				if ( i == j ) continue;
+
+				DistanceOp bruteOp(*geoms[i], *geoms[j]);
+				bruteOp.setIndexed(false);
+				DistanceOp indexedOp(*geoms[i], *geoms[j]);
+
+				double expected = bruteOp.distance();
+				double dist = indexedOp.distance();
+				ensure_equals(dist, expected);
+
+				CSPtr pts(indexedOp.nearestPoints());
+				ensure(pts.get() != 0);
+				ensure_distance(pts->getAt(0).distance(pts->getAt(1)),
+				              expected, 1e-10);
+
+				GeomPtr pt0(gf.createPoint(pts->getAt(0)));
+				GeomPtr pt1(gf.createPoint(pts->getAt(1)));
+				ensure(geoms[i]->distance(pt0.get()) < 1e-10);
+				ensure(geoms[j]->distance(pt1.get()) < 1e-10);
+			}
+		}
+	}
+
+	// 21 - Early termination and empty components with the indexed
+	//      facet distance
+	template<>
+	template<>
+	void object::test<21>()
+	{
+		using geos::operation::distance::DistanceOp;
+
+		std::ostringstream wkt0, wkt1;
+		wkt0 << "GEOMETRYCOLLECTION(LINESTRING EMPTY, LINESTRING(";
+		wkt1 << "LINESTRING(";
+		for (int i=0; i<200; ++i)
+		{
+			if ( i ) { wkt0 << ", "; wkt1 << ", "; }
+			wkt0 << i << " " << (i % 2);
+			wkt1 << i << " " << 10 - (i % 3);
+		}
+		wkt0 << "), POINT EMPTY)";
+		wkt1 << ")";
+
+		GeomPtr g0(wktreader.read(wkt0.str()));
+		GeomPtr g1(wktreader.read(wkt1.str()));
+
+		ensure_equals(DistanceOp::distance(*g0, *g1), 7.0);
+		ensure(DistanceOp::isWithinDistance(*g0, *g1, 8));
+		ensure(DistanceOp::isWithinDistance(*g0, *g1, 7));
+		ensure(!DistanceOp::isWithinDistance(*g0, *g1, 6.9));
+
+		DistanceOp op(*g0, *g1, 8);
+		ensure(op.distance() <= 8);
+	}
+
 	// TODO: finish the tests by adding:
 	// 	LINESTRING - *all*
 	// 	MULTILINESTRING - *all*
@@ -0,0 +1,174 @@
+// $Id$
+// 
+// Test Suite for geos::operation::distance::IndexedFacetDistance class,
+// and the distance of prepared geometries.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+using geos::operation::distance::IndexedFacetDistance;
+using geos::operation::distance::DistanceOp;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used by tests
+	struct test_indexedfacetdistance_data
+	{
+		typedef std::auto_ptr<geos::geom::Geometry> GeomPtr;
+		typedef std::auto_ptr<const geos::geom::prep::PreparedGeometry> PrepGeomPtr;
+
+		geos::io::WKTReader reader;
+
+		// Checks the prepared distance and isWithinDistance against
+		// DistanceOp, both ways
+		void checkPrepared(const std::string& wkt1, const std::string& wkt2)
+		{
+			GeomPtr g1(reader.read(wkt1));
+			GeomPtr g2(reader.read(wkt2));
+			checkPrepared(*g1, *g2);
+			checkPrepared(*g2, *g1);
+		}
+
+		void checkPrepared(const geos::geom::Geometry& g1,
+		                   const geos::geom::Geometry& g2)
+		{
+			PrepGeomPtr pg(geos::geom::prep::PreparedGeometryFactory::prepare(&g1));
+			double expected = DistanceOp::distance(g1, g2);
+			double dist = pg->distance(&g2);
+			ensure_distance(dist, expected, 1e-12);
+
+			ensure(pg->isWithinDistance(&g2, expected));
+			ensure(pg->isWithinDistance(&g2, expected + 1));
+			if ( expected > 0 )
+				ensure(!pg->isWithinDistance(&g2, expected * 0.99));
+		}
+	};
+
+	typedef test_group<test_indexedfacetdistance_data> group;
+	typedef group::object object;
+
+	group test_indexedfacetdistance_group("geos::operation::distance::IndexedFacetDistance");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Facet distances of points and lines
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		GeomPtr line(reader.read("LINESTRING(0 0, 10 0, 10 10, 20 10)"));
+		GeomPtr pt(reader.read("POINT(5 3)"));
+		GeomPtr far(reader.read("MULTIPOINT(30 10, 20 15)"));
+		GeomPtr empty(reader.read("LINESTRING EMPTY"));
+
+		IndexedFacetDistance ifd(line.get());
+		ensure_equals(ifd.getDistance(pt.get()), 3.0);
+		ensure_equals(ifd.getDistance(far.get()), 5.0);
+		ensure_equals(ifd.getDistance(empty.get()), 0.0);
+		ensure_equals(IndexedFacetDistance::distance(pt.get(), far.get()),
+		              std::sqrt(15.0*15.0 + 12.0*12.0));
+
+		ensure(ifd.isWithinDistance(pt.get(), 3.0));
+		ensure(!ifd.isWithinDistance(pt.get(), 2.5));
+		ensure(ifd.isWithinDistance(far.get(), 5.0));
+		ensure(!ifd.isWithinDistance(far.get(), 4.9));
+	}
+
+	// 2 - Facet distance ignores containment
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		GeomPtr poly(reader.read("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))"));
+		GeomPtr pt(reader.read("POINT(3 4)"));
+
+		ensure_equals(IndexedFacetDistance::distance(poly.get(), pt.get()), 3.0);
+		ensure_equals(DistanceOp::distance(*poly, *pt), 0.0);
+	}
+
+	// 3 - Long lines, split in many facet sequences
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		std::string wkt1 = "LINESTRING(";
+		std::string wkt2 = "LINESTRING(";
+		for (int i=0; i<200; ++i)
+		{
+			char buf[64];
+			std::sprintf(buf, "%s%d %g", i ? ", " : "", i,
+			             std::sin(i * 0.1) * 10);
+			wkt1 += buf;
+			std::sprintf(buf, "%s%g %d", i ? ", " : "",
+			             std::cos(i * 0.07) * 10 + 230, i - 50);
+			wkt2 += buf;
+		}
+		wkt1 += ")";
+		wkt2 += ")";
+
+		GeomPtr g1(reader.read(wkt1));
+		GeomPtr g2(reader.read(wkt2));
+
+		IndexedFacetDistance ifd(g1.get());
+		ensure(ifd.getNumFacetSequences() > 30);
+		ensure_distance(ifd.getDistance(g2.get()),
+		                DistanceOp::distance(*g1, *g2), 1e-12);
+
+		checkPrepared(*g1, *g2);
+		checkPrepared(*g2, *g1);
+	}
+
+	// 4 - Prepared distance, including containment in either direction
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		const std::string poly =
+			"POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))";
+
+		checkPrepared(poly, "POINT(3 4)");
+		checkPrepared(poly, "POINT(5 5.5)");
+		checkPrepared(poly, "POINT(13 14)");
+		checkPrepared(poly, "LINESTRING(1 1, 2 2)");
+		checkPrepared(poly, "LINESTRING(20 0, 20 10)");
+		checkPrepared(poly, "POLYGON((-10 -10, 20 -10, 20 20, -10 20, -10 -10))");
+		checkPrepared(poly, "POLYGON((4.5 4.5, 5 4.5, 5 5, 4.5 4.5))");
+		checkPrepared(poly, "MULTIPOLYGON(((1 1, 2 1, 2 2, 1 1)), ((30 30, 31 30, 31 31, 30 30)))");
+		checkPrepared(poly, "GEOMETRYCOLLECTION(POINT(40 0), LINESTRING(12 12, 15 15))");
+		checkPrepared("MULTIPOINT(0 0, 5 5)", "LINESTRING(3 0, 3 10)");
+	}
+
+	// 5 - Prepared distance with empty geometries
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		GeomPtr empty(reader.read("POLYGON EMPTY"));
+		GeomPtr pt(reader.read("POINT(1 1)"));
+
+		PrepGeomPtr pg(geos::geom::prep::PreparedGeometryFactory::prepare(empty.get()));
+		ensure_equals(pg->distance(pt.get()), 0.0);
+
+		PrepGeomPtr pg2(geos::geom::prep::PreparedGeometryFactory::prepare(pt.get()));
+		ensure_equals(pg2->distance(empty.get()), 0.0);
+	}
+
+} // namespace tut
@@ -0,0 +1,263 @@
+// $Id$
+//
+// Test Suite for geos::operation::intersection::RectangleIntersection class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Envelope.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+// std
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used by tests
+	struct test_rectangleintersection_data
+	{
+		typedef geos::operation::intersection::RectangleIntersection
+			RectangleIntersection;
+		typedef geos::geom::Geometry::AutoPtr GeomPtr;
+
+		geos::geom::GeometryFactory gf;
+		geos::io::WKTReader wktreader;
+		geos::io::WKTWriter wktwriter;
+
+		test_rectangleintersection_data()
+			: gf(), wktreader(&gf), wktwriter()
+		{
+			wktwriter.setTrim(true);
+		}
+
+		GeomPtr clip(const std::string& wkt, const geos::geom::Envelope& rect)
+		{
+			GeomPtr g(wktreader.read(wkt));
+			return RectangleIntersection::clip(*g, rect);
+		}
+
+		// Checks the clipped geometry covers the same points as the
+		// overlay intersection
+		void checkClip(const std::string& wkt,
+		               const geos::geom::Envelope& rect)
+		{
+			GeomPtr g(wktreader.read(wkt));
+			GeomPtr rectGeom(gf.toGeometry(&rect));
+			GeomPtr expected(g->intersection(rectGeom.get()));
+			GeomPtr result(RectangleIntersection::clip(*g, rect));
+
+			ensure("valid " + wktwriter.write(result.get()),
+			       result->isValid());
+			ensure_equals(result->isEmpty(), expected->isEmpty());
+			if (expected->isEmpty()) return;
+
+			ensure_equals(result->getDimension(), expected->getDimension());
+			ensure(std::fabs(result->getArea() - expected->getArea()) < 1e-9);
+			ensure(std::fabs(result->getLength() - expected->getLength()) < 1e-9);
+			if (expected->getGeometryTypeId() !=
+					geos::geom::GEOS_GEOMETRYCOLLECTION)
+			{
+				ensure(wktwriter.write(result.get()) + " equals " +
+				       wktwriter.write(expected.get()),
+				       result->equals(expected.get()));
+			}
+		}
+
+	private:
+		// noncopyable
+		test_rectangleintersection_data(test_rectangleintersection_data const& other);
+		test_rectangleintersection_data& operator=(test_rectangleintersection_data const& rhs);
+	};
+
+	typedef test_group<test_rectangleintersection_data> group;
+	typedef group::object object;
+
+	group test_rectangleintersection_group("geos::operation::intersection::RectangleIntersection");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Points inside, on the boundary and outside
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("MULTIPOINT(5 5, 0 3, 10 10, 11 5, -1 -1)", rect);
+		GeomPtr g = clip("MULTIPOINT(5 5, 0 3, 11 5)", rect);
+		ensure_equals(g->getNumGeometries(), 2u);
+		ensure(clip("POINT(20 20)", rect)->isEmpty());
+	}
+
+	// 2 - Lines crossing the rectangle, several times
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("LINESTRING(-5 5, 15 5)", rect);
+		checkClip("LINESTRING(-5 -5, 5 5, 15 -5, 15 3, -2 8, 4 20)", rect);
+		checkClip("MULTILINESTRING((-5 1, 5 2), (3 3, 4 4), (20 0, 20 10))",
+		          rect);
+		GeomPtr g = clip("LINESTRING(-5 2, 5 2, 5 20, 6 20, 6 2, 20 2)", rect);
+		ensure_equals(g->getNumGeometries(), 2u);
+	}
+
+	// 3 - Polygons crossing the rectangle
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("POLYGON((-5 -5, 5 -5, 5 5, -5 5, -5 -5))", rect);
+		checkClip("POLYGON((-5 2, 15 2, 15 8, -5 8, -5 2))", rect);
+		// a U shape, clipped into two parts
+		checkClip("POLYGON((2 -5, 8 -5, 8 20, 6 20, 6 2, 4 2, 4 20, 2 20, 2 -5))",
+		          rect);
+		// clockwise shell
+		checkClip("POLYGON((-5 2, -5 8, 15 8, 15 2, -5 2))", rect);
+		// corners of the rectangle in the result
+		checkClip("POLYGON((-5 -5, 15 -5, 5 15, -5 -5))", rect);
+		checkClip("POLYGON((-5 5, 5 -5, 15 5, 5 15, -5 5))", rect);
+	}
+
+	// 4 - Polygons with holes
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		// hole inside the rectangle
+		checkClip("POLYGON((-5 -5, 15 -5, 15 5, -5 5, -5 -5),"
+		          "(2 1, 3 1, 3 2, 2 2, 2 1))", rect);
+		// hole crossing the rectangle
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(-2 2, 12 2, 12 4, -2 4, -2 2))", rect);
+		// hole crossing the rectangle, shell around it
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(5 -2, 12 5, 5 12, -2 5, 5 -2))", rect);
+		// holes inside and outside the rectangle
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(2 2, 3 2, 3 3, 2 3, 2 2), (12 12, 13 12, 13 13, 12 12))",
+		          rect);
+		// hole in one of two parts
+		checkClip("POLYGON((2 -5, 8 -5, 8 20, 6 20, 6 2, 4 2, 4 20, 2 20, 2 -5),"
+		          "(6.5 5, 7.5 5, 7.5 6, 6.5 6, 6.5 5))", rect);
+	}
+
+	// 5 - Rectangle inside a shell, or a hole
+	template<>
+	template<>
+	void object::test<5>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5))", rect);
+		GeomPtr g = clip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5))", rect);
+		ensure_equals(g->getArea(), 100.0);
+
+		ensure(clip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		            "(-2 -2, 12 -2, 12 12, -2 12, -2 -2))", rect)->isEmpty());
+		// rectangle in the hole of a concave shell
+		ensure(clip("POLYGON((-5 -5, 15 -5, 15 15, 14 15, 14 -4, -5 -4, -5 -5))",
+		            rect)->isEmpty());
+	}
+
+	// 6 - Geometries touching the rectangle boundary
+	template<>
+	template<>
+	void object::test<6>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("POLYGON((-5 0, 5 0, 5 5, -5 5, -5 0))", rect);
+		checkClip("POLYGON((0 0, 5 -5, 5 5, 0 0))", rect);
+		checkClip("POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))", rect);
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(0 5, 5 0, 10 5, 5 10, 0 5))", rect);
+		checkClip("POLYGON((-10 5, 5 -10, 5 5, -10 5))", rect);
+		checkClip("LINESTRING(-5 0, 15 0)", rect);
+		checkClip("LINESTRING(-5 5, 0 5, 5 10)", rect);
+		checkClip("LINESTRING(-5 5, 5 -5)", rect);
+		checkClip("LINESTRING(-5 5, 0 5, 5 5, 5 0, 5 -5)", rect);
+		checkClip("LINESTRING(-5 5, 0 5, 0 8, -5 8)", rect);
+		checkClip("LINESTRING(10 5, 15 0, 15 10, 5 5, 10 5)", rect);
+	}
+
+	// 7 - Polygons with vertices on the rectangle boundary
+	template<>
+	template<>
+	void object::test<7>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("POLYGON((0 -5, 5 -5, 5 5, 0 5, 0 -5))", rect);
+		checkClip("POLYGON((-5 -5, 0 -5, 0 0, 10 0, 10 -5, 15 -5,"
+		          "15 5, -5 5, -5 -5))", rect);
+		checkClip("POLYGON((-5 0, 0 0, 0 10, -5 10, -5 0))", rect);
+		checkClip("POLYGON((-5 -5, 10 -5, 10 10, -5 10, -5 -5))", rect);
+		checkClip("POLYGON((5 0, 15 -5, 15 15, 5 10, 5 0))", rect);
+		// hole touching the rectangle from outside
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(5 10, 7 12, 3 12, 5 10))", rect);
+		// hole touching the rectangle from inside
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(5 10, 3 8, 7 8, 5 10))", rect);
+		// holes touching each other on the rectangle boundary
+		checkClip("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5),"
+		          "(5 10, 3 12, 3 7, 5 10), (5 10, 7 7, 7 12, 5 10))", rect);
+		// hole around the rectangle, touching it in a point
+		checkClip("POLYGON((-10 -10, 20 -10, 20 20, -10 20, -10 -10),"
+		          "(-5 -5, 15 -5, 15 15, 5 10, -5 15, -5 -5))", rect);
+	}
+
+	// 8 - Collections
+	template<>
+	template<>
+	void object::test<8>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		checkClip("MULTIPOLYGON(((-5 -5, 5 -5, 5 5, -5 5, -5 -5)),"
+		          "((6 6, 15 6, 15 15, 6 15, 6 6)),"
+		          "((20 20, 21 20, 21 21, 20 20)))", rect);
+		checkClip("GEOMETRYCOLLECTION(POINT(1 1), POINT(20 20),"
+		          "LINESTRING(-5 5, 15 5),"
+		          "POLYGON((-5 -5, 5 -5, 5 2, -5 2, -5 -5)))", rect);
+		ensure(clip("GEOMETRYCOLLECTION EMPTY", rect)->isEmpty());
+		ensure(clip("POLYGON((20 20, 21 20, 21 21, 20 20))", rect)->isEmpty());
+	}
+
+	// 9 - Degenerate rectangle
+	template<>
+	template<>
+	void object::test<9>()
+	{
+		geos::geom::Envelope rect(0, 10, 5, 5);
+		checkClip("POLYGON((-5 -5, 5 -5, 5 15, -5 15, -5 -5))", rect);
+		checkClip("LINESTRING(2 0, 2 10)", rect);
+	}
+
+	// 10 - Z values are interpolated at the boundary
+	template<>
+	template<>
+	void object::test<10>()
+	{
+		geos::geom::Envelope rect(0, 10, 0, 10);
+		GeomPtr g = clip("LINESTRING(-10 5 0, 10 5 20)", rect);
+		const geos::geom::CoordinateSequence* cs = g->getCoordinates();
+		ensure_equals(cs->getSize(), 2u);
+		ensure_equals(cs->getAt(0).x, 0.0);
+		ensure_equals(cs->getAt(0).getZ(), 10.0);
+		ensure_equals(cs->getAt(1).getZ(), 20.0);
+		delete cs;
+	}
+
+} // namespace tut
+
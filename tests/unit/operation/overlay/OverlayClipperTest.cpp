@@ -0,0 +1,177 @@
+// $Id$
+//
+// Test Suite for geos::operation::overlay::OverlayClipper class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/operation/overlay/OverlayClipper.h>
+#include <geos/operation/overlay/OverlayOp.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Envelope.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used by tests
+	struct test_overlayclipper_data
+	{
+		typedef geos::operation::overlay::OverlayClipper OverlayClipper;
+		typedef geos::operation::overlay::OverlayOp OverlayOp;
+		typedef geos::geom::Geometry::AutoPtr GeomPtr;
+
+		geos::geom::GeometryFactory gf;
+		geos::io::WKTReader wktreader;
+
+		// a large polygon, with enough points to be clipped
+		GeomPtr big;
+		// a small polygon on the boundary of the large one
+		GeomPtr small;
+
+		test_overlayclipper_data()
+			: gf(), wktreader(&gf)
+		{
+			GeomPtr pt(wktreader.read("POINT(0 0)"));
+			big.reset(pt->buffer(100, 64));
+			small.reset(wktreader.read(
+				"POLYGON((90 -5, 110 -5, 110 5, 90 5, 90 -5))"));
+		}
+
+		// Checks the operation gives the same result as the overlay
+		// of the unclipped operands
+		void checkOverlay(const GeomPtr& result, const geos::geom::Geometry& g0,
+		                  const geos::geom::Geometry& g1, OverlayOp::OpCode opCode)
+		{
+			GeomPtr expected(OverlayOp::overlayOp(&g0, &g1, opCode));
+			ensure(result->isValid());
+			ensure(std::fabs(result->getArea() - expected->getArea()) < 1e-9);
+			ensure(result->equals(expected.get()));
+		}
+
+	private:
+		// noncopyable
+		test_overlayclipper_data(test_overlayclipper_data const& other);
+		test_overlayclipper_data& operator=(test_overlayclipper_data const& rhs);
+	};
+
+	typedef test_group<test_overlayclipper_data> group;
+	typedef group::object object;
+
+	group test_overlayclipper_group("geos::operation::overlay::OverlayClipper");
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Clipping envelope by operation
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		geos::geom::Envelope env;
+		ensure(OverlayClipper::getClipEnvelope(OverlayOp::opINTERSECTION,
+		                                       *big, *small, env));
+		ensure(env.covers(90, -5));
+		ensure(env.covers(100, 5));
+		ensure(!env.covers(110, 0));
+
+		ensure(OverlayClipper::getClipEnvelope(OverlayOp::opDIFFERENCE,
+		                                       *small, *big, env));
+		ensure(env.covers(small->getEnvelopeInternal()));
+		ensure(!env.covers(big->getEnvelopeInternal()));
+
+		ensure(!OverlayClipper::getClipEnvelope(OverlayOp::opUNION,
+		                                        *big, *small, env));
+		ensure(!OverlayClipper::getClipEnvelope(OverlayOp::opSYMDIFFERENCE,
+		                                        *big, *small, env));
+
+		// nothing to clip to
+		GeomPtr pt(wktreader.read("POINT(95 0)"));
+		ensure(!OverlayClipper::getClipEnvelope(OverlayOp::opINTERSECTION,
+		                                        *big, *pt, env));
+		GeomPtr far(wktreader.read("POLYGON((200 0, 210 0, 210 10, 200 0))"));
+		ensure(!OverlayClipper::getClipEnvelope(OverlayOp::opINTERSECTION,
+		                                        *big, *far, env));
+	}
+
+	// 2 - Operands clipped by operation
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		OverlayClipper::GeomPtrPair clipped;
+
+		OverlayClipper::clip(OverlayOp::opINTERSECTION, *big, *small, clipped);
+		ensure(0 != clipped.first.get());
+		ensure(clipped.first->getNumPoints() < big->getNumPoints());
+		// too small to be worth clipping
+		ensure(0 == clipped.second.get());
+
+		// the first operand of a difference is kept
+		OverlayClipper::clip(OverlayOp::opDIFFERENCE, *big, *small, clipped);
+		ensure(0 == clipped.first.get());
+		ensure(0 == clipped.second.get());
+
+		OverlayClipper::clip(OverlayOp::opDIFFERENCE, *small, *big, clipped);
+		ensure(0 == clipped.first.get());
+		ensure(0 != clipped.second.get());
+
+		OverlayClipper::clip(OverlayOp::opUNION, *big, *small, clipped);
+		ensure(0 == clipped.first.get());
+		ensure(0 == clipped.second.get());
+	}
+
+	// 3 - Overlays through Geometry give the unclipped result
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		GeomPtr r(big->intersection(small.get()));
+		checkOverlay(r, *big, *small, OverlayOp::opINTERSECTION);
+
+		r.reset(small->intersection(big.get()));
+		checkOverlay(r, *small, *big, OverlayOp::opINTERSECTION);
+
+		r.reset(small->difference(big.get()));
+		checkOverlay(r, *small, *big, OverlayOp::opDIFFERENCE);
+
+		r.reset(big->difference(small.get()));
+		checkOverlay(r, *big, *small, OverlayOp::opDIFFERENCE);
+
+		// clipped to nothing
+		GeomPtr inHole(big->getBoundary());
+		GeomPtr centre(wktreader.read(
+			"POLYGON((-5 -5, 5 -5, 5 5, -5 5, -5 -5))"));
+		r.reset(inHole->intersection(centre.get()));
+		ensure(r->isEmpty());
+		r.reset(centre->difference(inHole.get()));
+		checkOverlay(r, *centre, *inHole, OverlayOp::opDIFFERENCE);
+	}
+
+	// 4 - Lines
+	template<>
+	template<>
+	void object::test<4>()
+	{
+		GeomPtr line(big->getBoundary());
+		GeomPtr r(line->intersection(small.get()));
+		ensure(std::fabs(r->getLength() - 10) < 1e-2);
+		GeomPtr expected(OverlayOp::overlayOp(line.get(), small.get(),
+		                                      OverlayOp::opINTERSECTION));
+		ensure(r->equals(expected.get()));
+
+		r.reset(small->difference(line.get()));
+		checkOverlay(r, *small, *line, OverlayOp::opDIFFERENCE);
+	}
+
+} // namespace tut
+
@@ -13,6 +13,7 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 // std
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -164,5 +165,31 @@ namespace tut
 //         std::for_each(g.begin(), g.end(), delete_geometry);
 //     }
 
+    // Parallel union gives the same result whatever the thread count
+    template<>
+    template<>
+    void object::test<4>()
+    {
+        using geos::operation::geounion::CascadedPolygonUnion;
+
+        std::vector<geos::geom::Polygon*> g;
+        create_discs(gf, 12, 0.7, &g);
+
+        std::auto_ptr<geos::geom::Geometry> expected(unionCascaded(&g));
+
+        unsigned int threads[] = { 2, 4, 0 };
+        std::size_t grains[] = { 1, 5, 1000 };
+        for (int t = 0; t < 3; ++t)
+        {
+            CascadedPolygonUnion op(&g);
+            op.setNumThreads(threads[t]);
+            op.setMinGrainSize(grains[t]);
+            std::auto_ptr<geos::geom::Geometry> u(op.Union());
+            ensure(u->equalsExact(expected.get()));
+        }
+
+        std::for_each(g.begin(), g.end(), delete_geometry);
+    }
+
 } // namespace tut
 
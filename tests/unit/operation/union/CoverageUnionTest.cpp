@@ -0,0 +1,222 @@
+// $Id$
+//
+// Test Suite for geos::operation::geounion::CoverageUnion class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/operation/union/CoverageUnion.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Envelope.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TopologyException.h>
+// std
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut
+{
+    //
+    // Test Group
+    //
+
+    // Common data used by tests
+    struct test_coverageunion_data
+    {
+        typedef geos::operation::geounion::CoverageUnion CoverageUnion;
+        typedef geos::geom::Geometry::AutoPtr GeomPtr;
+
+        geos::geom::GeometryFactory gf;
+        geos::io::WKTReader wktreader;
+        geos::io::WKTWriter wktwriter;
+
+        test_coverageunion_data()
+          : gf(),
+            wktreader(&gf)
+        {}
+
+        // Checks the coverage union against the overlay union
+        void checkUnion(const std::string& wkt)
+        {
+            GeomPtr g(wktreader.read(wkt));
+            GeomPtr expected(g->Union());
+            GeomPtr result(CoverageUnion::Union(*g, true));
+
+            ensure("valid " + wktwriter.write(result.get()),
+                   result->isValid());
+            ensure_equals(result->getNumGeometries(),
+                          expected->getNumGeometries());
+            ensure(wktwriter.write(result.get()) + " equals " +
+                   wktwriter.write(expected.get()),
+                   result->equals(expected.get()));
+        }
+
+        // A grid of n by n unit squares, skipping the ones at hole
+        // and hole2
+        GeomPtr grid(int n, int hole, int hole2 = -1)
+        {
+            std::vector<geos::geom::Geometry*>* squares =
+                new std::vector<geos::geom::Geometry*>();
+            for (int i = 0; i < n; ++i)
+            {
+                for (int j = 0; j < n; ++j)
+                {
+                    if (i * n + j == hole || i * n + j == hole2) continue;
+                    geos::geom::Envelope env(i, i + 1, j, j + 1);
+                    squares->push_back(gf.toGeometry(&env));
+                }
+            }
+            return GeomPtr(gf.buildGeometry(squares));
+        }
+    };
+
+    typedef test_group<test_coverageunion_data> group;
+    typedef group::object object;
+
+    group test_coverageunion_group("geos::operation::geounion::CoverageUnion");
+
+    //
+    // Test Cases
+    //
+
+    // 1 - Adjacent polygons
+    template<>
+    template<>
+    void object::test<1>()
+    {
+        checkUnion("MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)),"
+                   "((1 0, 2 0, 2 1, 1 1, 1 0)))");
+        // clockwise shell, and a vertex of one on the edge of the other
+        // being a vertex of both
+        checkUnion("MULTIPOLYGON(((0 0, 0 2, 1 2, 1 1, 1 0, 0 0)),"
+                   "((1 0, 2 0, 2 1, 1 1, 1 0)))");
+        checkUnion("GEOMETRYCOLLECTION(POLYGON((0 0, 1 0, 1 1, 0 1, 0 0)),"
+                   "MULTIPOLYGON(((1 0, 2 0, 2 1, 1 1, 1 0)),"
+                   "((5 5, 6 5, 6 6, 5 5))))");
+    }
+
+    // 2 - Grid of squares, with and without a gap
+    template<>
+    template<>
+    void object::test<2>()
+    {
+        GeomPtr g(grid(10, -1));
+        GeomPtr result(CoverageUnion::Union(*g, true));
+        ensure_equals(result->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+        ensure_equals(result->getNumPoints(), 41u);
+        ensure_equals(result->getArea(), 100.0);
+
+        // the gap is a hole of the union
+        g = grid(5, 12);
+        checkUnion(wktwriter.write(g.get()));
+        result = CoverageUnion::Union(*g, true);
+        ensure_equals(result->getArea(), 24.0);
+    }
+
+    // 3 - Holes, filled or not by other polygons
+    template<>
+    template<>
+    void object::test<3>()
+    {
+        checkUnion("MULTIPOLYGON(((0 0, 10 0, 10 10, 0 10, 0 0),"
+                   "(2 2, 4 2, 4 4, 2 4, 2 2), (6 6, 8 6, 8 8, 6 8, 6 6)),"
+                   "((2 2, 4 2, 4 4, 2 4, 2 2)))");
+        // polygon in a hole touching the hole boundary
+        checkUnion("MULTIPOLYGON(((0 0, 10 0, 10 10, 0 10, 0 0),"
+                   "(2 2, 8 2, 8 8, 2 8, 2 2)),"
+                   "((2 2, 8 2, 5 5, 2 2)))");
+    }
+
+    // 4 - Polygons touching at points only, and disjoint
+    template<>
+    template<>
+    void object::test<4>()
+    {
+        checkUnion("MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)),"
+                   "((1 1, 2 1, 2 2, 1 2, 1 1)),"
+                   "((5 5, 6 5, 6 6, 5 6, 5 5)))");
+        // a ring of polygons around a point
+        checkUnion("MULTIPOLYGON(((0 0, 1 0, 1 1, 0 0)),"
+                   "((1 0, 2 0, 1 1, 1 0)), ((2 0, 2 2, 1 1, 2 0)),"
+                   "((1 1, 2 2, 0 2, 1 1)), ((0 0, 1 1, 0 2, 0 0)))");
+    }
+
+    // 5 - Empty and non polygonal input
+    template<>
+    template<>
+    void object::test<5>()
+    {
+        GeomPtr g(wktreader.read("MULTIPOLYGON EMPTY"));
+        ensure(CoverageUnion::Union(*g)->isEmpty());
+
+        g.reset(wktreader.read(
+            "GEOMETRYCOLLECTION(POLYGON((0 0, 1 0, 1 1, 0 0)), POINT(5 5))"));
+        try {
+            CoverageUnion::Union(*g);
+            fail("IllegalArgumentException expected");
+        }
+        catch (const geos::util::IllegalArgumentException&)
+        {
+        }
+    }
+
+    // 6 - Validation of inputs which are not coverages
+    template<>
+    template<>
+    void object::test<6>()
+    {
+        const char* invalid[] = {
+            // overlapping
+            "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)),"
+            "((0 0, 2 0, 2 1, 0 1, 0 0)))",
+            // overlapping, no common edge
+            "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)),"
+            "((1 1, 3 1, 3 3, 1 3, 1 1)))",
+            // edges not sharing their vertices
+            "MULTIPOLYGON(((0 0, 1 0, 1 2, 0 2, 0 0)),"
+            "((1 0, 2 0, 2 1, 1 1, 1 0)))"
+        };
+        for (std::size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+        {
+            GeomPtr g(wktreader.read(invalid[i]));
+            // not thrown without validation
+            CoverageUnion::Union(*g);
+            try {
+                CoverageUnion::Union(*g, true);
+                fail(std::string("TopologyException expected for ") +
+                     invalid[i]);
+            }
+            catch (const geos::util::TopologyException&)
+            {
+            }
+        }
+    }
+
+    // 7 - Union boundary touching itself at a vertex
+    template<>
+    template<>
+    void object::test<7>()
+    {
+        // a gap closed at a vertex of the union shell
+        checkUnion("MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)),"
+                   "((1 0, 2 0, 2 1, 1 1, 1 0)),((2 0, 3 0, 3 1, 2 1, 2 0)),"
+                   "((0 1, 1 1, 1 2, 0 2, 0 1)),((2 1, 3 1, 3 2, 2 2, 2 1)),"
+                   "((0 2, 1 2, 1 3, 0 3, 0 2)),((1 2, 2 2, 2 3, 1 3, 1 2)))");
+        // a hole touching the shell diagonally
+        checkUnion(wktwriter.write(grid(3, 4, 8).get()));
+
+        // holes touching each other diagonally, or the shell
+        for (int hole = 0; hole < 16; ++hole)
+        {
+            for (int hole2 = hole + 1; hole2 < 16; ++hole2)
+                checkUnion(wktwriter.write(grid(4, hole, hole2).get()));
+        }
+    }
+
+} // namespace tut
+
@@ -0,0 +1,130 @@
+// $Id$
+//
+// Test Suite for geos::util::Arena class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/util/Arena.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cstddef>
+#include <memory>
+
+using geos::util::Arena;
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_arena_data
+	{
+	};
+
+	typedef test_group<test_arena_data> group;
+	typedef group::object object;
+
+	group test_arena_group("geos::util::Arena");
+
+	// Counts live objects
+	struct Tracked: public geos::util::ArenaAllocated
+	{
+		static int live;
+		double payload[4];
+		Tracked() { ++live; }
+		virtual ~Tracked() { --live; }
+	};
+	int Tracked::live = 0;
+
+	struct Big: public Tracked
+	{
+		char data[100000];
+	};
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Scopes make arenas current, and can be nested
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		if ( ! Arena::isSupported() ) return;
+
+		ensure(Arena::getCurrent() == 0);
+		Arena a, b;
+		{
+			Arena::Scope sa(a);
+			ensure(Arena::getCurrent() == &a);
+			{
+				Arena::Scope sb(b);
+				ensure(Arena::getCurrent() == &b);
+			}
+			ensure(Arena::getCurrent() == &a);
+		}
+		ensure(Arena::getCurrent() == 0);
+	}
+
+	// 2 - Objects come from the current arena, and are destroyed on delete
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		if ( ! Arena::isSupported() ) return;
+
+		Arena a(1024);
+		Tracked* heap = new Tracked;
+		{
+			Arena::Scope s(a);
+			for (int i=0; i<100; ++i)
+			{
+				Tracked* t = new Tracked;
+				// aligned for any type
+				ensure_equals(reinterpret_cast<std::size_t>(t) % sizeof(double), 0u);
+				delete t;
+			}
+			ensure(a.getAllocatedBytes() >= 100 * sizeof(Tracked));
+
+			// large objects get a block of their own
+			Tracked* big = new Big;
+			ensure(a.getAllocatedBytes() >= sizeof(Big));
+			delete big;
+
+			// objects allocated outside the scope can be deleted in it
+			delete heap;
+		}
+		ensure_equals(Tracked::live, 0);
+
+		// without a current arena objects come from the heap
+		std::size_t used = a.getAllocatedBytes();
+		Tracked* t = new Tracked;
+		delete t;
+		ensure_equals(a.getAllocatedBytes(), used);
+	}
+
+	// 3 - Overlay and relate work with their arenas
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		geos::io::WKTReader reader;
+		std::auto_ptr<geos::geom::Geometry> a(reader.read(
+			"POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))"));
+		std::auto_ptr<geos::geom::Geometry> b(reader.read(
+			"POLYGON((5 5, 15 5, 15 15, 5 15, 5 5))"));
+
+		std::auto_ptr<geos::geom::Geometry> i(a->intersection(b.get()));
+		ensure_equals(i->getArea(), 25.0);
+		ensure(a->intersects(b.get()));
+		std::auto_ptr<geos::geom::Geometry> buf(i->buffer(1));
+		ensure(buf->getArea() > 25.0);
+		ensure(Arena::getCurrent() == 0);
+	}
+
+} // namespace tut
+
@@ -0,0 +1,125 @@
+// $Id$
+// 
+// Test Suite for geos::util::TaskRunner class.
+
+// tut
+#include <tut.hpp>
+// geos
+#include <geos/util/TaskRunner.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/TopologyException.h>
+#include <geos/geom/Coordinate.h>
+// std
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tut
+{
+	//
+	// Test Group
+	//
+
+	// Common data used in test cases.
+	struct test_taskrunner_data
+	{
+	};
+
+	typedef test_group<test_taskrunner_data> group;
+	typedef group::object object;
+
+	group test_taskrunner_group("geos::util::TaskRunner");
+
+	// Records how many times each unit was run
+	struct CountingTask: public geos::util::TaskRunner::Task
+	{
+		std::vector<int> runs;
+		CountingTask(std::size_t n) : runs(n, 0) {}
+		void run(std::size_t index) { ++runs[index]; }
+	};
+
+	struct FailingTask: public geos::util::TaskRunner::Task
+	{
+		void run(std::size_t index)
+		{
+			if ( index == 7 ) throw std::runtime_error("unit 7 failed");
+		}
+	};
+
+	struct TopologyFailingTask: public geos::util::TaskRunner::Task
+	{
+		void run(std::size_t index)
+		{
+			if ( index == 7 )
+			{
+				throw geos::util::TopologyException("unit 7 failed",
+				                                    geos::geom::Coordinate(1, 2));
+			}
+		}
+	};
+
+	//
+	// Test Cases
+	//
+
+	// 1 - Every unit runs exactly once
+	template<>
+	template<>
+	void object::test<1>()
+	{
+		unsigned int threads[] = { 1, 3, 0 };
+		for (std::size_t t=0; t<3; ++t)
+		{
+			geos::util::TaskRunner runner(threads[t]);
+			ensure(runner.getNumThreads() >= 1);
+
+			CountingTask task(1000);
+			runner.run(task, task.runs.size());
+			for (std::size_t i=0; i<task.runs.size(); ++i)
+				ensure_equals(task.runs[i], 1);
+		}
+	}
+
+	// 2 - Errors are reported to the caller, the same way whatever
+	//     the number of threads
+	template<>
+	template<>
+	void object::test<2>()
+	{
+		unsigned int threads[] = { 1, 4 };
+		for (std::size_t t=0; t<2; ++t)
+		{
+			geos::util::TaskRunner runner(threads[t]);
+			FailingTask task;
+			try {
+				runner.run(task, 100);
+				fail("exception expected");
+			}
+			catch (const geos::util::GEOSException& e)
+			{
+				ensure_equals(std::string(e.what()), "unit 7 failed");
+			}
+
+			TopologyFailingTask topoTask;
+			try {
+				runner.run(topoTask, 100);
+				fail("exception expected");
+			}
+			catch (geos::util::TopologyException& e)
+			{
+				ensure(e.getCoordinate() == geos::geom::Coordinate(1, 2));
+			}
+		}
+	}
+
+	// 3 - Nothing to do
+	template<>
+	template<>
+	void object::test<3>()
+	{
+		geos::util::TaskRunner runner(4);
+		CountingTask task(0);
+		runner.run(task, 0);
+	}
+
+} // namespace tut